@@ -127,8 +127,19 @@ GPIO_34 - GPIO_39 have no internal pullup / pulldown.
 
 #define ENABLE_DISPLAY 1
 
+// 1 = ROS1 over rosserial, 2 = ROS2 through a Micro XRCE-DDS agent, 3 = rosbridge (ROS1 or ROS2) over WebSocket
+#define ROS_VERSION 1
+
 #define ROS1_HOST "192.168.0.155"
 #define ROS1_PORT 11411
+// Input room for topics subscribed at runtime with ros::GenericSubscriber. Larger frames are skipped.
+#define ROS1_INSPECT_INPUT_SIZE 512
+
+#define ROS2_AGENT_HOST "192.168.0.155"
+#define ROS2_AGENT_PORT 8888
+
+#define ROS_BRIDGE_HOST "192.168.0.155"
+#define ROS_BRIDGE_PORT 9090
 
 
 typedef enum JoyAxis {
@@ -169,5 +180,9 @@ typedef enum JoyButton {
 } JoyButton;
 extern int32_t joyButtons[JOY_BUTTON_SIZE];
 
+// micros() of the input samples that produced the current joyButtons / joyAxes values
+extern uint32_t joyButtonsSampleUs;
+extern uint32_t joyAxesSampleUs;
+
 
 #endif
@@ -9,6 +9,7 @@ void guiRun();
 void mainScreen();
 bool setDisplayBrightness(uint8_t value, void* cbData=nullptr);
 void displayBootScreen();
+void displaySetAlarm(const char* text);
 size_t getTouchCalibrationJson(char* buffer, size_t bSize=1<<30);
 
 // Switch from portrait to landscape
@@ -0,0 +1,22 @@
+#ifndef _HOST_LOOKUP_H_
+#define _HOST_LOOKUP_H_
+
+#include <Arduino.h>
+
+/*======================================================================*\
+ * Non-blocking host name lookup
+ *
+ * WiFi.hostByName() waits for the DNS answer, up to several seconds on a
+ * bad network. hostLookup() starts the lookup and returns right away, the
+ * caller polls it from its loop until it is done. A result is handed out
+ * once: the next call for the same name starts a new lookup, which lwIP
+ * answers from its own cache while the entry is fresh.
+\*======================================================================*/
+
+#define HOST_LOOKUP_SLOTS 4      // Names that can be looked up at the same time
+#define HOST_LOOKUP_NAME_SIZE 64
+
+// 1 = ip is set, 0 = lookup in progress, -1 = unknown host or no slot free
+int hostLookup(const char* host, IPAddress& ip);
+
+#endif // _HOST_LOOKUP_H_
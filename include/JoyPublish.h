@@ -0,0 +1,41 @@
+#ifndef _JOY_PUBLISH_H_
+#define _JOY_PUBLISH_H_
+
+#include <Arduino.h>
+#include "Config.h"
+
+/*======================================================================*\
+ * When to publish the Joy message
+ *
+ * ROS1, ROS2 and rosbridge send the same sensor_msgs/Joy and share the
+ * decision: right away when a button changed or an axis moved more than
+ * "Joy Axis Delta", but not more often than "Joy Min Interval", and again
+ * after "Joy Heartbeat" ms without changes. After a link loss a zeroed
+ * Joy goes out first so the robot stops, the current inputs follow after
+ * the minimum interval. The values to send are in joyPublishAxes and
+ * joyPublishButtons, the links serialize the message from there.
+\*======================================================================*/
+
+typedef enum JoyPublishReason {
+    JOY_PUBLISH_NONE,
+    JOY_PUBLISH_CHANGED,     // An input changed, traced by LatencyTrace
+    JOY_PUBLISH_HEARTBEAT,
+    JOY_PUBLISH_FAILSAFE     // All zero
+} JoyPublishReason;
+
+// Decide at now (ms) whether a Joy message is due. failsafe = the link just came
+// back after a loss. Fills joyPublishAxes / joyPublishButtons unless JOY_PUBLISH_NONE.
+JoyPublishReason joyPublishPoll(uint32_t now, bool failsafe);
+// The message of the last poll was sent. Until then the next poll decides again.
+void joyPublishSent(uint32_t now, JoyPublishReason reason);
+// Zero the values without a poll, for a link that is not the one polled
+void joyPublishZero();
+// Publish the current inputs at the next poll, e.g. to a newly selected robot
+void joyPublishForce(uint32_t now);
+// Encoder steps used for something else, the robots don't see them
+void joyPublishHideTurns(int32_t steps);
+
+extern float joyPublishAxes[JOY_AXIS_SIZE];
+extern int32_t joyPublishButtons[JOY_BUTTON_SIZE];
+
+#endif // _JOY_PUBLISH_H_
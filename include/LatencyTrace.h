@@ -0,0 +1,48 @@
+#ifndef _LATENCY_TRACE_H_
+#define _LATENCY_TRACE_H_
+
+#include <Arduino.h>
+
+/*======================================================================*\
+ * Input-to-wire latency tracing
+ *
+ * A Joy message that was triggered by an input change carries the
+ * microsecond timestamp of that input sample through the publish path:
+ *   sample -> publish decision -> serialized/queued -> socket write
+ * Each stage is recorded into a fixed-bucket histogram that is shown in
+ * the "Latency" state group and can be reset at runtime.
+\*======================================================================*/
+
+#define LATENCY_BUCKETS 16       // Bucket i counts samples below (16us << i), last one is overflow
+#define LATENCY_UPDATE_MS 1000   // How often the state registers are refreshed
+
+typedef enum LatencyStage {
+    LAT_SAMPLE_TO_DECISION,
+    LAT_DECISION_TO_QUEUED,
+    LAT_QUEUED_TO_WRITE,
+    LAT_SAMPLE_TO_WRITE,
+    LAT_STAGE_SIZE
+} LatencyStage;
+
+class LatencyHistogram {
+public:
+    LatencyHistogram() { reset(); }
+    void add(uint32_t us);
+    void reset();
+    uint32_t percentile(uint8_t pct) const; // Upper bound of the bucket holding the percentile
+    size_t format(char* buffer, size_t bSize) const;
+
+    uint32_t count;
+    uint32_t max;
+    uint32_t buckets[LATENCY_BUCKETS];
+};
+
+void latencyTraceStart(uint32_t sampleUs, uint32_t decisionUs);
+void latencyTraceQueued();
+void latencyTraceWritten();
+void latencyTraceReset();
+void latencyTraceRun(uint32_t now);
+
+extern LatencyHistogram latencyHistograms[LAT_STAGE_SIZE];
+
+#endif // _LATENCY_TRACE_H_
@@ -4,19 +4,28 @@
 #include <Arduino.h>
 #include <ros.h>
 #include <std_msgs/Empty.h>
+#include <ros/udp_link.h>
+#include <ros/serial_link.h>
 
 void rosInit();
 void ros1Run();
 
-ros::Time ros1Time(uint32_t ms);
+ros::Time ros1Now();
 
-class Ros1WiFiLink {
+struct Ros1Target;
+
+// Node handle hardware. Hands the frames to the link the target currently uses.
+class Ros1Link {
   public:
-    Ros1WiFiLink() {};
+    Ros1Link() {};
     void init();
     int read();
+    int read(uint8_t* data, size_t length);
     void write(uint8_t* data, int length);
+    int writeSome(const uint8_t* data, int length);
     unsigned long time() { return millis(); }
+
+    Ros1Target* target = nullptr;
 };
 
 void ros1Handler1(const std_msgs::Empty& toggle_msg);
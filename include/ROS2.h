@@ -0,0 +1,14 @@
+#ifndef _ROS2_H_
+#define _ROS2_H_
+
+#include <Arduino.h>
+#include <xrce/session.h>
+#include <xrce/udp_transport.h>
+
+void rosInit();
+void ros2Run();
+
+// ROS time of the agent in ns since the epoch
+int64_t ros2NowNs();
+
+#endif  // _ROS2_H_
@@ -0,0 +1,10 @@
+#ifndef _ROS_BRIDGE_H_
+#define _ROS_BRIDGE_H_
+
+#include <Arduino.h>
+#include <rosbridge/websocket.h>
+
+void rosInit();
+void rosBridgeRun();
+
+#endif  // _ROS_BRIDGE_H_
@@ -36,6 +36,17 @@ namespace actionlib
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 4;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -17,7 +17,7 @@ namespace actionlib
       _terminate_status_type terminate_status;
       typedef bool _ignore_cancel_type;
       _ignore_cancel_type ignore_cancel;
-      typedef const char* _result_text_type;
+      typedef ros::StringView _result_text_type;
       _result_text_type result_text;
       typedef int32_t _the_result_type;
       _the_result_type the_result;
@@ -68,10 +68,10 @@ namespace actionlib
       u_ignore_cancel.real = this->ignore_cancel;
       *(outbuffer + offset + 0) = (u_ignore_cancel.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->ignore_cancel);
-      uint32_t length_result_text = strlen(this->result_text);
+      uint32_t length_result_text = this->result_text.size();
       varToArr(outbuffer + offset, length_result_text);
       offset += 4;
-      memcpy(outbuffer + offset, this->result_text, length_result_text);
+      memcpy(outbuffer + offset, this->result_text.data(), length_result_text);
       offset += length_result_text;
       union {
         int32_t real;
@@ -123,6 +123,23 @@ namespace actionlib
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->terminate_status);
+      offset += sizeof(this->ignore_cancel);
+      offset += 4 + this->result_text.size();
+      offset += sizeof(this->the_result);
+      offset += sizeof(this->is_simple_client);
+      offset += sizeof(this->delay_accept.sec);
+      offset += sizeof(this->delay_accept.nsec);
+      offset += sizeof(this->delay_terminate.sec);
+      offset += sizeof(this->delay_terminate.nsec);
+      offset += sizeof(this->pause_status.sec);
+      offset += sizeof(this->pause_status.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -148,11 +165,7 @@ namespace actionlib
       uint32_t length_result_text;
       arrToVar(length_result_text, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_result_text; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_result_text-1]=0;
-      this->result_text = (char *)(inbuffer + offset-1);
+      this->result_text = ros::StringView((const char *)(inbuffer + offset), length_result_text, false);
       offset += length_result_text;
       union {
         int32_t real;
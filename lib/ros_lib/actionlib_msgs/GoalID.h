@@ -15,7 +15,7 @@ namespace actionlib_msgs
     public:
       typedef ros::Time _stamp_type;
       _stamp_type stamp;
-      typedef const char* _id_type;
+      typedef ros::StringView _id_type;
       _id_type id;
 
     GoalID():
@@ -37,14 +37,23 @@ namespace actionlib_msgs
       *(outbuffer + offset + 2) = (this->stamp.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->stamp.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->stamp.nsec);
-      uint32_t length_id = strlen(this->id);
+      uint32_t length_id = this->id.size();
       varToArr(outbuffer + offset, length_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
+      memcpy(outbuffer + offset, this->id.data(), length_id);
       offset += length_id;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->stamp.sec);
+      offset += sizeof(this->stamp.nsec);
+      offset += 4 + this->id.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -61,11 +70,7 @@ namespace actionlib_msgs
       uint32_t length_id;
       arrToVar(length_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
+      this->id = ros::StringView((const char *)(inbuffer + offset), length_id, false);
       offset += length_id;
      return offset;
     }
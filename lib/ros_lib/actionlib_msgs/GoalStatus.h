@@ -17,7 +17,7 @@ namespace actionlib_msgs
       _goal_id_type goal_id;
       typedef uint8_t _status_type;
       _status_type status;
-      typedef const char* _text_type;
+      typedef ros::StringView _text_type;
       _text_type text;
       enum { PENDING =  0    };
       enum { ACTIVE =  1    };
@@ -43,14 +43,23 @@ namespace actionlib_msgs
       offset += this->goal_id.serialize(outbuffer + offset);
       *(outbuffer + offset + 0) = (this->status >> (8 * 0)) & 0xFF;
       offset += sizeof(this->status);
-      uint32_t length_text = strlen(this->text);
+      uint32_t length_text = this->text.size();
       varToArr(outbuffer + offset, length_text);
       offset += 4;
-      memcpy(outbuffer + offset, this->text, length_text);
+      memcpy(outbuffer + offset, this->text.data(), length_text);
       offset += length_text;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->goal_id.serializedLength();
+      offset += sizeof(this->status);
+      offset += 4 + this->text.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -60,11 +69,7 @@ namespace actionlib_msgs
       uint32_t length_text;
       arrToVar(length_text, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_text; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_text-1]=0;
-      this->text = (char *)(inbuffer + offset-1);
+      this->text = ros::StringView((const char *)(inbuffer + offset), length_text, false);
       offset += length_text;
      return offset;
     }
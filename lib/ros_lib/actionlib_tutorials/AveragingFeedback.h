@@ -75,6 +75,17 @@ namespace actionlib_tutorials
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 16;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
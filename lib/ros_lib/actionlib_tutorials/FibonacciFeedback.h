@@ -30,18 +30,15 @@ namespace actionlib_tutorials
       *(outbuffer + offset + 2) = (this->sequence_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->sequence_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->sequence_length);
-      for( uint32_t i = 0; i < sequence_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_sequencei;
-      u_sequencei.real = this->sequence[i];
-      *(outbuffer + offset + 0) = (u_sequencei.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_sequencei.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_sequencei.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_sequencei.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->sequence[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->sequence, sequence_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->sequence_length);
+      offset += sequence_length * sizeof(this->sequence[0]);
       return offset;
     }
 
@@ -56,20 +53,7 @@ namespace actionlib_tutorials
       if(sequence_lengthT > sequence_length)
         this->sequence = (int32_t*)realloc(this->sequence, sequence_lengthT * sizeof(int32_t));
       sequence_length = sequence_lengthT;
-      for( uint32_t i = 0; i < sequence_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_st_sequence;
-      u_st_sequence.base = 0;
-      u_st_sequence.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_sequence.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_sequence.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_sequence.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_sequence = u_st_sequence.real;
-      offset += sizeof(this->st_sequence);
-        memcpy( &(this->sequence[i]), &(this->st_sequence), sizeof(int32_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->sequence, sequence_length);
      return offset;
     }
 
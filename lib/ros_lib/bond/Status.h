@@ -15,9 +15,9 @@ namespace bond
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _id_type;
+      typedef ros::StringView _id_type;
       _id_type id;
-      typedef const char* _instance_id_type;
+      typedef ros::StringView _instance_id_type;
       _instance_id_type instance_id;
       typedef bool _active_type;
       _active_type active;
@@ -40,15 +40,15 @@ namespace bond
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_id = strlen(this->id);
+      uint32_t length_id = this->id.size();
       varToArr(outbuffer + offset, length_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
+      memcpy(outbuffer + offset, this->id.data(), length_id);
       offset += length_id;
-      uint32_t length_instance_id = strlen(this->instance_id);
+      uint32_t length_instance_id = this->instance_id.size();
       varToArr(outbuffer + offset, length_instance_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->instance_id, length_instance_id);
+      memcpy(outbuffer + offset, this->instance_id.data(), length_instance_id);
       offset += length_instance_id;
       union {
         bool real;
@@ -80,6 +80,18 @@ namespace bond
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->id.size();
+      offset += 4 + this->instance_id.size();
+      offset += sizeof(this->active);
+      offset += sizeof(this->heartbeat_timeout);
+      offset += sizeof(this->heartbeat_period);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -87,20 +99,12 @@ namespace bond
       uint32_t length_id;
       arrToVar(length_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
+      this->id = ros::StringView((const char *)(inbuffer + offset), length_id, false);
       offset += length_id;
       uint32_t length_instance_id;
       arrToVar(length_instance_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_instance_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_instance_id-1]=0;
-      this->instance_id = (char *)(inbuffer + offset-1);
+      this->instance_id = ros::StringView((const char *)(inbuffer + offset), length_instance_id, false);
       offset += length_instance_id;
       union {
         bool real;
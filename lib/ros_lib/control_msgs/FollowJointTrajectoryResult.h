@@ -14,7 +14,7 @@ namespace control_msgs
     public:
       typedef int32_t _error_code_type;
       _error_code_type error_code;
-      typedef const char* _error_string_type;
+      typedef ros::StringView _error_string_type;
       _error_string_type error_string;
       enum { SUCCESSFUL =  0 };
       enum { INVALID_GOAL =  -1 };
@@ -42,14 +42,22 @@ namespace control_msgs
       *(outbuffer + offset + 2) = (u_error_code.base >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (u_error_code.base >> (8 * 3)) & 0xFF;
       offset += sizeof(this->error_code);
-      uint32_t length_error_string = strlen(this->error_string);
+      uint32_t length_error_string = this->error_string.size();
       varToArr(outbuffer + offset, length_error_string);
       offset += 4;
-      memcpy(outbuffer + offset, this->error_string, length_error_string);
+      memcpy(outbuffer + offset, this->error_string.data(), length_error_string);
       offset += length_error_string;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->error_code);
+      offset += 4 + this->error_string.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -67,11 +75,7 @@ namespace control_msgs
       uint32_t length_error_string;
       arrToVar(length_error_string, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_error_string; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_error_string-1]=0;
-      this->error_string = (char *)(inbuffer + offset-1);
+      this->error_string = ros::StringView((const char *)(inbuffer + offset), length_error_string, false);
       offset += length_error_string;
      return offset;
     }
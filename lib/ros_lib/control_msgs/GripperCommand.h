@@ -12,9 +12,9 @@ namespace control_msgs
   class GripperCommand : public ros::Msg
   {
     public:
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type position;
-      typedef float _max_effort_type;
+      typedef ros::float64_t _max_effort_type;
       _max_effort_type max_effort;
 
     GripperCommand():
@@ -26,16 +26,27 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->position);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_effort);
+      offset += serializeFloat64(outbuffer + offset, this->position);
+      offset += serializeFloat64(outbuffer + offset, this->max_effort);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 16;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_effort));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_effort));
      return offset;
     }
 
@@ -12,9 +12,9 @@ namespace control_msgs
   class GripperCommandResult : public ros::Msg
   {
     public:
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type position;
-      typedef float _effort_type;
+      typedef ros::float64_t _effort_type;
       _effort_type effort;
       typedef bool _stalled_type;
       _stalled_type stalled;
@@ -32,8 +32,8 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->position);
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort);
+      offset += serializeFloat64(outbuffer + offset, this->position);
+      offset += serializeFloat64(outbuffer + offset, this->effort);
       union {
         bool real;
         uint8_t base;
@@ -51,11 +51,22 @@ namespace control_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 18;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->effort));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position));
+      offset += deserializeFloat64(inbuffer + offset, &(this->effort));
       union {
         bool real;
         uint8_t base;
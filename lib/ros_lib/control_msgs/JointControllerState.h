@@ -15,25 +15,25 @@ namespace control_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef float _set_point_type;
+      typedef ros::float64_t _set_point_type;
       _set_point_type set_point;
-      typedef float _process_value_type;
+      typedef ros::float64_t _process_value_type;
       _process_value_type process_value;
-      typedef float _process_value_dot_type;
+      typedef ros::float64_t _process_value_dot_type;
       _process_value_dot_type process_value_dot;
-      typedef float _error_type;
+      typedef ros::float64_t _error_type;
       _error_type error;
-      typedef float _time_step_type;
+      typedef ros::float64_t _time_step_type;
       _time_step_type time_step;
-      typedef float _command_type;
+      typedef ros::float64_t _command_type;
       _command_type command;
-      typedef float _p_type;
+      typedef ros::float64_t _p_type;
       _p_type p;
-      typedef float _i_type;
+      typedef ros::float64_t _i_type;
       _i_type i;
-      typedef float _d_type;
+      typedef ros::float64_t _d_type;
       _d_type d;
-      typedef float _i_clamp_type;
+      typedef ros::float64_t _i_clamp_type;
       _i_clamp_type i_clamp;
       typedef bool _antiwindup_type;
       _antiwindup_type antiwindup;
@@ -58,16 +58,16 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->set_point);
-      offset += serializeAvrFloat64(outbuffer + offset, this->process_value);
-      offset += serializeAvrFloat64(outbuffer + offset, this->process_value_dot);
-      offset += serializeAvrFloat64(outbuffer + offset, this->error);
-      offset += serializeAvrFloat64(outbuffer + offset, this->time_step);
-      offset += serializeAvrFloat64(outbuffer + offset, this->command);
-      offset += serializeAvrFloat64(outbuffer + offset, this->p);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i);
-      offset += serializeAvrFloat64(outbuffer + offset, this->d);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_clamp);
+      offset += serializeFloat64(outbuffer + offset, this->set_point);
+      offset += serializeFloat64(outbuffer + offset, this->process_value);
+      offset += serializeFloat64(outbuffer + offset, this->process_value_dot);
+      offset += serializeFloat64(outbuffer + offset, this->error);
+      offset += serializeFloat64(outbuffer + offset, this->time_step);
+      offset += serializeFloat64(outbuffer + offset, this->command);
+      offset += serializeFloat64(outbuffer + offset, this->p);
+      offset += serializeFloat64(outbuffer + offset, this->i);
+      offset += serializeFloat64(outbuffer + offset, this->d);
+      offset += serializeFloat64(outbuffer + offset, this->i_clamp);
       union {
         bool real;
         uint8_t base;
@@ -78,20 +78,38 @@ namespace control_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += sizeof(this->antiwindup);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->set_point));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->process_value));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->process_value_dot));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->error));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->time_step));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->command));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->p));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->d));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_clamp));
+      offset += deserializeFloat64(inbuffer + offset, &(this->set_point));
+      offset += deserializeFloat64(inbuffer + offset, &(this->process_value));
+      offset += deserializeFloat64(inbuffer + offset, &(this->process_value_dot));
+      offset += deserializeFloat64(inbuffer + offset, &(this->error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->time_step));
+      offset += deserializeFloat64(inbuffer + offset, &(this->command));
+      offset += deserializeFloat64(inbuffer + offset, &(this->p));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i));
+      offset += deserializeFloat64(inbuffer + offset, &(this->d));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_clamp));
       union {
         bool real;
         uint8_t base;
@@ -16,18 +16,18 @@ namespace control_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t joint_names_length;
-      typedef char* _joint_names_type;
+      typedef ros::StringView _joint_names_type;
       _joint_names_type st_joint_names;
       _joint_names_type * joint_names;
       uint32_t displacements_length;
-      typedef float _displacements_type;
+      typedef ros::float64_t _displacements_type;
       _displacements_type st_displacements;
       _displacements_type * displacements;
       uint32_t velocities_length;
-      typedef float _velocities_type;
+      typedef ros::float64_t _velocities_type;
       _velocities_type st_velocities;
       _velocities_type * velocities;
-      typedef float _duration_type;
+      typedef ros::float64_t _duration_type;
       _duration_type duration;
 
     JointJog():
@@ -49,10 +49,10 @@ namespace control_msgs
       *(outbuffer + offset + 3) = (this->joint_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->joint_names_length);
       for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_joint_namesi = strlen(this->joint_names[i]);
+      uint32_t length_joint_namesi = this->joint_names[i].size();
       varToArr(outbuffer + offset, length_joint_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_names[i], length_joint_namesi);
+      memcpy(outbuffer + offset, this->joint_names[i].data(), length_joint_namesi);
       offset += length_joint_namesi;
       }
       *(outbuffer + offset + 0) = (this->displacements_length >> (8 * 0)) & 0xFF;
@@ -61,7 +61,7 @@ namespace control_msgs
       *(outbuffer + offset + 3) = (this->displacements_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->displacements_length);
       for( uint32_t i = 0; i < displacements_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->displacements[i]);
+      offset += serializeFloat64(outbuffer + offset, this->displacements[i]);
       }
       *(outbuffer + offset + 0) = (this->velocities_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->velocities_length >> (8 * 1)) & 0xFF;
@@ -69,9 +69,25 @@ namespace control_msgs
       *(outbuffer + offset + 3) = (this->velocities_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->velocities_length);
       for( uint32_t i = 0; i < velocities_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocities[i]);
+      offset += serializeFloat64(outbuffer + offset, this->velocities[i]);
       }
-      offset += serializeAvrFloat64(outbuffer + offset, this->duration);
+      offset += serializeFloat64(outbuffer + offset, this->duration);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->joint_names_length);
+      for( uint32_t i = 0; i < joint_names_length; i++){
+      offset += 4 + this->joint_names[i].size();
+      }
+      offset += sizeof(this->displacements_length);
+      offset += displacements_length * 8;
+      offset += sizeof(this->velocities_length);
+      offset += velocities_length * 8;
+      offset += 8;
       return offset;
     }
 
@@ -85,19 +101,15 @@ namespace control_msgs
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->joint_names_length);
       if(joint_names_lengthT > joint_names_length)
-        this->joint_names = (char**)realloc(this->joint_names, joint_names_lengthT * sizeof(char*));
+        this->joint_names = (ros::StringView*)realloc(this->joint_names, joint_names_lengthT * sizeof(ros::StringView));
       joint_names_length = joint_names_lengthT;
       for( uint32_t i = 0; i < joint_names_length; i++){
       uint32_t length_st_joint_names;
       arrToVar(length_st_joint_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_joint_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_joint_names-1]=0;
-      this->st_joint_names = (char *)(inbuffer + offset-1);
+      this->st_joint_names = ros::StringView((const char *)(inbuffer + offset), length_st_joint_names, false);
       offset += length_st_joint_names;
-        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(char*));
+        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(ros::StringView));
       }
       uint32_t displacements_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       displacements_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -105,11 +117,11 @@ namespace control_msgs
       displacements_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->displacements_length);
       if(displacements_lengthT > displacements_length)
-        this->displacements = (float*)realloc(this->displacements, displacements_lengthT * sizeof(float));
+        this->displacements = (ros::float64_t*)realloc(this->displacements, displacements_lengthT * sizeof(ros::float64_t));
       displacements_length = displacements_lengthT;
       for( uint32_t i = 0; i < displacements_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_displacements));
-        memcpy( &(this->displacements[i]), &(this->st_displacements), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_displacements));
+        memcpy( &(this->displacements[i]), &(this->st_displacements), sizeof(ros::float64_t));
       }
       uint32_t velocities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -117,13 +129,13 @@ namespace control_msgs
       velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->velocities_length);
       if(velocities_lengthT > velocities_length)
-        this->velocities = (float*)realloc(this->velocities, velocities_lengthT * sizeof(float));
+        this->velocities = (ros::float64_t*)realloc(this->velocities, velocities_lengthT * sizeof(ros::float64_t));
       velocities_length = velocities_lengthT;
       for( uint32_t i = 0; i < velocities_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocities));
-        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_velocities));
+        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(ros::float64_t));
       }
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->duration));
+      offset += deserializeFloat64(inbuffer + offset, &(this->duration));
      return offset;
     }
 
@@ -12,13 +12,13 @@ namespace control_msgs
   class JointTolerance : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type position;
-      typedef float _velocity_type;
+      typedef ros::float64_t _velocity_type;
       _velocity_type velocity;
-      typedef float _acceleration_type;
+      typedef ros::float64_t _acceleration_type;
       _acceleration_type acceleration;
 
     JointTolerance():
@@ -32,14 +32,24 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      offset += serializeAvrFloat64(outbuffer + offset, this->position);
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity);
-      offset += serializeAvrFloat64(outbuffer + offset, this->acceleration);
+      offset += serializeFloat64(outbuffer + offset, this->position);
+      offset += serializeFloat64(outbuffer + offset, this->velocity);
+      offset += serializeFloat64(outbuffer + offset, this->acceleration);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -49,15 +59,11 @@ namespace control_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->velocity));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->acceleration));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position));
+      offset += deserializeFloat64(inbuffer + offset, &(this->velocity));
+      offset += deserializeFloat64(inbuffer + offset, &(this->acceleration));
      return offset;
     }
 
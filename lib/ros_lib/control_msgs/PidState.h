@@ -18,27 +18,27 @@ namespace control_msgs
       _header_type header;
       typedef ros::Duration _timestep_type;
       _timestep_type timestep;
-      typedef float _error_type;
+      typedef ros::float64_t _error_type;
       _error_type error;
-      typedef float _error_dot_type;
+      typedef ros::float64_t _error_dot_type;
       _error_dot_type error_dot;
-      typedef float _p_error_type;
+      typedef ros::float64_t _p_error_type;
       _p_error_type p_error;
-      typedef float _i_error_type;
+      typedef ros::float64_t _i_error_type;
       _i_error_type i_error;
-      typedef float _d_error_type;
+      typedef ros::float64_t _d_error_type;
       _d_error_type d_error;
-      typedef float _p_term_type;
+      typedef ros::float64_t _p_term_type;
       _p_term_type p_term;
-      typedef float _i_term_type;
+      typedef ros::float64_t _i_term_type;
       _i_term_type i_term;
-      typedef float _d_term_type;
+      typedef ros::float64_t _d_term_type;
       _d_term_type d_term;
-      typedef float _i_max_type;
+      typedef ros::float64_t _i_max_type;
       _i_max_type i_max;
-      typedef float _i_min_type;
+      typedef ros::float64_t _i_min_type;
       _i_min_type i_min;
-      typedef float _output_type;
+      typedef ros::float64_t _output_type;
       _output_type output;
 
     PidState():
@@ -72,17 +72,37 @@ namespace control_msgs
       *(outbuffer + offset + 2) = (this->timestep.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->timestep.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->timestep.nsec);
-      offset += serializeAvrFloat64(outbuffer + offset, this->error);
-      offset += serializeAvrFloat64(outbuffer + offset, this->error_dot);
-      offset += serializeAvrFloat64(outbuffer + offset, this->p_error);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_error);
-      offset += serializeAvrFloat64(outbuffer + offset, this->d_error);
-      offset += serializeAvrFloat64(outbuffer + offset, this->p_term);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_term);
-      offset += serializeAvrFloat64(outbuffer + offset, this->d_term);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_max);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_min);
-      offset += serializeAvrFloat64(outbuffer + offset, this->output);
+      offset += serializeFloat64(outbuffer + offset, this->error);
+      offset += serializeFloat64(outbuffer + offset, this->error_dot);
+      offset += serializeFloat64(outbuffer + offset, this->p_error);
+      offset += serializeFloat64(outbuffer + offset, this->i_error);
+      offset += serializeFloat64(outbuffer + offset, this->d_error);
+      offset += serializeFloat64(outbuffer + offset, this->p_term);
+      offset += serializeFloat64(outbuffer + offset, this->i_term);
+      offset += serializeFloat64(outbuffer + offset, this->d_term);
+      offset += serializeFloat64(outbuffer + offset, this->i_max);
+      offset += serializeFloat64(outbuffer + offset, this->i_min);
+      offset += serializeFloat64(outbuffer + offset, this->output);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->timestep.sec);
+      offset += sizeof(this->timestep.nsec);
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -100,17 +120,17 @@ namespace control_msgs
       this->timestep.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
       this->timestep.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
       offset += sizeof(this->timestep.nsec);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->error));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->error_dot));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->p_error));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_error));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->d_error));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->p_term));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_term));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->d_term));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_max));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_min));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->output));
+      offset += deserializeFloat64(inbuffer + offset, &(this->error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->error_dot));
+      offset += deserializeFloat64(inbuffer + offset, &(this->p_error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->d_error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->p_term));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_term));
+      offset += deserializeFloat64(inbuffer + offset, &(this->d_term));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_max));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_min));
+      offset += deserializeFloat64(inbuffer + offset, &(this->output));
      return offset;
     }
 
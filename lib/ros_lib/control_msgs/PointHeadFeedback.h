@@ -12,7 +12,7 @@ namespace control_msgs
   class PointHeadFeedback : public ros::Msg
   {
     public:
-      typedef float _pointing_angle_error_type;
+      typedef ros::float64_t _pointing_angle_error_type;
       _pointing_angle_error_type pointing_angle_error;
 
     PointHeadFeedback():
@@ -23,14 +23,25 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->pointing_angle_error);
+      offset += serializeFloat64(outbuffer + offset, this->pointing_angle_error);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 8;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->pointing_angle_error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->pointing_angle_error));
      return offset;
     }
 
@@ -19,11 +19,11 @@ namespace control_msgs
       _target_type target;
       typedef geometry_msgs::Vector3 _pointing_axis_type;
       _pointing_axis_type pointing_axis;
-      typedef const char* _pointing_frame_type;
+      typedef ros::StringView _pointing_frame_type;
       _pointing_frame_type pointing_frame;
       typedef ros::Duration _min_duration_type;
       _min_duration_type min_duration;
-      typedef float _max_velocity_type;
+      typedef ros::float64_t _max_velocity_type;
       _max_velocity_type max_velocity;
 
     PointHeadGoal():
@@ -40,10 +40,10 @@ namespace control_msgs
       int offset = 0;
       offset += this->target.serialize(outbuffer + offset);
       offset += this->pointing_axis.serialize(outbuffer + offset);
-      uint32_t length_pointing_frame = strlen(this->pointing_frame);
+      uint32_t length_pointing_frame = this->pointing_frame.size();
       varToArr(outbuffer + offset, length_pointing_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->pointing_frame, length_pointing_frame);
+      memcpy(outbuffer + offset, this->pointing_frame.data(), length_pointing_frame);
       offset += length_pointing_frame;
       *(outbuffer + offset + 0) = (this->min_duration.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->min_duration.sec >> (8 * 1)) & 0xFF;
@@ -55,7 +55,19 @@ namespace control_msgs
       *(outbuffer + offset + 2) = (this->min_duration.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->min_duration.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->min_duration.nsec);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_velocity);
+      offset += serializeFloat64(outbuffer + offset, this->max_velocity);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->target.serializedLength();
+      offset += this->pointing_axis.serializedLength();
+      offset += 4 + this->pointing_frame.size();
+      offset += sizeof(this->min_duration.sec);
+      offset += sizeof(this->min_duration.nsec);
+      offset += 8;
       return offset;
     }
 
@@ -67,11 +79,7 @@ namespace control_msgs
       uint32_t length_pointing_frame;
       arrToVar(length_pointing_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_pointing_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_pointing_frame-1]=0;
-      this->pointing_frame = (char *)(inbuffer + offset-1);
+      this->pointing_frame = ros::StringView((const char *)(inbuffer + offset), length_pointing_frame, false);
       offset += length_pointing_frame;
       this->min_duration.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -83,7 +91,7 @@ namespace control_msgs
       this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
       this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
       offset += sizeof(this->min_duration.nsec);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_velocity));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_velocity));
      return offset;
     }
 
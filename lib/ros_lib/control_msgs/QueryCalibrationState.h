@@ -24,6 +24,17 @@ static const char QUERYCALIBRATIONSTATE[] = "control_msgs/QueryCalibrationState"
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -59,6 +70,17 @@ static const char QUERYCALIBRATIONSTATE[] = "control_msgs/QueryCalibrationState"
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
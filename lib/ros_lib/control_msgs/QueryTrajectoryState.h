@@ -38,6 +38,17 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 8;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -63,19 +74,19 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
   {
     public:
       uint32_t name_length;
-      typedef char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type st_name;
       _name_type * name;
       uint32_t position_length;
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type st_position;
       _position_type * position;
       uint32_t velocity_length;
-      typedef float _velocity_type;
+      typedef ros::float64_t _velocity_type;
       _velocity_type st_velocity;
       _velocity_type * velocity;
       uint32_t acceleration_length;
-      typedef float _acceleration_type;
+      typedef ros::float64_t _acceleration_type;
       _acceleration_type st_acceleration;
       _acceleration_type * acceleration;
 
@@ -96,10 +107,10 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       *(outbuffer + offset + 3) = (this->name_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->name_length);
       for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_namei = strlen(this->name[i]);
+      uint32_t length_namei = this->name[i].size();
       varToArr(outbuffer + offset, length_namei);
       offset += 4;
-      memcpy(outbuffer + offset, this->name[i], length_namei);
+      memcpy(outbuffer + offset, this->name[i].data(), length_namei);
       offset += length_namei;
       }
       *(outbuffer + offset + 0) = (this->position_length >> (8 * 0)) & 0xFF;
@@ -108,7 +119,7 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       *(outbuffer + offset + 3) = (this->position_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->position_length);
       for( uint32_t i = 0; i < position_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position[i]);
+      offset += serializeFloat64(outbuffer + offset, this->position[i]);
       }
       *(outbuffer + offset + 0) = (this->velocity_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->velocity_length >> (8 * 1)) & 0xFF;
@@ -116,7 +127,7 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       *(outbuffer + offset + 3) = (this->velocity_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->velocity_length);
       for( uint32_t i = 0; i < velocity_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity[i]);
+      offset += serializeFloat64(outbuffer + offset, this->velocity[i]);
       }
       *(outbuffer + offset + 0) = (this->acceleration_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->acceleration_length >> (8 * 1)) & 0xFF;
@@ -124,8 +135,24 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       *(outbuffer + offset + 3) = (this->acceleration_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->acceleration_length);
       for( uint32_t i = 0; i < acceleration_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->acceleration[i]);
+      offset += serializeFloat64(outbuffer + offset, this->acceleration[i]);
+      }
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->name_length);
+      for( uint32_t i = 0; i < name_length; i++){
+      offset += 4 + this->name[i].size();
       }
+      offset += sizeof(this->position_length);
+      offset += position_length * 8;
+      offset += sizeof(this->velocity_length);
+      offset += velocity_length * 8;
+      offset += sizeof(this->acceleration_length);
+      offset += acceleration_length * 8;
       return offset;
     }
 
@@ -138,19 +165,15 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       name_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->name_length);
       if(name_lengthT > name_length)
-        this->name = (char**)realloc(this->name, name_lengthT * sizeof(char*));
+        this->name = (ros::StringView*)realloc(this->name, name_lengthT * sizeof(ros::StringView));
       name_length = name_lengthT;
       for( uint32_t i = 0; i < name_length; i++){
       uint32_t length_st_name;
       arrToVar(length_st_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_name-1]=0;
-      this->st_name = (char *)(inbuffer + offset-1);
+      this->st_name = ros::StringView((const char *)(inbuffer + offset), length_st_name, false);
       offset += length_st_name;
-        memcpy( &(this->name[i]), &(this->st_name), sizeof(char*));
+        memcpy( &(this->name[i]), &(this->st_name), sizeof(ros::StringView));
       }
       uint32_t position_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -158,11 +181,11 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->position_length);
       if(position_lengthT > position_length)
-        this->position = (float*)realloc(this->position, position_lengthT * sizeof(float));
+        this->position = (ros::float64_t*)realloc(this->position, position_lengthT * sizeof(ros::float64_t));
       position_length = position_lengthT;
       for( uint32_t i = 0; i < position_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_position));
-        memcpy( &(this->position[i]), &(this->st_position), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_position));
+        memcpy( &(this->position[i]), &(this->st_position), sizeof(ros::float64_t));
       }
       uint32_t velocity_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -170,11 +193,11 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->velocity_length);
       if(velocity_lengthT > velocity_length)
-        this->velocity = (float*)realloc(this->velocity, velocity_lengthT * sizeof(float));
+        this->velocity = (ros::float64_t*)realloc(this->velocity, velocity_lengthT * sizeof(ros::float64_t));
       velocity_length = velocity_lengthT;
       for( uint32_t i = 0; i < velocity_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocity));
-        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_velocity));
+        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(ros::float64_t));
       }
       uint32_t acceleration_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       acceleration_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -182,11 +205,11 @@ static const char QUERYTRAJECTORYSTATE[] = "control_msgs/QueryTrajectoryState";
       acceleration_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->acceleration_length);
       if(acceleration_lengthT > acceleration_length)
-        this->acceleration = (float*)realloc(this->acceleration, acceleration_lengthT * sizeof(float));
+        this->acceleration = (ros::float64_t*)realloc(this->acceleration, acceleration_lengthT * sizeof(ros::float64_t));
       acceleration_length = acceleration_lengthT;
       for( uint32_t i = 0; i < acceleration_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_acceleration));
-        memcpy( &(this->acceleration[i]), &(this->st_acceleration), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_acceleration));
+        memcpy( &(this->acceleration[i]), &(this->st_acceleration), sizeof(ros::float64_t));
       }
      return offset;
     }
@@ -15,11 +15,11 @@ namespace control_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type position;
-      typedef float _velocity_type;
+      typedef ros::float64_t _velocity_type;
       _velocity_type velocity;
-      typedef float _error_type;
+      typedef ros::float64_t _error_type;
       _error_type error;
 
     SingleJointPositionFeedback():
@@ -34,9 +34,19 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->position);
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity);
-      offset += serializeAvrFloat64(outbuffer + offset, this->error);
+      offset += serializeFloat64(outbuffer + offset, this->position);
+      offset += serializeFloat64(outbuffer + offset, this->velocity);
+      offset += serializeFloat64(outbuffer + offset, this->error);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -44,9 +54,9 @@ namespace control_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->velocity));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->error));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position));
+      offset += deserializeFloat64(inbuffer + offset, &(this->velocity));
+      offset += deserializeFloat64(inbuffer + offset, &(this->error));
      return offset;
     }
 
@@ -13,11 +13,11 @@ namespace control_msgs
   class SingleJointPositionGoal : public ros::Msg
   {
     public:
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type position;
       typedef ros::Duration _min_duration_type;
       _min_duration_type min_duration;
-      typedef float _max_velocity_type;
+      typedef ros::float64_t _max_velocity_type;
       _max_velocity_type max_velocity;
 
     SingleJointPositionGoal():
@@ -30,7 +30,7 @@ namespace control_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->position);
+      offset += serializeFloat64(outbuffer + offset, this->position);
       *(outbuffer + offset + 0) = (this->min_duration.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->min_duration.sec >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->min_duration.sec >> (8 * 2)) & 0xFF;
@@ -41,14 +41,25 @@ namespace control_msgs
       *(outbuffer + offset + 2) = (this->min_duration.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->min_duration.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->min_duration.nsec);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_velocity);
+      offset += serializeFloat64(outbuffer + offset, this->max_velocity);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 24;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position));
       this->min_duration.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
       this->min_duration.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
@@ -59,7 +70,7 @@ namespace control_msgs
       this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
       this->min_duration.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
       offset += sizeof(this->min_duration.nsec);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_velocity));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_velocity));
      return offset;
     }
 
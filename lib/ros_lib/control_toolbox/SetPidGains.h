@@ -13,13 +13,13 @@ static const char SETPIDGAINS[] = "control_toolbox/SetPidGains";
   class SetPidGainsRequest : public ros::Msg
   {
     public:
-      typedef float _p_type;
+      typedef ros::float64_t _p_type;
       _p_type p;
-      typedef float _i_type;
+      typedef ros::float64_t _i_type;
       _i_type i;
-      typedef float _d_type;
+      typedef ros::float64_t _d_type;
       _d_type d;
-      typedef float _i_clamp_type;
+      typedef ros::float64_t _i_clamp_type;
       _i_clamp_type i_clamp;
       typedef bool _antiwindup_type;
       _antiwindup_type antiwindup;
@@ -36,10 +36,10 @@ static const char SETPIDGAINS[] = "control_toolbox/SetPidGains";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->p);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i);
-      offset += serializeAvrFloat64(outbuffer + offset, this->d);
-      offset += serializeAvrFloat64(outbuffer + offset, this->i_clamp);
+      offset += serializeFloat64(outbuffer + offset, this->p);
+      offset += serializeFloat64(outbuffer + offset, this->i);
+      offset += serializeFloat64(outbuffer + offset, this->d);
+      offset += serializeFloat64(outbuffer + offset, this->i_clamp);
       union {
         bool real;
         uint8_t base;
@@ -50,13 +50,24 @@ static const char SETPIDGAINS[] = "control_toolbox/SetPidGains";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 33;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->p));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->d));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->i_clamp));
+      offset += deserializeFloat64(inbuffer + offset, &(this->p));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i));
+      offset += deserializeFloat64(inbuffer + offset, &(this->d));
+      offset += deserializeFloat64(inbuffer + offset, &(this->i_clamp));
       union {
         bool real;
         uint8_t base;
@@ -87,6 +98,17 @@ static const char SETPIDGAINS[] = "control_toolbox/SetPidGains";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -13,42 +13,43 @@ namespace controller_manager_msgs
   class ControllerState : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _state_type;
+      typedef ros::StringView _state_type;
       _state_type state;
-      typedef const char* _type_type;
+      typedef ros::StringView _type_type;
       _type_type type;
       uint32_t claimed_resources_length;
       typedef controller_manager_msgs::HardwareInterfaceResources _claimed_resources_type;
       _claimed_resources_type st_claimed_resources;
       _claimed_resources_type * claimed_resources;
+      uint32_t claimed_resources_capacity;
 
     ControllerState():
       name(""),
       state(""),
       type(""),
-      claimed_resources_length(0), st_claimed_resources(), claimed_resources(nullptr)
+      claimed_resources_length(0), st_claimed_resources(), claimed_resources(nullptr), claimed_resources_capacity(0)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_state = strlen(this->state);
+      uint32_t length_state = this->state.size();
       varToArr(outbuffer + offset, length_state);
       offset += 4;
-      memcpy(outbuffer + offset, this->state, length_state);
+      memcpy(outbuffer + offset, this->state.data(), length_state);
       offset += length_state;
-      uint32_t length_type = strlen(this->type);
+      uint32_t length_type = this->type.size();
       varToArr(outbuffer + offset, length_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
+      memcpy(outbuffer + offset, this->type.data(), length_type);
       offset += length_type;
       *(outbuffer + offset + 0) = (this->claimed_resources_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->claimed_resources_length >> (8 * 1)) & 0xFF;
@@ -61,47 +62,46 @@ namespace controller_manager_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->state.size();
+      offset += 4 + this->type.size();
+      offset += sizeof(this->claimed_resources_length);
+      for( uint32_t i = 0; i < claimed_resources_length; i++){
+      offset += this->claimed_resources[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_state;
       arrToVar(length_state, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_state; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_state-1]=0;
-      this->state = (char *)(inbuffer + offset-1);
+      this->state = ros::StringView((const char *)(inbuffer + offset), length_state, false);
       offset += length_state;
       uint32_t length_type;
       arrToVar(length_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
+      this->type = ros::StringView((const char *)(inbuffer + offset), length_type, false);
       offset += length_type;
       uint32_t claimed_resources_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       claimed_resources_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       claimed_resources_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       claimed_resources_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->claimed_resources_length);
-      if(claimed_resources_lengthT > claimed_resources_length)
-        this->claimed_resources = (controller_manager_msgs::HardwareInterfaceResources*)realloc(this->claimed_resources, claimed_resources_lengthT * sizeof(controller_manager_msgs::HardwareInterfaceResources));
+      this->claimed_resources = ros::reserveMsgs(this->claimed_resources, this->claimed_resources_capacity, claimed_resources_lengthT);
       claimed_resources_length = claimed_resources_lengthT;
       for( uint32_t i = 0; i < claimed_resources_length; i++){
-      offset += this->st_claimed_resources.deserialize(inbuffer + offset);
-        memcpy( &(this->claimed_resources[i]), &(this->st_claimed_resources), sizeof(controller_manager_msgs::HardwareInterfaceResources));
+      offset += this->claimed_resources[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -14,9 +14,9 @@ namespace controller_manager_msgs
   class ControllerStatistics : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _type_type;
+      typedef ros::StringView _type_type;
       _type_type type;
       typedef ros::Time _timestamp_type;
       _timestamp_type timestamp;
@@ -49,15 +49,15 @@ namespace controller_manager_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_type = strlen(this->type);
+      uint32_t length_type = this->type.size();
       varToArr(outbuffer + offset, length_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
+      memcpy(outbuffer + offset, this->type.data(), length_type);
       offset += length_type;
       *(outbuffer + offset + 0) = (this->timestamp.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->timestamp.sec >> (8 * 1)) & 0xFF;
@@ -129,26 +129,38 @@ namespace controller_manager_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->type.size();
+      offset += sizeof(this->timestamp.sec);
+      offset += sizeof(this->timestamp.nsec);
+      offset += sizeof(this->running);
+      offset += sizeof(this->max_time.sec);
+      offset += sizeof(this->max_time.nsec);
+      offset += sizeof(this->mean_time.sec);
+      offset += sizeof(this->mean_time.nsec);
+      offset += sizeof(this->variance_time.sec);
+      offset += sizeof(this->variance_time.nsec);
+      offset += sizeof(this->num_control_loop_overruns);
+      offset += sizeof(this->time_last_control_loop_overrun.sec);
+      offset += sizeof(this->time_last_control_loop_overrun.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_type;
       arrToVar(length_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
+      this->type = ros::StringView((const char *)(inbuffer + offset), length_type, false);
       offset += length_type;
       this->timestamp.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->timestamp.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -42,6 +42,17 @@ namespace controller_manager_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->controller_length);
+      for( uint32_t i = 0; i < controller_length; i++){
+      offset += this->controller[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -24,6 +24,17 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -39,11 +50,11 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
   {
     public:
       uint32_t types_length;
-      typedef char* _types_type;
+      typedef ros::StringView _types_type;
       _types_type st_types;
       _types_type * types;
       uint32_t base_classes_length;
-      typedef char* _base_classes_type;
+      typedef ros::StringView _base_classes_type;
       _base_classes_type st_base_classes;
       _base_classes_type * base_classes;
 
@@ -62,10 +73,10 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
       *(outbuffer + offset + 3) = (this->types_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->types_length);
       for( uint32_t i = 0; i < types_length; i++){
-      uint32_t length_typesi = strlen(this->types[i]);
+      uint32_t length_typesi = this->types[i].size();
       varToArr(outbuffer + offset, length_typesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->types[i], length_typesi);
+      memcpy(outbuffer + offset, this->types[i].data(), length_typesi);
       offset += length_typesi;
       }
       *(outbuffer + offset + 0) = (this->base_classes_length >> (8 * 0)) & 0xFF;
@@ -74,15 +85,29 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
       *(outbuffer + offset + 3) = (this->base_classes_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->base_classes_length);
       for( uint32_t i = 0; i < base_classes_length; i++){
-      uint32_t length_base_classesi = strlen(this->base_classes[i]);
+      uint32_t length_base_classesi = this->base_classes[i].size();
       varToArr(outbuffer + offset, length_base_classesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->base_classes[i], length_base_classesi);
+      memcpy(outbuffer + offset, this->base_classes[i].data(), length_base_classesi);
       offset += length_base_classesi;
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->types_length);
+      for( uint32_t i = 0; i < types_length; i++){
+      offset += 4 + this->types[i].size();
+      }
+      offset += sizeof(this->base_classes_length);
+      for( uint32_t i = 0; i < base_classes_length; i++){
+      offset += 4 + this->base_classes[i].size();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -92,19 +117,15 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
       types_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->types_length);
       if(types_lengthT > types_length)
-        this->types = (char**)realloc(this->types, types_lengthT * sizeof(char*));
+        this->types = (ros::StringView*)realloc(this->types, types_lengthT * sizeof(ros::StringView));
       types_length = types_lengthT;
       for( uint32_t i = 0; i < types_length; i++){
       uint32_t length_st_types;
       arrToVar(length_st_types, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_types; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_types-1]=0;
-      this->st_types = (char *)(inbuffer + offset-1);
+      this->st_types = ros::StringView((const char *)(inbuffer + offset), length_st_types, false);
       offset += length_st_types;
-        memcpy( &(this->types[i]), &(this->st_types), sizeof(char*));
+        memcpy( &(this->types[i]), &(this->st_types), sizeof(ros::StringView));
       }
       uint32_t base_classes_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       base_classes_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -112,19 +133,15 @@ static const char LISTCONTROLLERTYPES[] = "controller_manager_msgs/ListControlle
       base_classes_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->base_classes_length);
       if(base_classes_lengthT > base_classes_length)
-        this->base_classes = (char**)realloc(this->base_classes, base_classes_lengthT * sizeof(char*));
+        this->base_classes = (ros::StringView*)realloc(this->base_classes, base_classes_lengthT * sizeof(ros::StringView));
       base_classes_length = base_classes_lengthT;
       for( uint32_t i = 0; i < base_classes_length; i++){
       uint32_t length_st_base_classes;
       arrToVar(length_st_base_classes, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_base_classes; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_base_classes-1]=0;
-      this->st_base_classes = (char *)(inbuffer + offset-1);
+      this->st_base_classes = ros::StringView((const char *)(inbuffer + offset), length_st_base_classes, false);
       offset += length_st_base_classes;
-        memcpy( &(this->base_classes[i]), &(this->st_base_classes), sizeof(char*));
+        memcpy( &(this->base_classes[i]), &(this->st_base_classes), sizeof(ros::StringView));
       }
      return offset;
     }
@@ -25,6 +25,17 @@ static const char LISTCONTROLLERS[] = "controller_manager_msgs/ListControllers";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -43,9 +54,10 @@ static const char LISTCONTROLLERS[] = "controller_manager_msgs/ListControllers";
       typedef controller_manager_msgs::ControllerState _controller_type;
       _controller_type st_controller;
       _controller_type * controller;
+      uint32_t controller_capacity;
 
     ListControllersResponse():
-      controller_length(0), st_controller(), controller(nullptr)
+      controller_length(0), st_controller(), controller(nullptr), controller_capacity(0)
     {
     }
 
@@ -63,6 +75,16 @@ static const char LISTCONTROLLERS[] = "controller_manager_msgs/ListControllers";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->controller_length);
+      for( uint32_t i = 0; i < controller_length; i++){
+      offset += this->controller[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -71,12 +93,10 @@ static const char LISTCONTROLLERS[] = "controller_manager_msgs/ListControllers";
       controller_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       controller_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->controller_length);
-      if(controller_lengthT > controller_length)
-        this->controller = (controller_manager_msgs::ControllerState*)realloc(this->controller, controller_lengthT * sizeof(controller_manager_msgs::ControllerState));
+      this->controller = ros::reserveMsgs(this->controller, this->controller_capacity, controller_lengthT);
       controller_length = controller_lengthT;
       for( uint32_t i = 0; i < controller_length; i++){
-      offset += this->st_controller.deserialize(inbuffer + offset);
-        memcpy( &(this->controller[i]), &(this->st_controller), sizeof(controller_manager_msgs::ControllerState));
+      offset += this->controller[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
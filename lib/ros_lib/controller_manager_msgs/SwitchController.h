@@ -14,18 +14,18 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
   {
     public:
       uint32_t start_controllers_length;
-      typedef char* _start_controllers_type;
+      typedef ros::StringView _start_controllers_type;
       _start_controllers_type st_start_controllers;
       _start_controllers_type * start_controllers;
       uint32_t stop_controllers_length;
-      typedef char* _stop_controllers_type;
+      typedef ros::StringView _stop_controllers_type;
       _stop_controllers_type st_stop_controllers;
       _stop_controllers_type * stop_controllers;
       typedef int32_t _strictness_type;
       _strictness_type strictness;
       typedef bool _start_asap_type;
       _start_asap_type start_asap;
-      typedef float _timeout_type;
+      typedef ros::float64_t _timeout_type;
       _timeout_type timeout;
       enum { BEST_EFFORT = 1 };
       enum { STRICT = 2 };
@@ -48,10 +48,10 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       *(outbuffer + offset + 3) = (this->start_controllers_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->start_controllers_length);
       for( uint32_t i = 0; i < start_controllers_length; i++){
-      uint32_t length_start_controllersi = strlen(this->start_controllers[i]);
+      uint32_t length_start_controllersi = this->start_controllers[i].size();
       varToArr(outbuffer + offset, length_start_controllersi);
       offset += 4;
-      memcpy(outbuffer + offset, this->start_controllers[i], length_start_controllersi);
+      memcpy(outbuffer + offset, this->start_controllers[i].data(), length_start_controllersi);
       offset += length_start_controllersi;
       }
       *(outbuffer + offset + 0) = (this->stop_controllers_length >> (8 * 0)) & 0xFF;
@@ -60,10 +60,10 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       *(outbuffer + offset + 3) = (this->stop_controllers_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->stop_controllers_length);
       for( uint32_t i = 0; i < stop_controllers_length; i++){
-      uint32_t length_stop_controllersi = strlen(this->stop_controllers[i]);
+      uint32_t length_stop_controllersi = this->stop_controllers[i].size();
       varToArr(outbuffer + offset, length_stop_controllersi);
       offset += 4;
-      memcpy(outbuffer + offset, this->stop_controllers[i], length_stop_controllersi);
+      memcpy(outbuffer + offset, this->stop_controllers[i].data(), length_stop_controllersi);
       offset += length_stop_controllersi;
       }
       union {
@@ -83,7 +83,24 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       u_start_asap.real = this->start_asap;
       *(outbuffer + offset + 0) = (u_start_asap.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->start_asap);
-      offset += serializeAvrFloat64(outbuffer + offset, this->timeout);
+      offset += serializeFloat64(outbuffer + offset, this->timeout);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->start_controllers_length);
+      for( uint32_t i = 0; i < start_controllers_length; i++){
+      offset += 4 + this->start_controllers[i].size();
+      }
+      offset += sizeof(this->stop_controllers_length);
+      for( uint32_t i = 0; i < stop_controllers_length; i++){
+      offset += 4 + this->stop_controllers[i].size();
+      }
+      offset += sizeof(this->strictness);
+      offset += sizeof(this->start_asap);
+      offset += 8;
       return offset;
     }
 
@@ -96,19 +113,15 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       start_controllers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->start_controllers_length);
       if(start_controllers_lengthT > start_controllers_length)
-        this->start_controllers = (char**)realloc(this->start_controllers, start_controllers_lengthT * sizeof(char*));
+        this->start_controllers = (ros::StringView*)realloc(this->start_controllers, start_controllers_lengthT * sizeof(ros::StringView));
       start_controllers_length = start_controllers_lengthT;
       for( uint32_t i = 0; i < start_controllers_length; i++){
       uint32_t length_st_start_controllers;
       arrToVar(length_st_start_controllers, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_start_controllers; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_start_controllers-1]=0;
-      this->st_start_controllers = (char *)(inbuffer + offset-1);
+      this->st_start_controllers = ros::StringView((const char *)(inbuffer + offset), length_st_start_controllers, false);
       offset += length_st_start_controllers;
-        memcpy( &(this->start_controllers[i]), &(this->st_start_controllers), sizeof(char*));
+        memcpy( &(this->start_controllers[i]), &(this->st_start_controllers), sizeof(ros::StringView));
       }
       uint32_t stop_controllers_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       stop_controllers_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -116,19 +129,15 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       stop_controllers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->stop_controllers_length);
       if(stop_controllers_lengthT > stop_controllers_length)
-        this->stop_controllers = (char**)realloc(this->stop_controllers, stop_controllers_lengthT * sizeof(char*));
+        this->stop_controllers = (ros::StringView*)realloc(this->stop_controllers, stop_controllers_lengthT * sizeof(ros::StringView));
       stop_controllers_length = stop_controllers_lengthT;
       for( uint32_t i = 0; i < stop_controllers_length; i++){
       uint32_t length_st_stop_controllers;
       arrToVar(length_st_stop_controllers, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_stop_controllers; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_stop_controllers-1]=0;
-      this->st_stop_controllers = (char *)(inbuffer + offset-1);
+      this->st_stop_controllers = ros::StringView((const char *)(inbuffer + offset), length_st_stop_controllers, false);
       offset += length_st_stop_controllers;
-        memcpy( &(this->stop_controllers[i]), &(this->st_stop_controllers), sizeof(char*));
+        memcpy( &(this->stop_controllers[i]), &(this->st_stop_controllers), sizeof(ros::StringView));
       }
       union {
         int32_t real;
@@ -149,7 +158,7 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       u_start_asap.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
       this->start_asap = u_start_asap.real;
       offset += sizeof(this->start_asap);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->timeout));
+      offset += deserializeFloat64(inbuffer + offset, &(this->timeout));
      return offset;
     }
 
@@ -182,6 +191,17 @@ static const char SWITCHCONTROLLER[] = "controller_manager_msgs/SwitchController
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -13,7 +13,7 @@ static const char UNLOADCONTROLLER[] = "controller_manager_msgs/UnloadController
   class UnloadControllerRequest : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
 
     UnloadControllerRequest():
@@ -24,25 +24,28 @@ static const char UNLOADCONTROLLER[] = "controller_manager_msgs/UnloadController
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
      return offset;
     }
@@ -76,6 +79,17 @@ static const char UNLOADCONTROLLER[] = "controller_manager_msgs/UnloadController
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -13,7 +13,7 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
   class AddDiagnosticsRequest : public ros::Msg
   {
     public:
-      typedef const char* _load_namespace_type;
+      typedef ros::StringView _load_namespace_type;
       _load_namespace_type load_namespace;
 
     AddDiagnosticsRequest():
@@ -24,25 +24,28 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_load_namespace = strlen(this->load_namespace);
+      uint32_t length_load_namespace = this->load_namespace.size();
       varToArr(outbuffer + offset, length_load_namespace);
       offset += 4;
-      memcpy(outbuffer + offset, this->load_namespace, length_load_namespace);
+      memcpy(outbuffer + offset, this->load_namespace.data(), length_load_namespace);
       offset += length_load_namespace;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->load_namespace.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_load_namespace;
       arrToVar(length_load_namespace, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_load_namespace; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_load_namespace-1]=0;
-      this->load_namespace = (char *)(inbuffer + offset-1);
+      this->load_namespace = ros::StringView((const char *)(inbuffer + offset), length_load_namespace, false);
       offset += length_load_namespace;
      return offset;
     }
@@ -57,7 +60,7 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _message_type;
+      typedef ros::StringView _message_type;
       _message_type message;
 
     AddDiagnosticsResponse():
@@ -76,14 +79,22 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_message = strlen(this->message);
+      uint32_t length_message = this->message.size();
       varToArr(outbuffer + offset, length_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->message, length_message);
+      memcpy(outbuffer + offset, this->message.data(), length_message);
       offset += length_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,11 +109,7 @@ static const char ADDDIAGNOSTICS[] = "diagnostic_msgs/AddDiagnostics";
       uint32_t length_message;
       arrToVar(length_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message-1]=0;
-      this->message = (char *)(inbuffer + offset-1);
+      this->message = ros::StringView((const char *)(inbuffer + offset), length_message, false);
       offset += length_message;
      return offset;
     }
@@ -20,10 +20,11 @@ namespace diagnostic_msgs
       typedef diagnostic_msgs::DiagnosticStatus _status_type;
       _status_type st_status;
       _status_type * status;
+      uint32_t status_capacity;
 
     DiagnosticArray():
       header(),
-      status_length(0), st_status(), status(nullptr)
+      status_length(0), st_status(), status(nullptr), status_capacity(0)
     {
     }
 
@@ -42,6 +43,17 @@ namespace diagnostic_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->status_length);
+      for( uint32_t i = 0; i < status_length; i++){
+      offset += this->status[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -51,12 +63,10 @@ namespace diagnostic_msgs
       status_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       status_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->status_length);
-      if(status_lengthT > status_length)
-        this->status = (diagnostic_msgs::DiagnosticStatus*)realloc(this->status, status_lengthT * sizeof(diagnostic_msgs::DiagnosticStatus));
+      this->status = ros::reserveMsgs(this->status, this->status_capacity, status_lengthT);
       status_length = status_lengthT;
       for( uint32_t i = 0; i < status_length; i++){
-      offset += this->st_status.deserialize(inbuffer + offset);
-        memcpy( &(this->status[i]), &(this->st_status), sizeof(diagnostic_msgs::DiagnosticStatus));
+      offset += this->status[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -15,11 +15,11 @@ namespace diagnostic_msgs
     public:
       typedef int8_t _level_type;
       _level_type level;
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _message_type;
+      typedef ros::StringView _message_type;
       _message_type message;
-      typedef const char* _hardware_id_type;
+      typedef ros::StringView _hardware_id_type;
       _hardware_id_type hardware_id;
       uint32_t values_length;
       typedef diagnostic_msgs::KeyValue _values_type;
@@ -49,20 +49,20 @@ namespace diagnostic_msgs
       u_level.real = this->level;
       *(outbuffer + offset + 0) = (u_level.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->level);
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_message = strlen(this->message);
+      uint32_t length_message = this->message.size();
       varToArr(outbuffer + offset, length_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->message, length_message);
+      memcpy(outbuffer + offset, this->message.data(), length_message);
       offset += length_message;
-      uint32_t length_hardware_id = strlen(this->hardware_id);
+      uint32_t length_hardware_id = this->hardware_id.size();
       varToArr(outbuffer + offset, length_hardware_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->hardware_id, length_hardware_id);
+      memcpy(outbuffer + offset, this->hardware_id.data(), length_hardware_id);
       offset += length_hardware_id;
       *(outbuffer + offset + 0) = (this->values_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->values_length >> (8 * 1)) & 0xFF;
@@ -75,6 +75,20 @@ namespace diagnostic_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->level);
+      offset += 4 + this->name.size();
+      offset += 4 + this->message.size();
+      offset += 4 + this->hardware_id.size();
+      offset += sizeof(this->values_length);
+      for( uint32_t i = 0; i < values_length; i++){
+      offset += this->values[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -89,29 +103,17 @@ namespace diagnostic_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_message;
       arrToVar(length_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message-1]=0;
-      this->message = (char *)(inbuffer + offset-1);
+      this->message = ros::StringView((const char *)(inbuffer + offset), length_message, false);
       offset += length_message;
       uint32_t length_hardware_id;
       arrToVar(length_hardware_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_hardware_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_hardware_id-1]=0;
-      this->hardware_id = (char *)(inbuffer + offset-1);
+      this->hardware_id = ros::StringView((const char *)(inbuffer + offset), length_hardware_id, false);
       offset += length_hardware_id;
       uint32_t values_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       values_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -12,9 +12,9 @@ namespace diagnostic_msgs
   class KeyValue : public ros::Msg
   {
     public:
-      typedef const char* _key_type;
+      typedef ros::StringView _key_type;
       _key_type key;
-      typedef const char* _value_type;
+      typedef ros::StringView _value_type;
       _value_type value;
 
     KeyValue():
@@ -26,39 +26,39 @@ namespace diagnostic_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_key = strlen(this->key);
+      uint32_t length_key = this->key.size();
       varToArr(outbuffer + offset, length_key);
       offset += 4;
-      memcpy(outbuffer + offset, this->key, length_key);
+      memcpy(outbuffer + offset, this->key.data(), length_key);
       offset += length_key;
-      uint32_t length_value = strlen(this->value);
+      uint32_t length_value = this->value.size();
       varToArr(outbuffer + offset, length_value);
       offset += 4;
-      memcpy(outbuffer + offset, this->value, length_value);
+      memcpy(outbuffer + offset, this->value.data(), length_value);
       offset += length_value;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->key.size();
+      offset += 4 + this->value.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_key;
       arrToVar(length_key, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_key; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_key-1]=0;
-      this->key = (char *)(inbuffer + offset-1);
+      this->key = ros::StringView((const char *)(inbuffer + offset), length_key, false);
       offset += length_key;
       uint32_t length_value;
       arrToVar(length_value, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_value; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_value-1]=0;
-      this->value = (char *)(inbuffer + offset-1);
+      this->value = ros::StringView((const char *)(inbuffer + offset), length_value, false);
       offset += length_value;
      return offset;
     }
@@ -25,6 +25,17 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -39,7 +50,7 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
   class SelfTestResponse : public ros::Msg
   {
     public:
-      typedef const char* _id_type;
+      typedef ros::StringView _id_type;
       _id_type id;
       typedef int8_t _passed_type;
       _passed_type passed;
@@ -47,21 +58,22 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
       typedef diagnostic_msgs::DiagnosticStatus _status_type;
       _status_type st_status;
       _status_type * status;
+      uint32_t status_capacity;
 
     SelfTestResponse():
       id(""),
       passed(0),
-      status_length(0), st_status(), status(nullptr)
+      status_length(0), st_status(), status(nullptr), status_capacity(0)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_id = strlen(this->id);
+      uint32_t length_id = this->id.size();
       varToArr(outbuffer + offset, length_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->id, length_id);
+      memcpy(outbuffer + offset, this->id.data(), length_id);
       offset += length_id;
       union {
         int8_t real;
@@ -81,17 +93,25 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->id.size();
+      offset += sizeof(this->passed);
+      offset += sizeof(this->status_length);
+      for( uint32_t i = 0; i < status_length; i++){
+      offset += this->status[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_id;
       arrToVar(length_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_id-1]=0;
-      this->id = (char *)(inbuffer + offset-1);
+      this->id = ros::StringView((const char *)(inbuffer + offset), length_id, false);
       offset += length_id;
       union {
         int8_t real;
@@ -106,12 +126,10 @@ static const char SELFTEST[] = "diagnostic_msgs/SelfTest";
       status_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       status_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->status_length);
-      if(status_lengthT > status_length)
-        this->status = (diagnostic_msgs::DiagnosticStatus*)realloc(this->status, status_lengthT * sizeof(diagnostic_msgs::DiagnosticStatus));
+      this->status = ros::reserveMsgs(this->status, this->status_capacity, status_lengthT);
       status_length = status_lengthT;
       for( uint32_t i = 0; i < status_length; i++){
-      offset += this->st_status.deserialize(inbuffer + offset);
-        memcpy( &(this->status[i]), &(this->st_status), sizeof(diagnostic_msgs::DiagnosticStatus));
+      offset += this->status[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -18,6 +18,7 @@ namespace dynamic_reconfigure
       typedef dynamic_reconfigure::Group _groups_type;
       _groups_type st_groups;
       _groups_type * groups;
+      uint32_t groups_capacity;
       typedef dynamic_reconfigure::Config _max_type;
       _max_type max;
       typedef dynamic_reconfigure::Config _min_type;
@@ -26,7 +27,7 @@ namespace dynamic_reconfigure
       _dflt_type dflt;
 
     ConfigDescription():
-      groups_length(0), st_groups(), groups(nullptr),
+      groups_length(0), st_groups(), groups(nullptr), groups_capacity(0),
       max(),
       min(),
       dflt()
@@ -50,6 +51,19 @@ namespace dynamic_reconfigure
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->groups_length);
+      for( uint32_t i = 0; i < groups_length; i++){
+      offset += this->groups[i].serializedLength();
+      }
+      offset += this->max.serializedLength();
+      offset += this->min.serializedLength();
+      offset += this->dflt.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -58,12 +72,10 @@ namespace dynamic_reconfigure
       groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       groups_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->groups_length);
-      if(groups_lengthT > groups_length)
-        this->groups = (dynamic_reconfigure::Group*)realloc(this->groups, groups_lengthT * sizeof(dynamic_reconfigure::Group));
+      this->groups = ros::reserveMsgs(this->groups, this->groups_capacity, groups_lengthT);
       groups_length = groups_lengthT;
       for( uint32_t i = 0; i < groups_length; i++){
-      offset += this->st_groups.deserialize(inbuffer + offset);
-        memcpy( &(this->groups[i]), &(this->st_groups), sizeof(dynamic_reconfigure::Group));
+      offset += this->groups[i].deserialize(inbuffer + offset);
       }
       offset += this->max.deserialize(inbuffer + offset);
       offset += this->min.deserialize(inbuffer + offset);
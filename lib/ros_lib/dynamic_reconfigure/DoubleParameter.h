@@ -12,9 +12,9 @@ namespace dynamic_reconfigure
   class DoubleParameter : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef float _value_type;
+      typedef ros::float64_t _value_type;
       _value_type value;
 
     DoubleParameter():
@@ -26,12 +26,20 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      offset += serializeAvrFloat64(outbuffer + offset, this->value);
+      offset += serializeFloat64(outbuffer + offset, this->value);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 8;
       return offset;
     }
 
@@ -41,13 +49,9 @@ namespace dynamic_reconfigure
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->value));
+      offset += deserializeFloat64(inbuffer + offset, &(this->value));
      return offset;
     }
 
@@ -13,9 +13,9 @@ namespace dynamic_reconfigure
   class Group : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _type_type;
+      typedef ros::StringView _type_type;
       _type_type type;
       uint32_t parameters_length;
       typedef dynamic_reconfigure::ParamDescription _parameters_type;
@@ -38,15 +38,15 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_type = strlen(this->type);
+      uint32_t length_type = this->type.size();
       varToArr(outbuffer + offset, length_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
+      memcpy(outbuffer + offset, this->type.data(), length_type);
       offset += length_type;
       *(outbuffer + offset + 0) = (this->parameters_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->parameters_length >> (8 * 1)) & 0xFF;
@@ -79,26 +79,32 @@ namespace dynamic_reconfigure
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->type.size();
+      offset += sizeof(this->parameters_length);
+      for( uint32_t i = 0; i < parameters_length; i++){
+      offset += this->parameters[i].serializedLength();
+      }
+      offset += sizeof(this->parent);
+      offset += sizeof(this->id);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_type;
       arrToVar(length_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
+      this->type = ros::StringView((const char *)(inbuffer + offset), length_type, false);
       offset += length_type;
       uint32_t parameters_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       parameters_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -12,15 +12,15 @@ namespace dynamic_reconfigure
   class ParamDescription : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _type_type;
+      typedef ros::StringView _type_type;
       _type_type type;
       typedef uint32_t _level_type;
       _level_type level;
-      typedef const char* _description_type;
+      typedef ros::StringView _description_type;
       _description_type description;
-      typedef const char* _edit_method_type;
+      typedef ros::StringView _edit_method_type;
       _edit_method_type edit_method;
 
     ParamDescription():
@@ -35,54 +35,57 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_type = strlen(this->type);
+      uint32_t length_type = this->type.size();
       varToArr(outbuffer + offset, length_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
+      memcpy(outbuffer + offset, this->type.data(), length_type);
       offset += length_type;
       *(outbuffer + offset + 0) = (this->level >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->level >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->level >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->level >> (8 * 3)) & 0xFF;
       offset += sizeof(this->level);
-      uint32_t length_description = strlen(this->description);
+      uint32_t length_description = this->description.size();
       varToArr(outbuffer + offset, length_description);
       offset += 4;
-      memcpy(outbuffer + offset, this->description, length_description);
+      memcpy(outbuffer + offset, this->description.data(), length_description);
       offset += length_description;
-      uint32_t length_edit_method = strlen(this->edit_method);
+      uint32_t length_edit_method = this->edit_method.size();
       varToArr(outbuffer + offset, length_edit_method);
       offset += 4;
-      memcpy(outbuffer + offset, this->edit_method, length_edit_method);
+      memcpy(outbuffer + offset, this->edit_method.data(), length_edit_method);
       offset += length_edit_method;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->type.size();
+      offset += sizeof(this->level);
+      offset += 4 + this->description.size();
+      offset += 4 + this->edit_method.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_type;
       arrToVar(length_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
+      this->type = ros::StringView((const char *)(inbuffer + offset), length_type, false);
       offset += length_type;
       this->level =  ((uint32_t) (*(inbuffer + offset)));
       this->level |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -92,20 +95,12 @@ namespace dynamic_reconfigure
       uint32_t length_description;
       arrToVar(length_description, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_description; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_description-1]=0;
-      this->description = (char *)(inbuffer + offset-1);
+      this->description = ros::StringView((const char *)(inbuffer + offset), length_description, false);
       offset += length_description;
       uint32_t length_edit_method;
       arrToVar(length_edit_method, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_edit_method; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_edit_method-1]=0;
-      this->edit_method = (char *)(inbuffer + offset-1);
+      this->edit_method = ros::StringView((const char *)(inbuffer + offset), length_edit_method, false);
       offset += length_edit_method;
      return offset;
     }
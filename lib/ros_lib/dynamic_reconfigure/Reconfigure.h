@@ -29,6 +29,13 @@ static const char RECONFIGURE[] = "dynamic_reconfigure/Reconfigure";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->config.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -59,6 +66,13 @@ static const char RECONFIGURE[] = "dynamic_reconfigure/Reconfigure";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->config.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
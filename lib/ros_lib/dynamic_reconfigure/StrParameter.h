@@ -12,9 +12,9 @@ namespace dynamic_reconfigure
   class StrParameter : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _value_type;
+      typedef ros::StringView _value_type;
       _value_type value;
 
     StrParameter():
@@ -26,39 +26,39 @@ namespace dynamic_reconfigure
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_value = strlen(this->value);
+      uint32_t length_value = this->value.size();
       varToArr(outbuffer + offset, length_value);
       offset += 4;
-      memcpy(outbuffer + offset, this->value, length_value);
+      memcpy(outbuffer + offset, this->value.data(), length_value);
       offset += length_value;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->value.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_value;
       arrToVar(length_value, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_value; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_value-1]=0;
-      this->value = (char *)(inbuffer + offset-1);
+      this->value = ros::StringView((const char *)(inbuffer + offset), length_value, false);
       offset += length_value;
      return offset;
     }
@@ -17,9 +17,9 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
   class ApplyBodyWrenchRequest : public ros::Msg
   {
     public:
-      typedef const char* _body_name_type;
+      typedef ros::StringView _body_name_type;
       _body_name_type body_name;
-      typedef const char* _reference_frame_type;
+      typedef ros::StringView _reference_frame_type;
       _reference_frame_type reference_frame;
       typedef geometry_msgs::Point _reference_point_type;
       _reference_point_type reference_point;
@@ -43,15 +43,15 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_body_name = strlen(this->body_name);
+      uint32_t length_body_name = this->body_name.size();
       varToArr(outbuffer + offset, length_body_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->body_name, length_body_name);
+      memcpy(outbuffer + offset, this->body_name.data(), length_body_name);
       offset += length_body_name;
-      uint32_t length_reference_frame = strlen(this->reference_frame);
+      uint32_t length_reference_frame = this->reference_frame.size();
       varToArr(outbuffer + offset, length_reference_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->reference_frame, length_reference_frame);
+      memcpy(outbuffer + offset, this->reference_frame.data(), length_reference_frame);
       offset += length_reference_frame;
       offset += this->reference_point.serialize(outbuffer + offset);
       offset += this->wrench.serialize(outbuffer + offset);
@@ -78,26 +78,32 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->body_name.size();
+      offset += 4 + this->reference_frame.size();
+      offset += this->reference_point.serializedLength();
+      offset += this->wrench.serializedLength();
+      offset += sizeof(this->start_time.sec);
+      offset += sizeof(this->start_time.nsec);
+      offset += sizeof(this->duration.sec);
+      offset += sizeof(this->duration.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_body_name;
       arrToVar(length_body_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_body_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_body_name-1]=0;
-      this->body_name = (char *)(inbuffer + offset-1);
+      this->body_name = ros::StringView((const char *)(inbuffer + offset), length_body_name, false);
       offset += length_body_name;
       uint32_t length_reference_frame;
       arrToVar(length_reference_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_reference_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_reference_frame-1]=0;
-      this->reference_frame = (char *)(inbuffer + offset-1);
+      this->reference_frame = ros::StringView((const char *)(inbuffer + offset), length_reference_frame, false);
       offset += length_reference_frame;
       offset += this->reference_point.deserialize(inbuffer + offset);
       offset += this->wrench.deserialize(inbuffer + offset);
@@ -134,7 +140,7 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     ApplyBodyWrenchResponse():
@@ -153,14 +159,22 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -175,11 +189,7 @@ static const char APPLYBODYWRENCH[] = "gazebo_msgs/ApplyBodyWrench";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -15,9 +15,9 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
   class ApplyJointEffortRequest : public ros::Msg
   {
     public:
-      typedef const char* _joint_name_type;
+      typedef ros::StringView _joint_name_type;
       _joint_name_type joint_name;
-      typedef float _effort_type;
+      typedef ros::float64_t _effort_type;
       _effort_type effort;
       typedef ros::Time _start_time_type;
       _start_time_type start_time;
@@ -35,12 +35,12 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_joint_name = strlen(this->joint_name);
+      uint32_t length_joint_name = this->joint_name.size();
       varToArr(outbuffer + offset, length_joint_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_name, length_joint_name);
+      memcpy(outbuffer + offset, this->joint_name.data(), length_joint_name);
       offset += length_joint_name;
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort);
+      offset += serializeFloat64(outbuffer + offset, this->effort);
       *(outbuffer + offset + 0) = (this->start_time.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->start_time.sec >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->start_time.sec >> (8 * 2)) & 0xFF;
@@ -64,19 +64,27 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->joint_name.size();
+      offset += 8;
+      offset += sizeof(this->start_time.sec);
+      offset += sizeof(this->start_time.nsec);
+      offset += sizeof(this->duration.sec);
+      offset += sizeof(this->duration.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_joint_name;
       arrToVar(length_joint_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_joint_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_joint_name-1]=0;
-      this->joint_name = (char *)(inbuffer + offset-1);
+      this->joint_name = ros::StringView((const char *)(inbuffer + offset), length_joint_name, false);
       offset += length_joint_name;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->effort));
+      offset += deserializeFloat64(inbuffer + offset, &(this->effort));
       this->start_time.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->start_time.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
       this->start_time.sec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
@@ -110,7 +118,7 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     ApplyJointEffortResponse():
@@ -129,14 +137,22 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -151,11 +167,7 @@ static const char APPLYJOINTEFFORT[] = "gazebo_msgs/ApplyJointEffort";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
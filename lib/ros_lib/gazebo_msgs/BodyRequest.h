@@ -13,7 +13,7 @@ static const char BODYREQUEST[] = "gazebo_msgs/BodyRequest";
   class BodyRequestRequest : public ros::Msg
   {
     public:
-      typedef const char* _body_name_type;
+      typedef ros::StringView _body_name_type;
       _body_name_type body_name;
 
     BodyRequestRequest():
@@ -24,25 +24,28 @@ static const char BODYREQUEST[] = "gazebo_msgs/BodyRequest";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_body_name = strlen(this->body_name);
+      uint32_t length_body_name = this->body_name.size();
       varToArr(outbuffer + offset, length_body_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->body_name, length_body_name);
+      memcpy(outbuffer + offset, this->body_name.data(), length_body_name);
       offset += length_body_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->body_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_body_name;
       arrToVar(length_body_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_body_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_body_name-1]=0;
-      this->body_name = (char *)(inbuffer + offset-1);
+      this->body_name = ros::StringView((const char *)(inbuffer + offset), length_body_name, false);
       offset += length_body_name;
      return offset;
     }
@@ -66,6 +69,17 @@ static const char BODYREQUEST[] = "gazebo_msgs/BodyRequest";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
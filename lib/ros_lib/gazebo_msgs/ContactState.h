@@ -14,11 +14,11 @@ namespace gazebo_msgs
   class ContactState : public ros::Msg
   {
     public:
-      typedef const char* _info_type;
+      typedef ros::StringView _info_type;
       _info_type info;
-      typedef const char* _collision1_name_type;
+      typedef ros::StringView _collision1_name_type;
       _collision1_name_type collision1_name;
-      typedef const char* _collision2_name_type;
+      typedef ros::StringView _collision2_name_type;
       _collision2_name_type collision2_name;
       uint32_t wrenches_length;
       typedef geometry_msgs::Wrench _wrenches_type;
@@ -35,7 +35,7 @@ namespace gazebo_msgs
       _contact_normals_type st_contact_normals;
       _contact_normals_type * contact_normals;
       uint32_t depths_length;
-      typedef float _depths_type;
+      typedef ros::float64_t _depths_type;
       _depths_type st_depths;
       _depths_type * depths;
 
@@ -54,20 +54,20 @@ namespace gazebo_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_info = strlen(this->info);
+      uint32_t length_info = this->info.size();
       varToArr(outbuffer + offset, length_info);
       offset += 4;
-      memcpy(outbuffer + offset, this->info, length_info);
+      memcpy(outbuffer + offset, this->info.data(), length_info);
       offset += length_info;
-      uint32_t length_collision1_name = strlen(this->collision1_name);
+      uint32_t length_collision1_name = this->collision1_name.size();
       varToArr(outbuffer + offset, length_collision1_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->collision1_name, length_collision1_name);
+      memcpy(outbuffer + offset, this->collision1_name.data(), length_collision1_name);
       offset += length_collision1_name;
-      uint32_t length_collision2_name = strlen(this->collision2_name);
+      uint32_t length_collision2_name = this->collision2_name.size();
       varToArr(outbuffer + offset, length_collision2_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->collision2_name, length_collision2_name);
+      memcpy(outbuffer + offset, this->collision2_name.data(), length_collision2_name);
       offset += length_collision2_name;
       *(outbuffer + offset + 0) = (this->wrenches_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->wrenches_length >> (8 * 1)) & 0xFF;
@@ -100,40 +100,46 @@ namespace gazebo_msgs
       *(outbuffer + offset + 3) = (this->depths_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->depths_length);
       for( uint32_t i = 0; i < depths_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->depths[i]);
+      offset += serializeFloat64(outbuffer + offset, this->depths[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->info.size();
+      offset += 4 + this->collision1_name.size();
+      offset += 4 + this->collision2_name.size();
+      offset += sizeof(this->wrenches_length);
+      offset += wrenches_length * geometry_msgs::Wrench::maxSerializedLength();
+      offset += this->total_wrench.serializedLength();
+      offset += sizeof(this->contact_positions_length);
+      offset += contact_positions_length * geometry_msgs::Vector3::maxSerializedLength();
+      offset += sizeof(this->contact_normals_length);
+      offset += contact_normals_length * geometry_msgs::Vector3::maxSerializedLength();
+      offset += sizeof(this->depths_length);
+      offset += depths_length * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_info;
       arrToVar(length_info, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_info; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_info-1]=0;
-      this->info = (char *)(inbuffer + offset-1);
+      this->info = ros::StringView((const char *)(inbuffer + offset), length_info, false);
       offset += length_info;
       uint32_t length_collision1_name;
       arrToVar(length_collision1_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_collision1_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_collision1_name-1]=0;
-      this->collision1_name = (char *)(inbuffer + offset-1);
+      this->collision1_name = ros::StringView((const char *)(inbuffer + offset), length_collision1_name, false);
       offset += length_collision1_name;
       uint32_t length_collision2_name;
       arrToVar(length_collision2_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_collision2_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_collision2_name-1]=0;
-      this->collision2_name = (char *)(inbuffer + offset-1);
+      this->collision2_name = ros::StringView((const char *)(inbuffer + offset), length_collision2_name, false);
       offset += length_collision2_name;
       uint32_t wrenches_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       wrenches_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -178,11 +184,11 @@ namespace gazebo_msgs
       depths_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->depths_length);
       if(depths_lengthT > depths_length)
-        this->depths = (float*)realloc(this->depths, depths_lengthT * sizeof(float));
+        this->depths = (ros::float64_t*)realloc(this->depths, depths_lengthT * sizeof(ros::float64_t));
       depths_length = depths_lengthT;
       for( uint32_t i = 0; i < depths_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_depths));
-        memcpy( &(this->depths[i]), &(this->st_depths), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_depths));
+        memcpy( &(this->depths[i]), &(this->st_depths), sizeof(ros::float64_t));
       }
      return offset;
     }
@@ -20,10 +20,11 @@ namespace gazebo_msgs
       typedef gazebo_msgs::ContactState _states_type;
       _states_type st_states;
       _states_type * states;
+      uint32_t states_capacity;
 
     ContactsState():
       header(),
-      states_length(0), st_states(), states(nullptr)
+      states_length(0), st_states(), states(nullptr), states_capacity(0)
     {
     }
 
@@ -42,6 +43,17 @@ namespace gazebo_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->states_length);
+      for( uint32_t i = 0; i < states_length; i++){
+      offset += this->states[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -51,12 +63,10 @@ namespace gazebo_msgs
       states_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       states_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->states_length);
-      if(states_lengthT > states_length)
-        this->states = (gazebo_msgs::ContactState*)realloc(this->states, states_lengthT * sizeof(gazebo_msgs::ContactState));
+      this->states = ros::reserveMsgs(this->states, this->states_capacity, states_lengthT);
       states_length = states_lengthT;
       for( uint32_t i = 0; i < states_length; i++){
-      offset += this->st_states.deserialize(inbuffer + offset);
-        memcpy( &(this->states[i]), &(this->st_states), sizeof(gazebo_msgs::ContactState));
+      offset += this->states[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
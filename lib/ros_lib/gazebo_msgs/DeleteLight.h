@@ -13,7 +13,7 @@ static const char DELETELIGHT[] = "gazebo_msgs/DeleteLight";
   class DeleteLightRequest : public ros::Msg
   {
     public:
-      typedef const char* _light_name_type;
+      typedef ros::StringView _light_name_type;
       _light_name_type light_name;
 
     DeleteLightRequest():
@@ -24,25 +24,28 @@ static const char DELETELIGHT[] = "gazebo_msgs/DeleteLight";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_light_name = strlen(this->light_name);
+      uint32_t length_light_name = this->light_name.size();
       varToArr(outbuffer + offset, length_light_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->light_name, length_light_name);
+      memcpy(outbuffer + offset, this->light_name.data(), length_light_name);
       offset += length_light_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->light_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_light_name;
       arrToVar(length_light_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_light_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_light_name-1]=0;
-      this->light_name = (char *)(inbuffer + offset-1);
+      this->light_name = ros::StringView((const char *)(inbuffer + offset), length_light_name, false);
       offset += length_light_name;
      return offset;
     }
@@ -57,7 +60,7 @@ static const char DELETELIGHT[] = "gazebo_msgs/DeleteLight";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     DeleteLightResponse():
@@ -76,14 +79,22 @@ static const char DELETELIGHT[] = "gazebo_msgs/DeleteLight";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,11 +109,7 @@ static const char DELETELIGHT[] = "gazebo_msgs/DeleteLight";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
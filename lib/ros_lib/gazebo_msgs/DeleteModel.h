@@ -13,7 +13,7 @@ static const char DELETEMODEL[] = "gazebo_msgs/DeleteModel";
   class DeleteModelRequest : public ros::Msg
   {
     public:
-      typedef const char* _model_name_type;
+      typedef ros::StringView _model_name_type;
       _model_name_type model_name;
 
     DeleteModelRequest():
@@ -24,25 +24,28 @@ static const char DELETEMODEL[] = "gazebo_msgs/DeleteModel";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_model_name = strlen(this->model_name);
+      uint32_t length_model_name = this->model_name.size();
       varToArr(outbuffer + offset, length_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_name, length_model_name);
+      memcpy(outbuffer + offset, this->model_name.data(), length_model_name);
       offset += length_model_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->model_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_model_name;
       arrToVar(length_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_name-1]=0;
-      this->model_name = (char *)(inbuffer + offset-1);
+      this->model_name = ros::StringView((const char *)(inbuffer + offset), length_model_name, false);
       offset += length_model_name;
      return offset;
     }
@@ -57,7 +60,7 @@ static const char DELETEMODEL[] = "gazebo_msgs/DeleteModel";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     DeleteModelResponse():
@@ -76,14 +79,22 @@ static const char DELETEMODEL[] = "gazebo_msgs/DeleteModel";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,11 +109,7 @@ static const char DELETEMODEL[] = "gazebo_msgs/DeleteModel";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
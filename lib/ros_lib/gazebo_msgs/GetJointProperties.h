@@ -13,7 +13,7 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
   class GetJointPropertiesRequest : public ros::Msg
   {
     public:
-      typedef const char* _joint_name_type;
+      typedef ros::StringView _joint_name_type;
       _joint_name_type joint_name;
 
     GetJointPropertiesRequest():
@@ -24,25 +24,28 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_joint_name = strlen(this->joint_name);
+      uint32_t length_joint_name = this->joint_name.size();
       varToArr(outbuffer + offset, length_joint_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_name, length_joint_name);
+      memcpy(outbuffer + offset, this->joint_name.data(), length_joint_name);
       offset += length_joint_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->joint_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_joint_name;
       arrToVar(length_joint_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_joint_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_joint_name-1]=0;
-      this->joint_name = (char *)(inbuffer + offset-1);
+      this->joint_name = ros::StringView((const char *)(inbuffer + offset), length_joint_name, false);
       offset += length_joint_name;
      return offset;
     }
@@ -58,20 +61,20 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       typedef uint8_t _type_type;
       _type_type type;
       uint32_t damping_length;
-      typedef float _damping_type;
+      typedef ros::float64_t _damping_type;
       _damping_type st_damping;
       _damping_type * damping;
       uint32_t position_length;
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type st_position;
       _position_type * position;
       uint32_t rate_length;
-      typedef float _rate_type;
+      typedef ros::float64_t _rate_type;
       _rate_type st_rate;
       _rate_type * rate;
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
       enum { REVOLUTE =  0                 };
       enum { CONTINUOUS =  1                 };
@@ -101,7 +104,7 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       *(outbuffer + offset + 3) = (this->damping_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->damping_length);
       for( uint32_t i = 0; i < damping_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->damping[i]);
+      offset += serializeFloat64(outbuffer + offset, this->damping[i]);
       }
       *(outbuffer + offset + 0) = (this->position_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->position_length >> (8 * 1)) & 0xFF;
@@ -109,7 +112,7 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       *(outbuffer + offset + 3) = (this->position_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->position_length);
       for( uint32_t i = 0; i < position_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position[i]);
+      offset += serializeFloat64(outbuffer + offset, this->position[i]);
       }
       *(outbuffer + offset + 0) = (this->rate_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->rate_length >> (8 * 1)) & 0xFF;
@@ -117,7 +120,7 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       *(outbuffer + offset + 3) = (this->rate_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->rate_length);
       for( uint32_t i = 0; i < rate_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->rate[i]);
+      offset += serializeFloat64(outbuffer + offset, this->rate[i]);
       }
       union {
         bool real;
@@ -126,14 +129,29 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->type);
+      offset += sizeof(this->damping_length);
+      offset += damping_length * 8;
+      offset += sizeof(this->position_length);
+      offset += position_length * 8;
+      offset += sizeof(this->rate_length);
+      offset += rate_length * 8;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -145,11 +163,11 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       damping_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->damping_length);
       if(damping_lengthT > damping_length)
-        this->damping = (float*)realloc(this->damping, damping_lengthT * sizeof(float));
+        this->damping = (ros::float64_t*)realloc(this->damping, damping_lengthT * sizeof(ros::float64_t));
       damping_length = damping_lengthT;
       for( uint32_t i = 0; i < damping_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_damping));
-        memcpy( &(this->damping[i]), &(this->st_damping), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_damping));
+        memcpy( &(this->damping[i]), &(this->st_damping), sizeof(ros::float64_t));
       }
       uint32_t position_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -157,11 +175,11 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->position_length);
       if(position_lengthT > position_length)
-        this->position = (float*)realloc(this->position, position_lengthT * sizeof(float));
+        this->position = (ros::float64_t*)realloc(this->position, position_lengthT * sizeof(ros::float64_t));
       position_length = position_lengthT;
       for( uint32_t i = 0; i < position_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_position));
-        memcpy( &(this->position[i]), &(this->st_position), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_position));
+        memcpy( &(this->position[i]), &(this->st_position), sizeof(ros::float64_t));
       }
       uint32_t rate_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       rate_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -169,11 +187,11 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       rate_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->rate_length);
       if(rate_lengthT > rate_length)
-        this->rate = (float*)realloc(this->rate, rate_lengthT * sizeof(float));
+        this->rate = (ros::float64_t*)realloc(this->rate, rate_lengthT * sizeof(ros::float64_t));
       rate_length = rate_lengthT;
       for( uint32_t i = 0; i < rate_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_rate));
-        memcpy( &(this->rate[i]), &(this->st_rate), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_rate));
+        memcpy( &(this->rate[i]), &(this->st_rate), sizeof(ros::float64_t));
       }
       union {
         bool real;
@@ -186,11 +204,7 @@ static const char GETJOINTPROPERTIES[] = "gazebo_msgs/GetJointProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -14,9 +14,9 @@ static const char GETLINKSTATE[] = "gazebo_msgs/GetLinkState";
   class GetLinkStateRequest : public ros::Msg
   {
     public:
-      typedef const char* _link_name_type;
+      typedef ros::StringView _link_name_type;
       _link_name_type link_name;
-      typedef const char* _reference_frame_type;
+      typedef ros::StringView _reference_frame_type;
       _reference_frame_type reference_frame;
 
     GetLinkStateRequest():
@@ -28,39 +28,39 @@ static const char GETLINKSTATE[] = "gazebo_msgs/GetLinkState";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_link_name = strlen(this->link_name);
+      uint32_t length_link_name = this->link_name.size();
       varToArr(outbuffer + offset, length_link_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->link_name, length_link_name);
+      memcpy(outbuffer + offset, this->link_name.data(), length_link_name);
       offset += length_link_name;
-      uint32_t length_reference_frame = strlen(this->reference_frame);
+      uint32_t length_reference_frame = this->reference_frame.size();
       varToArr(outbuffer + offset, length_reference_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->reference_frame, length_reference_frame);
+      memcpy(outbuffer + offset, this->reference_frame.data(), length_reference_frame);
       offset += length_reference_frame;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->link_name.size();
+      offset += 4 + this->reference_frame.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_link_name;
       arrToVar(length_link_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_link_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_link_name-1]=0;
-      this->link_name = (char *)(inbuffer + offset-1);
+      this->link_name = ros::StringView((const char *)(inbuffer + offset), length_link_name, false);
       offset += length_link_name;
       uint32_t length_reference_frame;
       arrToVar(length_reference_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_reference_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_reference_frame-1]=0;
-      this->reference_frame = (char *)(inbuffer + offset-1);
+      this->reference_frame = ros::StringView((const char *)(inbuffer + offset), length_reference_frame, false);
       offset += length_reference_frame;
      return offset;
     }
@@ -77,7 +77,7 @@ static const char GETLINKSTATE[] = "gazebo_msgs/GetLinkState";
       _link_state_type link_state;
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     GetLinkStateResponse():
@@ -98,14 +98,23 @@ static const char GETLINKSTATE[] = "gazebo_msgs/GetLinkState";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->link_state.serializedLength();
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -121,11 +130,7 @@ static const char GETLINKSTATE[] = "gazebo_msgs/GetLinkState";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -13,7 +13,7 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
   class GetModelPropertiesRequest : public ros::Msg
   {
     public:
-      typedef const char* _model_name_type;
+      typedef ros::StringView _model_name_type;
       _model_name_type model_name;
 
     GetModelPropertiesRequest():
@@ -24,25 +24,28 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_model_name = strlen(this->model_name);
+      uint32_t length_model_name = this->model_name.size();
       varToArr(outbuffer + offset, length_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_name, length_model_name);
+      memcpy(outbuffer + offset, this->model_name.data(), length_model_name);
       offset += length_model_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->model_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_model_name;
       arrToVar(length_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_name-1]=0;
-      this->model_name = (char *)(inbuffer + offset-1);
+      this->model_name = ros::StringView((const char *)(inbuffer + offset), length_model_name, false);
       offset += length_model_name;
      return offset;
     }
@@ -55,31 +58,31 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
   class GetModelPropertiesResponse : public ros::Msg
   {
     public:
-      typedef const char* _parent_model_name_type;
+      typedef ros::StringView _parent_model_name_type;
       _parent_model_name_type parent_model_name;
-      typedef const char* _canonical_body_name_type;
+      typedef ros::StringView _canonical_body_name_type;
       _canonical_body_name_type canonical_body_name;
       uint32_t body_names_length;
-      typedef char* _body_names_type;
+      typedef ros::StringView _body_names_type;
       _body_names_type st_body_names;
       _body_names_type * body_names;
       uint32_t geom_names_length;
-      typedef char* _geom_names_type;
+      typedef ros::StringView _geom_names_type;
       _geom_names_type st_geom_names;
       _geom_names_type * geom_names;
       uint32_t joint_names_length;
-      typedef char* _joint_names_type;
+      typedef ros::StringView _joint_names_type;
       _joint_names_type st_joint_names;
       _joint_names_type * joint_names;
       uint32_t child_model_names_length;
-      typedef char* _child_model_names_type;
+      typedef ros::StringView _child_model_names_type;
       _child_model_names_type st_child_model_names;
       _child_model_names_type * child_model_names;
       typedef bool _is_static_type;
       _is_static_type is_static;
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     GetModelPropertiesResponse():
@@ -98,15 +101,15 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_parent_model_name = strlen(this->parent_model_name);
+      uint32_t length_parent_model_name = this->parent_model_name.size();
       varToArr(outbuffer + offset, length_parent_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->parent_model_name, length_parent_model_name);
+      memcpy(outbuffer + offset, this->parent_model_name.data(), length_parent_model_name);
       offset += length_parent_model_name;
-      uint32_t length_canonical_body_name = strlen(this->canonical_body_name);
+      uint32_t length_canonical_body_name = this->canonical_body_name.size();
       varToArr(outbuffer + offset, length_canonical_body_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->canonical_body_name, length_canonical_body_name);
+      memcpy(outbuffer + offset, this->canonical_body_name.data(), length_canonical_body_name);
       offset += length_canonical_body_name;
       *(outbuffer + offset + 0) = (this->body_names_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->body_names_length >> (8 * 1)) & 0xFF;
@@ -114,10 +117,10 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       *(outbuffer + offset + 3) = (this->body_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->body_names_length);
       for( uint32_t i = 0; i < body_names_length; i++){
-      uint32_t length_body_namesi = strlen(this->body_names[i]);
+      uint32_t length_body_namesi = this->body_names[i].size();
       varToArr(outbuffer + offset, length_body_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->body_names[i], length_body_namesi);
+      memcpy(outbuffer + offset, this->body_names[i].data(), length_body_namesi);
       offset += length_body_namesi;
       }
       *(outbuffer + offset + 0) = (this->geom_names_length >> (8 * 0)) & 0xFF;
@@ -126,10 +129,10 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       *(outbuffer + offset + 3) = (this->geom_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->geom_names_length);
       for( uint32_t i = 0; i < geom_names_length; i++){
-      uint32_t length_geom_namesi = strlen(this->geom_names[i]);
+      uint32_t length_geom_namesi = this->geom_names[i].size();
       varToArr(outbuffer + offset, length_geom_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->geom_names[i], length_geom_namesi);
+      memcpy(outbuffer + offset, this->geom_names[i].data(), length_geom_namesi);
       offset += length_geom_namesi;
       }
       *(outbuffer + offset + 0) = (this->joint_names_length >> (8 * 0)) & 0xFF;
@@ -138,10 +141,10 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       *(outbuffer + offset + 3) = (this->joint_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->joint_names_length);
       for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_joint_namesi = strlen(this->joint_names[i]);
+      uint32_t length_joint_namesi = this->joint_names[i].size();
       varToArr(outbuffer + offset, length_joint_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_names[i], length_joint_namesi);
+      memcpy(outbuffer + offset, this->joint_names[i].data(), length_joint_namesi);
       offset += length_joint_namesi;
       }
       *(outbuffer + offset + 0) = (this->child_model_names_length >> (8 * 0)) & 0xFF;
@@ -150,10 +153,10 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       *(outbuffer + offset + 3) = (this->child_model_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->child_model_names_length);
       for( uint32_t i = 0; i < child_model_names_length; i++){
-      uint32_t length_child_model_namesi = strlen(this->child_model_names[i]);
+      uint32_t length_child_model_namesi = this->child_model_names[i].size();
       varToArr(outbuffer + offset, length_child_model_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->child_model_names[i], length_child_model_namesi);
+      memcpy(outbuffer + offset, this->child_model_names[i].data(), length_child_model_namesi);
       offset += length_child_model_namesi;
       }
       union {
@@ -170,34 +173,53 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->parent_model_name.size();
+      offset += 4 + this->canonical_body_name.size();
+      offset += sizeof(this->body_names_length);
+      for( uint32_t i = 0; i < body_names_length; i++){
+      offset += 4 + this->body_names[i].size();
+      }
+      offset += sizeof(this->geom_names_length);
+      for( uint32_t i = 0; i < geom_names_length; i++){
+      offset += 4 + this->geom_names[i].size();
+      }
+      offset += sizeof(this->joint_names_length);
+      for( uint32_t i = 0; i < joint_names_length; i++){
+      offset += 4 + this->joint_names[i].size();
+      }
+      offset += sizeof(this->child_model_names_length);
+      for( uint32_t i = 0; i < child_model_names_length; i++){
+      offset += 4 + this->child_model_names[i].size();
+      }
+      offset += sizeof(this->is_static);
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_parent_model_name;
       arrToVar(length_parent_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_parent_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_parent_model_name-1]=0;
-      this->parent_model_name = (char *)(inbuffer + offset-1);
+      this->parent_model_name = ros::StringView((const char *)(inbuffer + offset), length_parent_model_name, false);
       offset += length_parent_model_name;
       uint32_t length_canonical_body_name;
       arrToVar(length_canonical_body_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_canonical_body_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_canonical_body_name-1]=0;
-      this->canonical_body_name = (char *)(inbuffer + offset-1);
+      this->canonical_body_name = ros::StringView((const char *)(inbuffer + offset), length_canonical_body_name, false);
       offset += length_canonical_body_name;
       uint32_t body_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       body_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -205,19 +227,15 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       body_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->body_names_length);
       if(body_names_lengthT > body_names_length)
-        this->body_names = (char**)realloc(this->body_names, body_names_lengthT * sizeof(char*));
+        this->body_names = (ros::StringView*)realloc(this->body_names, body_names_lengthT * sizeof(ros::StringView));
       body_names_length = body_names_lengthT;
       for( uint32_t i = 0; i < body_names_length; i++){
       uint32_t length_st_body_names;
       arrToVar(length_st_body_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_body_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_body_names-1]=0;
-      this->st_body_names = (char *)(inbuffer + offset-1);
+      this->st_body_names = ros::StringView((const char *)(inbuffer + offset), length_st_body_names, false);
       offset += length_st_body_names;
-        memcpy( &(this->body_names[i]), &(this->st_body_names), sizeof(char*));
+        memcpy( &(this->body_names[i]), &(this->st_body_names), sizeof(ros::StringView));
       }
       uint32_t geom_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       geom_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -225,19 +243,15 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       geom_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->geom_names_length);
       if(geom_names_lengthT > geom_names_length)
-        this->geom_names = (char**)realloc(this->geom_names, geom_names_lengthT * sizeof(char*));
+        this->geom_names = (ros::StringView*)realloc(this->geom_names, geom_names_lengthT * sizeof(ros::StringView));
       geom_names_length = geom_names_lengthT;
       for( uint32_t i = 0; i < geom_names_length; i++){
       uint32_t length_st_geom_names;
       arrToVar(length_st_geom_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_geom_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_geom_names-1]=0;
-      this->st_geom_names = (char *)(inbuffer + offset-1);
+      this->st_geom_names = ros::StringView((const char *)(inbuffer + offset), length_st_geom_names, false);
       offset += length_st_geom_names;
-        memcpy( &(this->geom_names[i]), &(this->st_geom_names), sizeof(char*));
+        memcpy( &(this->geom_names[i]), &(this->st_geom_names), sizeof(ros::StringView));
       }
       uint32_t joint_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -245,19 +259,15 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->joint_names_length);
       if(joint_names_lengthT > joint_names_length)
-        this->joint_names = (char**)realloc(this->joint_names, joint_names_lengthT * sizeof(char*));
+        this->joint_names = (ros::StringView*)realloc(this->joint_names, joint_names_lengthT * sizeof(ros::StringView));
       joint_names_length = joint_names_lengthT;
       for( uint32_t i = 0; i < joint_names_length; i++){
       uint32_t length_st_joint_names;
       arrToVar(length_st_joint_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_joint_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_joint_names-1]=0;
-      this->st_joint_names = (char *)(inbuffer + offset-1);
+      this->st_joint_names = ros::StringView((const char *)(inbuffer + offset), length_st_joint_names, false);
       offset += length_st_joint_names;
-        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(char*));
+        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(ros::StringView));
       }
       uint32_t child_model_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       child_model_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -265,19 +275,15 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       child_model_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->child_model_names_length);
       if(child_model_names_lengthT > child_model_names_length)
-        this->child_model_names = (char**)realloc(this->child_model_names, child_model_names_lengthT * sizeof(char*));
+        this->child_model_names = (ros::StringView*)realloc(this->child_model_names, child_model_names_lengthT * sizeof(ros::StringView));
       child_model_names_length = child_model_names_lengthT;
       for( uint32_t i = 0; i < child_model_names_length; i++){
       uint32_t length_st_child_model_names;
       arrToVar(length_st_child_model_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_child_model_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_child_model_names-1]=0;
-      this->st_child_model_names = (char *)(inbuffer + offset-1);
+      this->st_child_model_names = ros::StringView((const char *)(inbuffer + offset), length_st_child_model_names, false);
       offset += length_st_child_model_names;
-        memcpy( &(this->child_model_names[i]), &(this->st_child_model_names), sizeof(char*));
+        memcpy( &(this->child_model_names[i]), &(this->st_child_model_names), sizeof(ros::StringView));
       }
       union {
         bool real;
@@ -298,11 +304,7 @@ static const char GETMODELPROPERTIES[] = "gazebo_msgs/GetModelProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
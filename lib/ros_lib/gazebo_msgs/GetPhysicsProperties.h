@@ -26,6 +26,17 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -40,11 +51,11 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
   class GetPhysicsPropertiesResponse : public ros::Msg
   {
     public:
-      typedef float _time_step_type;
+      typedef ros::float64_t _time_step_type;
       _time_step_type time_step;
       typedef bool _pause_type;
       _pause_type pause;
-      typedef float _max_update_rate_type;
+      typedef ros::float64_t _max_update_rate_type;
       _max_update_rate_type max_update_rate;
       typedef geometry_msgs::Vector3 _gravity_type;
       _gravity_type gravity;
@@ -52,7 +63,7 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       _ode_config_type ode_config;
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     GetPhysicsPropertiesResponse():
@@ -69,7 +80,7 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->time_step);
+      offset += serializeFloat64(outbuffer + offset, this->time_step);
       union {
         bool real;
         uint8_t base;
@@ -77,7 +88,7 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       u_pause.real = this->pause;
       *(outbuffer + offset + 0) = (u_pause.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->pause);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_update_rate);
+      offset += serializeFloat64(outbuffer + offset, this->max_update_rate);
       offset += this->gravity.serialize(outbuffer + offset);
       offset += this->ode_config.serialize(outbuffer + offset);
       union {
@@ -87,18 +98,31 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 8;
+      offset += sizeof(this->pause);
+      offset += 8;
+      offset += this->gravity.serializedLength();
+      offset += this->ode_config.serializedLength();
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->time_step));
+      offset += deserializeFloat64(inbuffer + offset, &(this->time_step));
       union {
         bool real;
         uint8_t base;
@@ -107,7 +131,7 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       u_pause.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
       this->pause = u_pause.real;
       offset += sizeof(this->pause);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_update_rate));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_update_rate));
       offset += this->gravity.deserialize(inbuffer + offset);
       offset += this->ode_config.deserialize(inbuffer + offset);
       union {
@@ -121,11 +145,7 @@ static const char GETPHYSICSPROPERTIES[] = "gazebo_msgs/GetPhysicsProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
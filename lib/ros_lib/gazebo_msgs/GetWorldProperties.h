@@ -24,6 +24,17 @@ static const char GETWORLDPROPERTIES[] = "gazebo_msgs/GetWorldProperties";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -38,17 +49,17 @@ static const char GETWORLDPROPERTIES[] = "gazebo_msgs/GetWorldProperties";
   class GetWorldPropertiesResponse : public ros::Msg
   {
     public:
-      typedef float _sim_time_type;
+      typedef ros::float64_t _sim_time_type;
       _sim_time_type sim_time;
       uint32_t model_names_length;
-      typedef char* _model_names_type;
+      typedef ros::StringView _model_names_type;
       _model_names_type st_model_names;
       _model_names_type * model_names;
       typedef bool _rendering_enabled_type;
       _rendering_enabled_type rendering_enabled;
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     GetWorldPropertiesResponse():
@@ -63,17 +74,17 @@ static const char GETWORLDPROPERTIES[] = "gazebo_msgs/GetWorldProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->sim_time);
+      offset += serializeFloat64(outbuffer + offset, this->sim_time);
       *(outbuffer + offset + 0) = (this->model_names_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->model_names_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->model_names_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->model_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->model_names_length);
       for( uint32_t i = 0; i < model_names_length; i++){
-      uint32_t length_model_namesi = strlen(this->model_names[i]);
+      uint32_t length_model_namesi = this->model_names[i].size();
       varToArr(outbuffer + offset, length_model_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_names[i], length_model_namesi);
+      memcpy(outbuffer + offset, this->model_names[i].data(), length_model_namesi);
       offset += length_model_namesi;
       }
       union {
@@ -90,37 +101,47 @@ static const char GETWORLDPROPERTIES[] = "gazebo_msgs/GetWorldProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 8;
+      offset += sizeof(this->model_names_length);
+      for( uint32_t i = 0; i < model_names_length; i++){
+      offset += 4 + this->model_names[i].size();
+      }
+      offset += sizeof(this->rendering_enabled);
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->sim_time));
+      offset += deserializeFloat64(inbuffer + offset, &(this->sim_time));
       uint32_t model_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       model_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       model_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       model_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->model_names_length);
       if(model_names_lengthT > model_names_length)
-        this->model_names = (char**)realloc(this->model_names, model_names_lengthT * sizeof(char*));
+        this->model_names = (ros::StringView*)realloc(this->model_names, model_names_lengthT * sizeof(ros::StringView));
       model_names_length = model_names_lengthT;
       for( uint32_t i = 0; i < model_names_length; i++){
       uint32_t length_st_model_names;
       arrToVar(length_st_model_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_model_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_model_names-1]=0;
-      this->st_model_names = (char *)(inbuffer + offset-1);
+      this->st_model_names = ros::StringView((const char *)(inbuffer + offset), length_st_model_names, false);
       offset += length_st_model_names;
-        memcpy( &(this->model_names[i]), &(this->st_model_names), sizeof(char*));
+        memcpy( &(this->model_names[i]), &(this->st_model_names), sizeof(ros::StringView));
       }
       union {
         bool real;
@@ -141,11 +162,7 @@ static const char GETWORLDPROPERTIES[] = "gazebo_msgs/GetWorldProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
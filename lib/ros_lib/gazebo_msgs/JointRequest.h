@@ -13,7 +13,7 @@ static const char JOINTREQUEST[] = "gazebo_msgs/JointRequest";
   class JointRequestRequest : public ros::Msg
   {
     public:
-      typedef const char* _joint_name_type;
+      typedef ros::StringView _joint_name_type;
       _joint_name_type joint_name;
 
     JointRequestRequest():
@@ -24,25 +24,28 @@ static const char JOINTREQUEST[] = "gazebo_msgs/JointRequest";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_joint_name = strlen(this->joint_name);
+      uint32_t length_joint_name = this->joint_name.size();
       varToArr(outbuffer + offset, length_joint_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_name, length_joint_name);
+      memcpy(outbuffer + offset, this->joint_name.data(), length_joint_name);
       offset += length_joint_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->joint_name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_joint_name;
       arrToVar(length_joint_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_joint_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_joint_name-1]=0;
-      this->joint_name = (char *)(inbuffer + offset-1);
+      this->joint_name = ros::StringView((const char *)(inbuffer + offset), length_joint_name, false);
       offset += length_joint_name;
      return offset;
     }
@@ -66,6 +69,17 @@ static const char JOINTREQUEST[] = "gazebo_msgs/JointRequest";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -14,13 +14,13 @@ namespace gazebo_msgs
   class ModelState : public ros::Msg
   {
     public:
-      typedef const char* _model_name_type;
+      typedef ros::StringView _model_name_type;
       _model_name_type model_name;
       typedef geometry_msgs::Pose _pose_type;
       _pose_type pose;
       typedef geometry_msgs::Twist _twist_type;
       _twist_type twist;
-      typedef const char* _reference_frame_type;
+      typedef ros::StringView _reference_frame_type;
       _reference_frame_type reference_frame;
 
     ModelState():
@@ -34,43 +34,45 @@ namespace gazebo_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_model_name = strlen(this->model_name);
+      uint32_t length_model_name = this->model_name.size();
       varToArr(outbuffer + offset, length_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_name, length_model_name);
+      memcpy(outbuffer + offset, this->model_name.data(), length_model_name);
       offset += length_model_name;
       offset += this->pose.serialize(outbuffer + offset);
       offset += this->twist.serialize(outbuffer + offset);
-      uint32_t length_reference_frame = strlen(this->reference_frame);
+      uint32_t length_reference_frame = this->reference_frame.size();
       varToArr(outbuffer + offset, length_reference_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->reference_frame, length_reference_frame);
+      memcpy(outbuffer + offset, this->reference_frame.data(), length_reference_frame);
       offset += length_reference_frame;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->model_name.size();
+      offset += this->pose.serializedLength();
+      offset += this->twist.serializedLength();
+      offset += 4 + this->reference_frame.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_model_name;
       arrToVar(length_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_name-1]=0;
-      this->model_name = (char *)(inbuffer + offset-1);
+      this->model_name = ros::StringView((const char *)(inbuffer + offset), length_model_name, false);
       offset += length_model_name;
       offset += this->pose.deserialize(inbuffer + offset);
       offset += this->twist.deserialize(inbuffer + offset);
       uint32_t length_reference_frame;
       arrToVar(length_reference_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_reference_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_reference_frame-1]=0;
-      this->reference_frame = (char *)(inbuffer + offset-1);
+      this->reference_frame = ros::StringView((const char *)(inbuffer + offset), length_reference_frame, false);
       offset += length_reference_frame;
      return offset;
     }
@@ -18,17 +18,17 @@ namespace gazebo_msgs
       _sor_pgs_precon_iters_type sor_pgs_precon_iters;
       typedef uint32_t _sor_pgs_iters_type;
       _sor_pgs_iters_type sor_pgs_iters;
-      typedef float _sor_pgs_w_type;
+      typedef ros::float64_t _sor_pgs_w_type;
       _sor_pgs_w_type sor_pgs_w;
-      typedef float _sor_pgs_rms_error_tol_type;
+      typedef ros::float64_t _sor_pgs_rms_error_tol_type;
       _sor_pgs_rms_error_tol_type sor_pgs_rms_error_tol;
-      typedef float _contact_surface_layer_type;
+      typedef ros::float64_t _contact_surface_layer_type;
       _contact_surface_layer_type contact_surface_layer;
-      typedef float _contact_max_correcting_vel_type;
+      typedef ros::float64_t _contact_max_correcting_vel_type;
       _contact_max_correcting_vel_type contact_max_correcting_vel;
-      typedef float _cfm_type;
+      typedef ros::float64_t _cfm_type;
       _cfm_type cfm;
-      typedef float _erp_type;
+      typedef ros::float64_t _erp_type;
       _erp_type erp;
       typedef uint32_t _max_contacts_type;
       _max_contacts_type max_contacts;
@@ -67,12 +67,12 @@ namespace gazebo_msgs
       *(outbuffer + offset + 2) = (this->sor_pgs_iters >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->sor_pgs_iters >> (8 * 3)) & 0xFF;
       offset += sizeof(this->sor_pgs_iters);
-      offset += serializeAvrFloat64(outbuffer + offset, this->sor_pgs_w);
-      offset += serializeAvrFloat64(outbuffer + offset, this->sor_pgs_rms_error_tol);
-      offset += serializeAvrFloat64(outbuffer + offset, this->contact_surface_layer);
-      offset += serializeAvrFloat64(outbuffer + offset, this->contact_max_correcting_vel);
-      offset += serializeAvrFloat64(outbuffer + offset, this->cfm);
-      offset += serializeAvrFloat64(outbuffer + offset, this->erp);
+      offset += serializeFloat64(outbuffer + offset, this->sor_pgs_w);
+      offset += serializeFloat64(outbuffer + offset, this->sor_pgs_rms_error_tol);
+      offset += serializeFloat64(outbuffer + offset, this->contact_surface_layer);
+      offset += serializeFloat64(outbuffer + offset, this->contact_max_correcting_vel);
+      offset += serializeFloat64(outbuffer + offset, this->cfm);
+      offset += serializeFloat64(outbuffer + offset, this->erp);
       *(outbuffer + offset + 0) = (this->max_contacts >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->max_contacts >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->max_contacts >> (8 * 2)) & 0xFF;
@@ -81,6 +81,17 @@ namespace gazebo_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 61;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -102,12 +113,12 @@ namespace gazebo_msgs
       this->sor_pgs_iters |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
       this->sor_pgs_iters |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
       offset += sizeof(this->sor_pgs_iters);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->sor_pgs_w));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->sor_pgs_rms_error_tol));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->contact_surface_layer));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->contact_max_correcting_vel));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->cfm));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->erp));
+      offset += deserializeFloat64(inbuffer + offset, &(this->sor_pgs_w));
+      offset += deserializeFloat64(inbuffer + offset, &(this->sor_pgs_rms_error_tol));
+      offset += deserializeFloat64(inbuffer + offset, &(this->contact_surface_layer));
+      offset += deserializeFloat64(inbuffer + offset, &(this->contact_max_correcting_vel));
+      offset += deserializeFloat64(inbuffer + offset, &(this->cfm));
+      offset += deserializeFloat64(inbuffer + offset, &(this->erp));
       this->max_contacts =  ((uint32_t) (*(inbuffer + offset)));
       this->max_contacts |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
       this->max_contacts |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
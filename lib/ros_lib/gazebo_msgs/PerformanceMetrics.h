@@ -16,7 +16,7 @@ namespace gazebo_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef float _real_time_factor_type;
+      typedef ros::float64_t _real_time_factor_type;
       _real_time_factor_type real_time_factor;
       uint32_t sensors_length;
       typedef gazebo_msgs::SensorPerformanceMetric _sensors_type;
@@ -34,7 +34,7 @@ namespace gazebo_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->real_time_factor);
+      offset += serializeFloat64(outbuffer + offset, this->real_time_factor);
       *(outbuffer + offset + 0) = (this->sensors_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->sensors_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->sensors_length >> (8 * 2)) & 0xFF;
@@ -46,11 +46,23 @@ namespace gazebo_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 8;
+      offset += sizeof(this->sensors_length);
+      for( uint32_t i = 0; i < sensors_length; i++){
+      offset += this->sensors[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->real_time_factor));
+      offset += deserializeFloat64(inbuffer + offset, &(this->real_time_factor));
       uint32_t sensors_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       sensors_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       sensors_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
@@ -12,13 +12,13 @@ namespace gazebo_msgs
   class SensorPerformanceMetric : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef float _sim_update_rate_type;
+      typedef ros::float64_t _sim_update_rate_type;
       _sim_update_rate_type sim_update_rate;
-      typedef float _real_update_rate_type;
+      typedef ros::float64_t _real_update_rate_type;
       _real_update_rate_type real_update_rate;
-      typedef float _fps_type;
+      typedef ros::float64_t _fps_type;
       _fps_type fps;
 
     SensorPerformanceMetric():
@@ -32,14 +32,24 @@ namespace gazebo_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      offset += serializeAvrFloat64(outbuffer + offset, this->sim_update_rate);
-      offset += serializeAvrFloat64(outbuffer + offset, this->real_update_rate);
-      offset += serializeAvrFloat64(outbuffer + offset, this->fps);
+      offset += serializeFloat64(outbuffer + offset, this->sim_update_rate);
+      offset += serializeFloat64(outbuffer + offset, this->real_update_rate);
+      offset += serializeFloat64(outbuffer + offset, this->fps);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -49,15 +59,11 @@ namespace gazebo_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->sim_update_rate));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->real_update_rate));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->fps));
+      offset += deserializeFloat64(inbuffer + offset, &(this->sim_update_rate));
+      offset += deserializeFloat64(inbuffer + offset, &(this->real_update_rate));
+      offset += deserializeFloat64(inbuffer + offset, &(this->fps));
      return offset;
     }
 
@@ -14,7 +14,7 @@ static const char SETJOINTPROPERTIES[] = "gazebo_msgs/SetJointProperties";
   class SetJointPropertiesRequest : public ros::Msg
   {
     public:
-      typedef const char* _joint_name_type;
+      typedef ros::StringView _joint_name_type;
       _joint_name_type joint_name;
       typedef gazebo_msgs::ODEJointProperties _ode_joint_config_type;
       _ode_joint_config_type ode_joint_config;
@@ -28,26 +28,30 @@ static const char SETJOINTPROPERTIES[] = "gazebo_msgs/SetJointProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_joint_name = strlen(this->joint_name);
+      uint32_t length_joint_name = this->joint_name.size();
       varToArr(outbuffer + offset, length_joint_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_name, length_joint_name);
+      memcpy(outbuffer + offset, this->joint_name.data(), length_joint_name);
       offset += length_joint_name;
       offset += this->ode_joint_config.serialize(outbuffer + offset);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->joint_name.size();
+      offset += this->ode_joint_config.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_joint_name;
       arrToVar(length_joint_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_joint_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_joint_name-1]=0;
-      this->joint_name = (char *)(inbuffer + offset-1);
+      this->joint_name = ros::StringView((const char *)(inbuffer + offset), length_joint_name, false);
       offset += length_joint_name;
       offset += this->ode_joint_config.deserialize(inbuffer + offset);
      return offset;
@@ -63,7 +67,7 @@ static const char SETJOINTPROPERTIES[] = "gazebo_msgs/SetJointProperties";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SetJointPropertiesResponse():
@@ -82,14 +86,22 @@ static const char SETJOINTPROPERTIES[] = "gazebo_msgs/SetJointProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -104,11 +116,7 @@ static const char SETJOINTPROPERTIES[] = "gazebo_msgs/SetJointProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -16,7 +16,7 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
   class SetLightPropertiesRequest : public ros::Msg
   {
     public:
-      typedef const char* _light_name_type;
+      typedef ros::StringView _light_name_type;
       _light_name_type light_name;
       typedef bool _cast_shadows_type;
       _cast_shadows_type cast_shadows;
@@ -24,11 +24,11 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
       _diffuse_type diffuse;
       typedef std_msgs::ColorRGBA _specular_type;
       _specular_type specular;
-      typedef float _attenuation_constant_type;
+      typedef ros::float64_t _attenuation_constant_type;
       _attenuation_constant_type attenuation_constant;
-      typedef float _attenuation_linear_type;
+      typedef ros::float64_t _attenuation_linear_type;
       _attenuation_linear_type attenuation_linear;
-      typedef float _attenuation_quadratic_type;
+      typedef ros::float64_t _attenuation_quadratic_type;
       _attenuation_quadratic_type attenuation_quadratic;
       typedef geometry_msgs::Vector3 _direction_type;
       _direction_type direction;
@@ -51,10 +51,10 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_light_name = strlen(this->light_name);
+      uint32_t length_light_name = this->light_name.size();
       varToArr(outbuffer + offset, length_light_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->light_name, length_light_name);
+      memcpy(outbuffer + offset, this->light_name.data(), length_light_name);
       offset += length_light_name;
       union {
         bool real;
@@ -65,25 +65,36 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
       offset += sizeof(this->cast_shadows);
       offset += this->diffuse.serialize(outbuffer + offset);
       offset += this->specular.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->attenuation_constant);
-      offset += serializeAvrFloat64(outbuffer + offset, this->attenuation_linear);
-      offset += serializeAvrFloat64(outbuffer + offset, this->attenuation_quadratic);
+      offset += serializeFloat64(outbuffer + offset, this->attenuation_constant);
+      offset += serializeFloat64(outbuffer + offset, this->attenuation_linear);
+      offset += serializeFloat64(outbuffer + offset, this->attenuation_quadratic);
       offset += this->direction.serialize(outbuffer + offset);
       offset += this->pose.serialize(outbuffer + offset);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->light_name.size();
+      offset += sizeof(this->cast_shadows);
+      offset += this->diffuse.serializedLength();
+      offset += this->specular.serializedLength();
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += this->direction.serializedLength();
+      offset += this->pose.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_light_name;
       arrToVar(length_light_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_light_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_light_name-1]=0;
-      this->light_name = (char *)(inbuffer + offset-1);
+      this->light_name = ros::StringView((const char *)(inbuffer + offset), length_light_name, false);
       offset += length_light_name;
       union {
         bool real;
@@ -95,9 +106,9 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
       offset += sizeof(this->cast_shadows);
       offset += this->diffuse.deserialize(inbuffer + offset);
       offset += this->specular.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->attenuation_constant));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->attenuation_linear));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->attenuation_quadratic));
+      offset += deserializeFloat64(inbuffer + offset, &(this->attenuation_constant));
+      offset += deserializeFloat64(inbuffer + offset, &(this->attenuation_linear));
+      offset += deserializeFloat64(inbuffer + offset, &(this->attenuation_quadratic));
       offset += this->direction.deserialize(inbuffer + offset);
       offset += this->pose.deserialize(inbuffer + offset);
      return offset;
@@ -113,7 +124,7 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SetLightPropertiesResponse():
@@ -132,14 +143,22 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -154,11 +173,7 @@ static const char SETLIGHTPROPERTIES[] = "gazebo_msgs/SetLightProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -14,25 +14,25 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
   class SetLinkPropertiesRequest : public ros::Msg
   {
     public:
-      typedef const char* _link_name_type;
+      typedef ros::StringView _link_name_type;
       _link_name_type link_name;
       typedef geometry_msgs::Pose _com_type;
       _com_type com;
       typedef bool _gravity_mode_type;
       _gravity_mode_type gravity_mode;
-      typedef float _mass_type;
+      typedef ros::float64_t _mass_type;
       _mass_type mass;
-      typedef float _ixx_type;
+      typedef ros::float64_t _ixx_type;
       _ixx_type ixx;
-      typedef float _ixy_type;
+      typedef ros::float64_t _ixy_type;
       _ixy_type ixy;
-      typedef float _ixz_type;
+      typedef ros::float64_t _ixz_type;
       _ixz_type ixz;
-      typedef float _iyy_type;
+      typedef ros::float64_t _iyy_type;
       _iyy_type iyy;
-      typedef float _iyz_type;
+      typedef ros::float64_t _iyz_type;
       _iyz_type iyz;
-      typedef float _izz_type;
+      typedef ros::float64_t _izz_type;
       _izz_type izz;
 
     SetLinkPropertiesRequest():
@@ -52,10 +52,10 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_link_name = strlen(this->link_name);
+      uint32_t length_link_name = this->link_name.size();
       varToArr(outbuffer + offset, length_link_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->link_name, length_link_name);
+      memcpy(outbuffer + offset, this->link_name.data(), length_link_name);
       offset += length_link_name;
       offset += this->com.serialize(outbuffer + offset);
       union {
@@ -65,13 +65,29 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
       u_gravity_mode.real = this->gravity_mode;
       *(outbuffer + offset + 0) = (u_gravity_mode.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->gravity_mode);
-      offset += serializeAvrFloat64(outbuffer + offset, this->mass);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixx);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixy);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixz);
-      offset += serializeAvrFloat64(outbuffer + offset, this->iyy);
-      offset += serializeAvrFloat64(outbuffer + offset, this->iyz);
-      offset += serializeAvrFloat64(outbuffer + offset, this->izz);
+      offset += serializeFloat64(outbuffer + offset, this->mass);
+      offset += serializeFloat64(outbuffer + offset, this->ixx);
+      offset += serializeFloat64(outbuffer + offset, this->ixy);
+      offset += serializeFloat64(outbuffer + offset, this->ixz);
+      offset += serializeFloat64(outbuffer + offset, this->iyy);
+      offset += serializeFloat64(outbuffer + offset, this->iyz);
+      offset += serializeFloat64(outbuffer + offset, this->izz);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->link_name.size();
+      offset += this->com.serializedLength();
+      offset += sizeof(this->gravity_mode);
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -81,11 +97,7 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
       uint32_t length_link_name;
       arrToVar(length_link_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_link_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_link_name-1]=0;
-      this->link_name = (char *)(inbuffer + offset-1);
+      this->link_name = ros::StringView((const char *)(inbuffer + offset), length_link_name, false);
       offset += length_link_name;
       offset += this->com.deserialize(inbuffer + offset);
       union {
@@ -96,13 +108,13 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
       u_gravity_mode.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
       this->gravity_mode = u_gravity_mode.real;
       offset += sizeof(this->gravity_mode);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->mass));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixx));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixy));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixz));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->iyy));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->iyz));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->izz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->mass));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixx));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixy));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->iyy));
+      offset += deserializeFloat64(inbuffer + offset, &(this->iyz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->izz));
      return offset;
     }
 
@@ -116,7 +128,7 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SetLinkPropertiesResponse():
@@ -135,14 +147,22 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -157,11 +177,7 @@ static const char SETLINKPROPERTIES[] = "gazebo_msgs/SetLinkProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -13,16 +13,16 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
   class SetModelConfigurationRequest : public ros::Msg
   {
     public:
-      typedef const char* _model_name_type;
+      typedef ros::StringView _model_name_type;
       _model_name_type model_name;
-      typedef const char* _urdf_param_name_type;
+      typedef ros::StringView _urdf_param_name_type;
       _urdf_param_name_type urdf_param_name;
       uint32_t joint_names_length;
-      typedef char* _joint_names_type;
+      typedef ros::StringView _joint_names_type;
       _joint_names_type st_joint_names;
       _joint_names_type * joint_names;
       uint32_t joint_positions_length;
-      typedef float _joint_positions_type;
+      typedef ros::float64_t _joint_positions_type;
       _joint_positions_type st_joint_positions;
       _joint_positions_type * joint_positions;
 
@@ -37,15 +37,15 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_model_name = strlen(this->model_name);
+      uint32_t length_model_name = this->model_name.size();
       varToArr(outbuffer + offset, length_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_name, length_model_name);
+      memcpy(outbuffer + offset, this->model_name.data(), length_model_name);
       offset += length_model_name;
-      uint32_t length_urdf_param_name = strlen(this->urdf_param_name);
+      uint32_t length_urdf_param_name = this->urdf_param_name.size();
       varToArr(outbuffer + offset, length_urdf_param_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->urdf_param_name, length_urdf_param_name);
+      memcpy(outbuffer + offset, this->urdf_param_name.data(), length_urdf_param_name);
       offset += length_urdf_param_name;
       *(outbuffer + offset + 0) = (this->joint_names_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->joint_names_length >> (8 * 1)) & 0xFF;
@@ -53,10 +53,10 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       *(outbuffer + offset + 3) = (this->joint_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->joint_names_length);
       for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_joint_namesi = strlen(this->joint_names[i]);
+      uint32_t length_joint_namesi = this->joint_names[i].size();
       varToArr(outbuffer + offset, length_joint_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_names[i], length_joint_namesi);
+      memcpy(outbuffer + offset, this->joint_names[i].data(), length_joint_namesi);
       offset += length_joint_namesi;
       }
       *(outbuffer + offset + 0) = (this->joint_positions_length >> (8 * 0)) & 0xFF;
@@ -65,31 +65,37 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       *(outbuffer + offset + 3) = (this->joint_positions_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->joint_positions_length);
       for( uint32_t i = 0; i < joint_positions_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->joint_positions[i]);
+      offset += serializeFloat64(outbuffer + offset, this->joint_positions[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->model_name.size();
+      offset += 4 + this->urdf_param_name.size();
+      offset += sizeof(this->joint_names_length);
+      for( uint32_t i = 0; i < joint_names_length; i++){
+      offset += 4 + this->joint_names[i].size();
+      }
+      offset += sizeof(this->joint_positions_length);
+      offset += joint_positions_length * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_model_name;
       arrToVar(length_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_name-1]=0;
-      this->model_name = (char *)(inbuffer + offset-1);
+      this->model_name = ros::StringView((const char *)(inbuffer + offset), length_model_name, false);
       offset += length_model_name;
       uint32_t length_urdf_param_name;
       arrToVar(length_urdf_param_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_urdf_param_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_urdf_param_name-1]=0;
-      this->urdf_param_name = (char *)(inbuffer + offset-1);
+      this->urdf_param_name = ros::StringView((const char *)(inbuffer + offset), length_urdf_param_name, false);
       offset += length_urdf_param_name;
       uint32_t joint_names_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -97,19 +103,15 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->joint_names_length);
       if(joint_names_lengthT > joint_names_length)
-        this->joint_names = (char**)realloc(this->joint_names, joint_names_lengthT * sizeof(char*));
+        this->joint_names = (ros::StringView*)realloc(this->joint_names, joint_names_lengthT * sizeof(ros::StringView));
       joint_names_length = joint_names_lengthT;
       for( uint32_t i = 0; i < joint_names_length; i++){
       uint32_t length_st_joint_names;
       arrToVar(length_st_joint_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_joint_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_joint_names-1]=0;
-      this->st_joint_names = (char *)(inbuffer + offset-1);
+      this->st_joint_names = ros::StringView((const char *)(inbuffer + offset), length_st_joint_names, false);
       offset += length_st_joint_names;
-        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(char*));
+        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(ros::StringView));
       }
       uint32_t joint_positions_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       joint_positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -117,11 +119,11 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       joint_positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->joint_positions_length);
       if(joint_positions_lengthT > joint_positions_length)
-        this->joint_positions = (float*)realloc(this->joint_positions, joint_positions_lengthT * sizeof(float));
+        this->joint_positions = (ros::float64_t*)realloc(this->joint_positions, joint_positions_lengthT * sizeof(ros::float64_t));
       joint_positions_length = joint_positions_lengthT;
       for( uint32_t i = 0; i < joint_positions_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_joint_positions));
-        memcpy( &(this->joint_positions[i]), &(this->st_joint_positions), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_joint_positions));
+        memcpy( &(this->joint_positions[i]), &(this->st_joint_positions), sizeof(ros::float64_t));
       }
      return offset;
     }
@@ -136,7 +138,7 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SetModelConfigurationResponse():
@@ -155,14 +157,22 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -177,11 +187,7 @@ static const char SETMODELCONFIGURATION[] = "gazebo_msgs/SetModelConfiguration";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -15,9 +15,9 @@ static const char SETPHYSICSPROPERTIES[] = "gazebo_msgs/SetPhysicsProperties";
   class SetPhysicsPropertiesRequest : public ros::Msg
   {
     public:
-      typedef float _time_step_type;
+      typedef ros::float64_t _time_step_type;
       _time_step_type time_step;
-      typedef float _max_update_rate_type;
+      typedef ros::float64_t _max_update_rate_type;
       _max_update_rate_type max_update_rate;
       typedef geometry_msgs::Vector3 _gravity_type;
       _gravity_type gravity;
@@ -35,18 +35,29 @@ static const char SETPHYSICSPROPERTIES[] = "gazebo_msgs/SetPhysicsProperties";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->time_step);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_update_rate);
+      offset += serializeFloat64(outbuffer + offset, this->time_step);
+      offset += serializeFloat64(outbuffer + offset, this->max_update_rate);
       offset += this->gravity.serialize(outbuffer + offset);
       offset += this->ode_config.serialize(outbuffer + offset);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 101;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->time_step));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_update_rate));
+      offset += deserializeFloat64(inbuffer + offset, &(this->time_step));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_update_rate));
       offset += this->gravity.deserialize(inbuffer + offset);
       offset += this->ode_config.deserialize(inbuffer + offset);
      return offset;
@@ -62,7 +73,7 @@ static const char SETPHYSICSPROPERTIES[] = "gazebo_msgs/SetPhysicsProperties";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SetPhysicsPropertiesResponse():
@@ -81,14 +92,22 @@ static const char SETPHYSICSPROPERTIES[] = "gazebo_msgs/SetPhysicsProperties";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -103,11 +122,7 @@ static const char SETPHYSICSPROPERTIES[] = "gazebo_msgs/SetPhysicsProperties";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
@@ -14,15 +14,15 @@ static const char SPAWNMODEL[] = "gazebo_msgs/SpawnModel";
   class SpawnModelRequest : public ros::Msg
   {
     public:
-      typedef const char* _model_name_type;
+      typedef ros::StringView _model_name_type;
       _model_name_type model_name;
-      typedef const char* _model_xml_type;
+      typedef ros::StringView _model_xml_type;
       _model_xml_type model_xml;
-      typedef const char* _robot_namespace_type;
+      typedef ros::StringView _robot_namespace_type;
       _robot_namespace_type robot_namespace;
       typedef geometry_msgs::Pose _initial_pose_type;
       _initial_pose_type initial_pose;
-      typedef const char* _reference_frame_type;
+      typedef ros::StringView _reference_frame_type;
       _reference_frame_type reference_frame;
 
     SpawnModelRequest():
@@ -37,69 +37,64 @@ static const char SPAWNMODEL[] = "gazebo_msgs/SpawnModel";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_model_name = strlen(this->model_name);
+      uint32_t length_model_name = this->model_name.size();
       varToArr(outbuffer + offset, length_model_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_name, length_model_name);
+      memcpy(outbuffer + offset, this->model_name.data(), length_model_name);
       offset += length_model_name;
-      uint32_t length_model_xml = strlen(this->model_xml);
+      uint32_t length_model_xml = this->model_xml.size();
       varToArr(outbuffer + offset, length_model_xml);
       offset += 4;
-      memcpy(outbuffer + offset, this->model_xml, length_model_xml);
+      memcpy(outbuffer + offset, this->model_xml.data(), length_model_xml);
       offset += length_model_xml;
-      uint32_t length_robot_namespace = strlen(this->robot_namespace);
+      uint32_t length_robot_namespace = this->robot_namespace.size();
       varToArr(outbuffer + offset, length_robot_namespace);
       offset += 4;
-      memcpy(outbuffer + offset, this->robot_namespace, length_robot_namespace);
+      memcpy(outbuffer + offset, this->robot_namespace.data(), length_robot_namespace);
       offset += length_robot_namespace;
       offset += this->initial_pose.serialize(outbuffer + offset);
-      uint32_t length_reference_frame = strlen(this->reference_frame);
+      uint32_t length_reference_frame = this->reference_frame.size();
       varToArr(outbuffer + offset, length_reference_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->reference_frame, length_reference_frame);
+      memcpy(outbuffer + offset, this->reference_frame.data(), length_reference_frame);
       offset += length_reference_frame;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->model_name.size();
+      offset += 4 + this->model_xml.size();
+      offset += 4 + this->robot_namespace.size();
+      offset += this->initial_pose.serializedLength();
+      offset += 4 + this->reference_frame.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_model_name;
       arrToVar(length_model_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_name-1]=0;
-      this->model_name = (char *)(inbuffer + offset-1);
+      this->model_name = ros::StringView((const char *)(inbuffer + offset), length_model_name, false);
       offset += length_model_name;
       uint32_t length_model_xml;
       arrToVar(length_model_xml, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_model_xml; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_model_xml-1]=0;
-      this->model_xml = (char *)(inbuffer + offset-1);
+      this->model_xml = ros::StringView((const char *)(inbuffer + offset), length_model_xml, false);
       offset += length_model_xml;
       uint32_t length_robot_namespace;
       arrToVar(length_robot_namespace, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_robot_namespace; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_robot_namespace-1]=0;
-      this->robot_namespace = (char *)(inbuffer + offset-1);
+      this->robot_namespace = ros::StringView((const char *)(inbuffer + offset), length_robot_namespace, false);
       offset += length_robot_namespace;
       offset += this->initial_pose.deserialize(inbuffer + offset);
       uint32_t length_reference_frame;
       arrToVar(length_reference_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_reference_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_reference_frame-1]=0;
-      this->reference_frame = (char *)(inbuffer + offset-1);
+      this->reference_frame = ros::StringView((const char *)(inbuffer + offset), length_reference_frame, false);
       offset += length_reference_frame;
      return offset;
     }
@@ -114,7 +109,7 @@ static const char SPAWNMODEL[] = "gazebo_msgs/SpawnModel";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
 
     SpawnModelResponse():
@@ -133,14 +128,22 @@ static const char SPAWNMODEL[] = "gazebo_msgs/SpawnModel";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -155,11 +158,7 @@ static const char SPAWNMODEL[] = "gazebo_msgs/SpawnModel";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
      return offset;
     }
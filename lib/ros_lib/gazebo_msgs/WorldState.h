@@ -19,7 +19,7 @@ namespace gazebo_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t name_length;
-      typedef char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type st_name;
       _name_type * name;
       uint32_t pose_length;
@@ -54,10 +54,10 @@ namespace gazebo_msgs
       *(outbuffer + offset + 3) = (this->name_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->name_length);
       for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_namei = strlen(this->name[i]);
+      uint32_t length_namei = this->name[i].size();
       varToArr(outbuffer + offset, length_namei);
       offset += 4;
-      memcpy(outbuffer + offset, this->name[i], length_namei);
+      memcpy(outbuffer + offset, this->name[i].data(), length_namei);
       offset += length_namei;
       }
       *(outbuffer + offset + 0) = (this->pose_length >> (8 * 0)) & 0xFF;
@@ -87,6 +87,23 @@ namespace gazebo_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->name_length);
+      for( uint32_t i = 0; i < name_length; i++){
+      offset += 4 + this->name[i].size();
+      }
+      offset += sizeof(this->pose_length);
+      offset += pose_length * geometry_msgs::Pose::maxSerializedLength();
+      offset += sizeof(this->twist_length);
+      offset += twist_length * geometry_msgs::Twist::maxSerializedLength();
+      offset += sizeof(this->wrench_length);
+      offset += wrench_length * geometry_msgs::Wrench::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -97,19 +114,15 @@ namespace gazebo_msgs
       name_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->name_length);
       if(name_lengthT > name_length)
-        this->name = (char**)realloc(this->name, name_lengthT * sizeof(char*));
+        this->name = (ros::StringView*)realloc(this->name, name_lengthT * sizeof(ros::StringView));
       name_length = name_lengthT;
       for( uint32_t i = 0; i < name_length; i++){
       uint32_t length_st_name;
       arrToVar(length_st_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_name-1]=0;
-      this->st_name = (char *)(inbuffer + offset-1);
+      this->st_name = ros::StringView((const char *)(inbuffer + offset), length_st_name, false);
       offset += length_st_name;
-        memcpy( &(this->name[i]), &(this->st_name), sizeof(char*));
+        memcpy( &(this->name[i]), &(this->st_name), sizeof(ros::StringView));
       }
       uint32_t pose_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       pose_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
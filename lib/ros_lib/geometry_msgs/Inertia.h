@@ -13,21 +13,21 @@ namespace geometry_msgs
   class Inertia : public ros::Msg
   {
     public:
-      typedef float _m_type;
+      typedef ros::float64_t _m_type;
       _m_type m;
       typedef geometry_msgs::Vector3 _com_type;
       _com_type com;
-      typedef float _ixx_type;
+      typedef ros::float64_t _ixx_type;
       _ixx_type ixx;
-      typedef float _ixy_type;
+      typedef ros::float64_t _ixy_type;
       _ixy_type ixy;
-      typedef float _ixz_type;
+      typedef ros::float64_t _ixz_type;
       _ixz_type ixz;
-      typedef float _iyy_type;
+      typedef ros::float64_t _iyy_type;
       _iyy_type iyy;
-      typedef float _iyz_type;
+      typedef ros::float64_t _iyz_type;
       _iyz_type iyz;
-      typedef float _izz_type;
+      typedef ros::float64_t _izz_type;
       _izz_type izz;
 
     Inertia():
@@ -45,28 +45,39 @@ namespace geometry_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->m);
+      offset += serializeFloat64(outbuffer + offset, this->m);
       offset += this->com.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixx);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixy);
-      offset += serializeAvrFloat64(outbuffer + offset, this->ixz);
-      offset += serializeAvrFloat64(outbuffer + offset, this->iyy);
-      offset += serializeAvrFloat64(outbuffer + offset, this->iyz);
-      offset += serializeAvrFloat64(outbuffer + offset, this->izz);
+      offset += serializeFloat64(outbuffer + offset, this->ixx);
+      offset += serializeFloat64(outbuffer + offset, this->ixy);
+      offset += serializeFloat64(outbuffer + offset, this->ixz);
+      offset += serializeFloat64(outbuffer + offset, this->iyy);
+      offset += serializeFloat64(outbuffer + offset, this->iyz);
+      offset += serializeFloat64(outbuffer + offset, this->izz);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 80;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->m));
+      offset += deserializeFloat64(inbuffer + offset, &(this->m));
       offset += this->com.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixx));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixy));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->ixz));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->iyy));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->iyz));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->izz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixx));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixy));
+      offset += deserializeFloat64(inbuffer + offset, &(this->ixz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->iyy));
+      offset += deserializeFloat64(inbuffer + offset, &(this->iyz));
+      offset += deserializeFloat64(inbuffer + offset, &(this->izz));
      return offset;
     }
 
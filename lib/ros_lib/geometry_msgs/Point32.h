@@ -62,6 +62,17 @@ namespace geometry_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 12;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -0,0 +1,53 @@
+#ifndef _ROS_geometry_msgs_PolygonBounded_h
+#define _ROS_geometry_msgs_PolygonBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "geometry_msgs/Point32.h"
+
+namespace geometry_msgs
+{
+
+  /* geometry_msgs/Polygon with inline storage for up to POINTS points */
+  template<uint32_t POINTS>
+  class PolygonBounded : public ros::BoundedMsg
+  {
+    public:
+      uint32_t points_length;
+      geometry_msgs::Point32 points[POINTS];
+
+    PolygonBounded():
+      points_length(0), points()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += serializeBoundedMsgs(outbuffer + offset, this->points, points_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += serializedLengthMsgs(this->points, points_length);
+      return offset;
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += deserializeBoundedMsgs(inbuffer + offset, this->points, POINTS, points_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "geometry_msgs/Polygon"; };
+    virtual const char * getMD5() override { return "cd60a26494a087f577976f0329fa120e"; };
+
+  };
+
+}
+#endif
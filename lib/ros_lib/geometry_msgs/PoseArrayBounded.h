@@ -0,0 +1,59 @@
+#ifndef _ROS_geometry_msgs_PoseArrayBounded_h
+#define _ROS_geometry_msgs_PoseArrayBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "std_msgs/Header.h"
+#include "geometry_msgs/Pose.h"
+
+namespace geometry_msgs
+{
+
+  /* geometry_msgs/PoseArray with inline storage for up to POSES poses */
+  template<uint32_t POSES>
+  class PoseArrayBounded : public ros::BoundedMsg
+  {
+    public:
+      std_msgs::Header header;
+      uint32_t poses_length;
+      geometry_msgs::Pose poses[POSES];
+
+    PoseArrayBounded():
+      header(),
+      poses_length(0), poses()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      offset += serializeBoundedMsgs(outbuffer + offset, this->poses, poses_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += serializedLengthMsgs(this->poses, poses_length);
+      return offset;
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += this->header.deserialize(inbuffer + offset);
+      offset += deserializeBoundedMsgs(inbuffer + offset, this->poses, POSES, poses_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "geometry_msgs/PoseArray"; };
+    virtual const char * getMD5() override { return "916c28c5764443f268b296bb671b9d97"; };
+
+  };
+
+}
+#endif
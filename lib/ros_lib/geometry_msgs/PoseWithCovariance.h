@@ -15,7 +15,7 @@ namespace geometry_msgs
     public:
       typedef geometry_msgs::Pose _pose_type;
       _pose_type pose;
-      float covariance[36];
+      ros::float64_t covariance[36];
 
     PoseWithCovariance():
       pose(),
@@ -28,17 +28,28 @@ namespace geometry_msgs
       int offset = 0;
       offset += this->pose.serialize(outbuffer + offset);
       for( uint32_t i = 0; i < 36; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->covariance[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 344;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->pose.deserialize(inbuffer + offset);
       for( uint32_t i = 0; i < 36; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->covariance[i]));
       }
      return offset;
     }
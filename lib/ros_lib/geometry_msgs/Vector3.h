@@ -12,11 +12,11 @@ namespace geometry_msgs
   class Vector3 : public ros::Msg
   {
     public:
-      typedef float _x_type;
+      typedef ros::float64_t _x_type;
       _x_type x;
-      typedef float _y_type;
+      typedef ros::float64_t _y_type;
       _y_type y;
-      typedef float _z_type;
+      typedef ros::float64_t _z_type;
       _z_type z;
 
     Vector3():
@@ -29,18 +29,29 @@ namespace geometry_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->y);
-      offset += serializeAvrFloat64(outbuffer + offset, this->z);
+      offset += serializeFloat64(outbuffer + offset, this->x);
+      offset += serializeFloat64(outbuffer + offset, this->y);
+      offset += serializeFloat64(outbuffer + offset, this->z);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 24;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->y));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->z));
      return offset;
     }
 
@@ -37,6 +37,14 @@ namespace hector_mapping
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->iterData_length);
+      offset += iterData_length * hector_mapping::HectorIterData::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -12,14 +12,14 @@ namespace hector_mapping
   class HectorIterData : public ros::Msg
   {
     public:
-      float hessian[9];
-      typedef float _conditionNum_type;
+      ros::float64_t hessian[9];
+      typedef ros::float64_t _conditionNum_type;
       _conditionNum_type conditionNum;
-      typedef float _determinant_type;
+      typedef ros::float64_t _determinant_type;
       _determinant_type determinant;
-      typedef float _conditionNum2d_type;
+      typedef ros::float64_t _conditionNum2d_type;
       _conditionNum2d_type conditionNum2d;
-      typedef float _determinant2d_type;
+      typedef ros::float64_t _determinant2d_type;
       _determinant2d_type determinant2d;
 
     HectorIterData():
@@ -35,25 +35,36 @@ namespace hector_mapping
     {
       int offset = 0;
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->hessian[i]);
+      offset += serializeFloat64(outbuffer + offset, this->hessian[i]);
       }
-      offset += serializeAvrFloat64(outbuffer + offset, this->conditionNum);
-      offset += serializeAvrFloat64(outbuffer + offset, this->determinant);
-      offset += serializeAvrFloat64(outbuffer + offset, this->conditionNum2d);
-      offset += serializeAvrFloat64(outbuffer + offset, this->determinant2d);
+      offset += serializeFloat64(outbuffer + offset, this->conditionNum);
+      offset += serializeFloat64(outbuffer + offset, this->determinant);
+      offset += serializeFloat64(outbuffer + offset, this->conditionNum2d);
+      offset += serializeFloat64(outbuffer + offset, this->determinant2d);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 104;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->hessian[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->hessian[i]));
       }
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->conditionNum));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->determinant));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->conditionNum2d));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->determinant2d));
+      offset += deserializeFloat64(inbuffer + offset, &(this->conditionNum));
+      offset += deserializeFloat64(inbuffer + offset, &(this->determinant));
+      offset += deserializeFloat64(inbuffer + offset, &(this->conditionNum2d));
+      offset += deserializeFloat64(inbuffer + offset, &(this->determinant2d));
      return offset;
     }
 
@@ -29,6 +29,13 @@ static const char GETDISTANCETOOBSTACLE[] = "hector_nav_msgs/GetDistanceToObstac
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->point.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -72,6 +79,14 @@ static const char GETDISTANCETOOBSTACLE[] = "hector_nav_msgs/GetDistanceToObstac
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->distance);
+      offset += this->end_point.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -30,6 +30,13 @@ static const char GETNORMAL[] = "hector_nav_msgs/GetNormal";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->point.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -60,6 +67,17 @@ static const char GETNORMAL[] = "hector_nav_msgs/GetNormal";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 24;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -18,7 +18,7 @@ static const char GETRECOVERYINFO[] = "hector_nav_msgs/GetRecoveryInfo";
     public:
       typedef ros::Time _request_time_type;
       _request_time_type request_time;
-      typedef float _request_radius_type;
+      typedef ros::float64_t _request_radius_type;
       _request_radius_type request_radius;
 
     GetRecoveryInfoRequest():
@@ -40,10 +40,21 @@ static const char GETRECOVERYINFO[] = "hector_nav_msgs/GetRecoveryInfo";
       *(outbuffer + offset + 2) = (this->request_time.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->request_time.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->request_time.nsec);
-      offset += serializeAvrFloat64(outbuffer + offset, this->request_radius);
+      offset += serializeFloat64(outbuffer + offset, this->request_radius);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 16;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -57,7 +68,7 @@ static const char GETRECOVERYINFO[] = "hector_nav_msgs/GetRecoveryInfo";
       this->request_time.nsec |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
       this->request_time.nsec |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
       offset += sizeof(this->request_time.nsec);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->request_radius));
+      offset += deserializeFloat64(inbuffer + offset, &(this->request_radius));
      return offset;
     }
 
@@ -92,6 +103,15 @@ static const char GETRECOVERYINFO[] = "hector_nav_msgs/GetRecoveryInfo";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->trajectory_radius_entry_pose_to_req_pose.serializedLength();
+      offset += this->radius_entry_pose.serializedLength();
+      offset += this->req_pose.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -25,6 +25,17 @@ static const char GETROBOTTRAJECTORY[] = "hector_nav_msgs/GetRobotTrajectory";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -54,6 +65,13 @@ static const char GETROBOTTRAJECTORY[] = "hector_nav_msgs/GetRobotTrajectory";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->trajectory.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
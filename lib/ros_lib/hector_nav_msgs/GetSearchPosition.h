@@ -42,6 +42,14 @@ static const char GETSEARCHPOSITION[] = "hector_nav_msgs/GetSearchPosition";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->ooi_pose.serializedLength();
+      offset += sizeof(this->distance);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -83,6 +91,13 @@ static const char GETSEARCHPOSITION[] = "hector_nav_msgs/GetSearchPosition";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->search_pose.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -14,13 +14,13 @@ static const char GETMAPROI[] = "map_msgs/GetMapROI";
   class GetMapROIRequest : public ros::Msg
   {
     public:
-      typedef float _x_type;
+      typedef ros::float64_t _x_type;
       _x_type x;
-      typedef float _y_type;
+      typedef ros::float64_t _y_type;
       _y_type y;
-      typedef float _l_x_type;
+      typedef ros::float64_t _l_x_type;
       _l_x_type l_x;
-      typedef float _l_y_type;
+      typedef ros::float64_t _l_y_type;
       _l_y_type l_y;
 
     GetMapROIRequest():
@@ -34,20 +34,31 @@ static const char GETMAPROI[] = "map_msgs/GetMapROI";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->y);
-      offset += serializeAvrFloat64(outbuffer + offset, this->l_x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->l_y);
+      offset += serializeFloat64(outbuffer + offset, this->x);
+      offset += serializeFloat64(outbuffer + offset, this->y);
+      offset += serializeFloat64(outbuffer + offset, this->l_x);
+      offset += serializeFloat64(outbuffer + offset, this->l_y);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 32;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->y));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->l_x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->l_y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->l_x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->l_y));
      return offset;
     }
 
@@ -74,6 +85,13 @@ static const char GETMAPROI[] = "map_msgs/GetMapROI";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->sub_map.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
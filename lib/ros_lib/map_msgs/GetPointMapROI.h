@@ -14,19 +14,19 @@ static const char GETPOINTMAPROI[] = "map_msgs/GetPointMapROI";
   class GetPointMapROIRequest : public ros::Msg
   {
     public:
-      typedef float _x_type;
+      typedef ros::float64_t _x_type;
       _x_type x;
-      typedef float _y_type;
+      typedef ros::float64_t _y_type;
       _y_type y;
-      typedef float _z_type;
+      typedef ros::float64_t _z_type;
       _z_type z;
-      typedef float _r_type;
+      typedef ros::float64_t _r_type;
       _r_type r;
-      typedef float _l_x_type;
+      typedef ros::float64_t _l_x_type;
       _l_x_type l_x;
-      typedef float _l_y_type;
+      typedef ros::float64_t _l_y_type;
       _l_y_type l_y;
-      typedef float _l_z_type;
+      typedef ros::float64_t _l_z_type;
       _l_z_type l_z;
 
     GetPointMapROIRequest():
@@ -43,26 +43,37 @@ static const char GETPOINTMAPROI[] = "map_msgs/GetPointMapROI";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->y);
-      offset += serializeAvrFloat64(outbuffer + offset, this->z);
-      offset += serializeAvrFloat64(outbuffer + offset, this->r);
-      offset += serializeAvrFloat64(outbuffer + offset, this->l_x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->l_y);
-      offset += serializeAvrFloat64(outbuffer + offset, this->l_z);
+      offset += serializeFloat64(outbuffer + offset, this->x);
+      offset += serializeFloat64(outbuffer + offset, this->y);
+      offset += serializeFloat64(outbuffer + offset, this->z);
+      offset += serializeFloat64(outbuffer + offset, this->r);
+      offset += serializeFloat64(outbuffer + offset, this->l_x);
+      offset += serializeFloat64(outbuffer + offset, this->l_y);
+      offset += serializeFloat64(outbuffer + offset, this->l_z);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 56;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->y));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->z));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->r));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->l_x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->l_y));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->l_z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->r));
+      offset += deserializeFloat64(inbuffer + offset, &(this->l_x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->l_y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->l_z));
      return offset;
     }
 
@@ -89,6 +100,13 @@ static const char GETPOINTMAPROI[] = "map_msgs/GetPointMapROI";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->sub_map.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -77,15 +77,20 @@ namespace map_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->x);
+      offset += sizeof(this->y);
+      offset += sizeof(this->width);
+      offset += sizeof(this->height);
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -133,17 +138,7 @@ namespace map_msgs
       if(data_lengthT > data_length)
         this->data = (int8_t*)realloc(this->data, data_lengthT * sizeof(int8_t));
       data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int8_t real;
-        uint8_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint8_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(int8_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->data, data_length);
      return offset;
     }
 
@@ -15,9 +15,9 @@ namespace map_msgs
     public:
       typedef nav_msgs::OccupancyGrid _map_type;
       _map_type map;
-      typedef float _min_z_type;
+      typedef ros::float64_t _min_z_type;
       _min_z_type min_z;
-      typedef float _max_z_type;
+      typedef ros::float64_t _max_z_type;
       _max_z_type max_z;
 
     ProjectedMap():
@@ -31,8 +31,17 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->map.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->min_z);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_z);
+      offset += serializeFloat64(outbuffer + offset, this->min_z);
+      offset += serializeFloat64(outbuffer + offset, this->max_z);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->map.serializedLength();
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -40,8 +49,8 @@ namespace map_msgs
     {
       int offset = 0;
       offset += this->map.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->min_z));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->min_z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_z));
      return offset;
     }
 
@@ -12,19 +12,19 @@ namespace map_msgs
   class ProjectedMapInfo : public ros::Msg
   {
     public:
-      typedef const char* _frame_id_type;
+      typedef ros::StringView _frame_id_type;
       _frame_id_type frame_id;
-      typedef float _x_type;
+      typedef ros::float64_t _x_type;
       _x_type x;
-      typedef float _y_type;
+      typedef ros::float64_t _y_type;
       _y_type y;
-      typedef float _width_type;
+      typedef ros::float64_t _width_type;
       _width_type width;
-      typedef float _height_type;
+      typedef ros::float64_t _height_type;
       _height_type height;
-      typedef float _min_z_type;
+      typedef ros::float64_t _min_z_type;
       _min_z_type min_z;
-      typedef float _max_z_type;
+      typedef ros::float64_t _max_z_type;
       _max_z_type max_z;
 
     ProjectedMapInfo():
@@ -41,17 +41,30 @@ namespace map_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_frame_id = strlen(this->frame_id);
+      uint32_t length_frame_id = this->frame_id.size();
       varToArr(outbuffer + offset, length_frame_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->frame_id, length_frame_id);
+      memcpy(outbuffer + offset, this->frame_id.data(), length_frame_id);
       offset += length_frame_id;
-      offset += serializeAvrFloat64(outbuffer + offset, this->x);
-      offset += serializeAvrFloat64(outbuffer + offset, this->y);
-      offset += serializeAvrFloat64(outbuffer + offset, this->width);
-      offset += serializeAvrFloat64(outbuffer + offset, this->height);
-      offset += serializeAvrFloat64(outbuffer + offset, this->min_z);
-      offset += serializeAvrFloat64(outbuffer + offset, this->max_z);
+      offset += serializeFloat64(outbuffer + offset, this->x);
+      offset += serializeFloat64(outbuffer + offset, this->y);
+      offset += serializeFloat64(outbuffer + offset, this->width);
+      offset += serializeFloat64(outbuffer + offset, this->height);
+      offset += serializeFloat64(outbuffer + offset, this->min_z);
+      offset += serializeFloat64(outbuffer + offset, this->max_z);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->frame_id.size();
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -61,18 +74,14 @@ namespace map_msgs
       uint32_t length_frame_id;
       arrToVar(length_frame_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_frame_id-1]=0;
-      this->frame_id = (char *)(inbuffer + offset-1);
+      this->frame_id = ros::StringView((const char *)(inbuffer + offset), length_frame_id, false);
       offset += length_frame_id;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->x));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->y));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->width));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->height));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->min_z));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->max_z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->x));
+      offset += deserializeFloat64(inbuffer + offset, &(this->y));
+      offset += deserializeFloat64(inbuffer + offset, &(this->width));
+      offset += deserializeFloat64(inbuffer + offset, &(this->height));
+      offset += deserializeFloat64(inbuffer + offset, &(this->min_z));
+      offset += deserializeFloat64(inbuffer + offset, &(this->max_z));
      return offset;
     }
 
@@ -68,6 +68,17 @@ namespace nav_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->cell_width);
+      offset += sizeof(this->cell_height);
+      offset += sizeof(this->cells_length);
+      offset += cells_length * geometry_msgs::Point::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -14,7 +14,7 @@ static const char LOADMAP[] = "nav_msgs/LoadMap";
   class LoadMapRequest : public ros::Msg
   {
     public:
-      typedef const char* _map_url_type;
+      typedef ros::StringView _map_url_type;
       _map_url_type map_url;
 
     LoadMapRequest():
@@ -25,25 +25,28 @@ static const char LOADMAP[] = "nav_msgs/LoadMap";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_map_url = strlen(this->map_url);
+      uint32_t length_map_url = this->map_url.size();
       varToArr(outbuffer + offset, length_map_url);
       offset += 4;
-      memcpy(outbuffer + offset, this->map_url, length_map_url);
+      memcpy(outbuffer + offset, this->map_url.data(), length_map_url);
       offset += length_map_url;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->map_url.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_map_url;
       arrToVar(length_map_url, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_map_url; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_map_url-1]=0;
-      this->map_url = (char *)(inbuffer + offset-1);
+      this->map_url = ros::StringView((const char *)(inbuffer + offset), length_map_url, false);
       offset += length_map_url;
      return offset;
     }
@@ -81,6 +84,14 @@ static const char LOADMAP[] = "nav_msgs/LoadMap";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->map.serializedLength();
+      offset += sizeof(this->result);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
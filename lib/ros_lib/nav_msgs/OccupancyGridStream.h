@@ -0,0 +1,46 @@
+#ifndef _ROS_nav_msgs_OccupancyGridStream_h
+#define _ROS_nav_msgs_OccupancyGridStream_h
+
+#include "ros/subscriber.h"
+#include "nav_msgs/OccupancyGrid.h"
+
+namespace nav_msgs
+{
+
+  /*
+   * Streaming subscriber for nav_msgs/OccupancyGrid of any size. Derive
+   * from it and override onValue(); DATA reports each cell with its index.
+   * INFO_ORIGIN_POSITION (x, y, z) and INFO_ORIGIN_ORIENTATION (x, y, z, w)
+   * report float64 values with their index.
+   */
+  class OccupancyGridStream : public ros::StreamSubscriber<nav_msgs::OccupancyGrid>
+  {
+    public:
+      enum
+      {
+        HEADER_SEQ, HEADER_STAMP_SEC, HEADER_STAMP_NSEC, HEADER_FRAME_ID,
+        INFO_MAP_LOAD_TIME_SEC, INFO_MAP_LOAD_TIME_NSEC, INFO_RESOLUTION, INFO_WIDTH, INFO_HEIGHT,
+        INFO_ORIGIN_POSITION, INFO_ORIGIN_ORIENTATION, DATA,
+        FIELDS
+      };
+
+    OccupancyGridStream(const char * topic_name) :
+      ros::StreamSubscriber<nav_msgs::OccupancyGrid>(topic_name, layout(), FIELDS)
+    {
+    }
+
+    static const ros::StreamField * layout()
+    {
+      static const ros::StreamField fields[FIELDS] =
+      {
+        {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_STRING, 1, 0},
+        {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1},
+        {ros::STREAM_VALUE, 8, 3}, {ros::STREAM_VALUE, 8, 4}, {ros::STREAM_ARRAY, 1, 0}
+      };
+      return fields;
+    }
+
+  };
+
+}
+#endif
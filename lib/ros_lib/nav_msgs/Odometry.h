@@ -17,7 +17,7 @@ namespace nav_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _child_frame_id_type;
+      typedef ros::StringView _child_frame_id_type;
       _child_frame_id_type child_frame_id;
       typedef geometry_msgs::PoseWithCovariance _pose_type;
       _pose_type pose;
@@ -36,16 +36,26 @@ namespace nav_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_child_frame_id = strlen(this->child_frame_id);
+      uint32_t length_child_frame_id = this->child_frame_id.size();
       varToArr(outbuffer + offset, length_child_frame_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->child_frame_id, length_child_frame_id);
+      memcpy(outbuffer + offset, this->child_frame_id.data(), length_child_frame_id);
       offset += length_child_frame_id;
       offset += this->pose.serialize(outbuffer + offset);
       offset += this->twist.serialize(outbuffer + offset);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->child_frame_id.size();
+      offset += this->pose.serializedLength();
+      offset += this->twist.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -53,11 +63,7 @@ namespace nav_msgs
       uint32_t length_child_frame_id;
       arrToVar(length_child_frame_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_child_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_child_frame_id-1]=0;
-      this->child_frame_id = (char *)(inbuffer + offset-1);
+      this->child_frame_id = ros::StringView((const char *)(inbuffer + offset), length_child_frame_id, false);
       offset += length_child_frame_id;
       offset += this->pose.deserialize(inbuffer + offset);
       offset += this->twist.deserialize(inbuffer + offset);
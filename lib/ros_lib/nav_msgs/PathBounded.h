@@ -0,0 +1,59 @@
+#ifndef _ROS_nav_msgs_PathBounded_h
+#define _ROS_nav_msgs_PathBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "std_msgs/Header.h"
+#include "geometry_msgs/PoseStamped.h"
+
+namespace nav_msgs
+{
+
+  /* nav_msgs/Path with inline storage for up to POSES poses */
+  template<uint32_t POSES>
+  class PathBounded : public ros::BoundedMsg
+  {
+    public:
+      std_msgs::Header header;
+      uint32_t poses_length;
+      geometry_msgs::PoseStamped poses[POSES];
+
+    PathBounded():
+      header(),
+      poses_length(0), poses()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      offset += serializeBoundedMsgs(outbuffer + offset, this->poses, poses_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += serializedLengthMsgs(this->poses, poses_length);
+      return offset;
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += this->header.deserialize(inbuffer + offset);
+      offset += deserializeBoundedMsgs(inbuffer + offset, this->poses, POSES, poses_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "nav_msgs/Path"; };
+    virtual const char * getMD5() override { return "6227e2b7e9cce15051f669a5e197bbf7"; };
+
+  };
+
+}
+#endif
@@ -24,6 +24,17 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -39,7 +50,7 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
   {
     public:
       uint32_t nodelets_length;
-      typedef char* _nodelets_type;
+      typedef ros::StringView _nodelets_type;
       _nodelets_type st_nodelets;
       _nodelets_type * nodelets;
 
@@ -57,15 +68,25 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
       *(outbuffer + offset + 3) = (this->nodelets_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->nodelets_length);
       for( uint32_t i = 0; i < nodelets_length; i++){
-      uint32_t length_nodeletsi = strlen(this->nodelets[i]);
+      uint32_t length_nodeletsi = this->nodelets[i].size();
       varToArr(outbuffer + offset, length_nodeletsi);
       offset += 4;
-      memcpy(outbuffer + offset, this->nodelets[i], length_nodeletsi);
+      memcpy(outbuffer + offset, this->nodelets[i].data(), length_nodeletsi);
       offset += length_nodeletsi;
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->nodelets_length);
+      for( uint32_t i = 0; i < nodelets_length; i++){
+      offset += 4 + this->nodelets[i].size();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -75,19 +96,15 @@ static const char NODELETLIST[] = "nodelet/NodeletList";
       nodelets_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->nodelets_length);
       if(nodelets_lengthT > nodelets_length)
-        this->nodelets = (char**)realloc(this->nodelets, nodelets_lengthT * sizeof(char*));
+        this->nodelets = (ros::StringView*)realloc(this->nodelets, nodelets_lengthT * sizeof(ros::StringView));
       nodelets_length = nodelets_lengthT;
       for( uint32_t i = 0; i < nodelets_length; i++){
       uint32_t length_st_nodelets;
       arrToVar(length_st_nodelets, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_nodelets; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_nodelets-1]=0;
-      this->st_nodelets = (char *)(inbuffer + offset-1);
+      this->st_nodelets = ros::StringView((const char *)(inbuffer + offset), length_st_nodelets, false);
       offset += length_st_nodelets;
-        memcpy( &(this->nodelets[i]), &(this->st_nodelets), sizeof(char*));
+        memcpy( &(this->nodelets[i]), &(this->st_nodelets), sizeof(ros::StringView));
       }
      return offset;
     }
@@ -13,23 +13,23 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
   class NodeletLoadRequest : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _type_type;
+      typedef ros::StringView _type_type;
       _type_type type;
       uint32_t remap_source_args_length;
-      typedef char* _remap_source_args_type;
+      typedef ros::StringView _remap_source_args_type;
       _remap_source_args_type st_remap_source_args;
       _remap_source_args_type * remap_source_args;
       uint32_t remap_target_args_length;
-      typedef char* _remap_target_args_type;
+      typedef ros::StringView _remap_target_args_type;
       _remap_target_args_type st_remap_target_args;
       _remap_target_args_type * remap_target_args;
       uint32_t my_argv_length;
-      typedef char* _my_argv_type;
+      typedef ros::StringView _my_argv_type;
       _my_argv_type st_my_argv;
       _my_argv_type * my_argv;
-      typedef const char* _bond_id_type;
+      typedef ros::StringView _bond_id_type;
       _bond_id_type bond_id;
 
     NodeletLoadRequest():
@@ -45,15 +45,15 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_type = strlen(this->type);
+      uint32_t length_type = this->type.size();
       varToArr(outbuffer + offset, length_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->type, length_type);
+      memcpy(outbuffer + offset, this->type.data(), length_type);
       offset += length_type;
       *(outbuffer + offset + 0) = (this->remap_source_args_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->remap_source_args_length >> (8 * 1)) & 0xFF;
@@ -61,10 +61,10 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       *(outbuffer + offset + 3) = (this->remap_source_args_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->remap_source_args_length);
       for( uint32_t i = 0; i < remap_source_args_length; i++){
-      uint32_t length_remap_source_argsi = strlen(this->remap_source_args[i]);
+      uint32_t length_remap_source_argsi = this->remap_source_args[i].size();
       varToArr(outbuffer + offset, length_remap_source_argsi);
       offset += 4;
-      memcpy(outbuffer + offset, this->remap_source_args[i], length_remap_source_argsi);
+      memcpy(outbuffer + offset, this->remap_source_args[i].data(), length_remap_source_argsi);
       offset += length_remap_source_argsi;
       }
       *(outbuffer + offset + 0) = (this->remap_target_args_length >> (8 * 0)) & 0xFF;
@@ -73,10 +73,10 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       *(outbuffer + offset + 3) = (this->remap_target_args_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->remap_target_args_length);
       for( uint32_t i = 0; i < remap_target_args_length; i++){
-      uint32_t length_remap_target_argsi = strlen(this->remap_target_args[i]);
+      uint32_t length_remap_target_argsi = this->remap_target_args[i].size();
       varToArr(outbuffer + offset, length_remap_target_argsi);
       offset += 4;
-      memcpy(outbuffer + offset, this->remap_target_args[i], length_remap_target_argsi);
+      memcpy(outbuffer + offset, this->remap_target_args[i].data(), length_remap_target_argsi);
       offset += length_remap_target_argsi;
       }
       *(outbuffer + offset + 0) = (this->my_argv_length >> (8 * 0)) & 0xFF;
@@ -85,40 +85,53 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       *(outbuffer + offset + 3) = (this->my_argv_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->my_argv_length);
       for( uint32_t i = 0; i < my_argv_length; i++){
-      uint32_t length_my_argvi = strlen(this->my_argv[i]);
+      uint32_t length_my_argvi = this->my_argv[i].size();
       varToArr(outbuffer + offset, length_my_argvi);
       offset += 4;
-      memcpy(outbuffer + offset, this->my_argv[i], length_my_argvi);
+      memcpy(outbuffer + offset, this->my_argv[i].data(), length_my_argvi);
       offset += length_my_argvi;
       }
-      uint32_t length_bond_id = strlen(this->bond_id);
+      uint32_t length_bond_id = this->bond_id.size();
       varToArr(outbuffer + offset, length_bond_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->bond_id, length_bond_id);
+      memcpy(outbuffer + offset, this->bond_id.data(), length_bond_id);
       offset += length_bond_id;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->type.size();
+      offset += sizeof(this->remap_source_args_length);
+      for( uint32_t i = 0; i < remap_source_args_length; i++){
+      offset += 4 + this->remap_source_args[i].size();
+      }
+      offset += sizeof(this->remap_target_args_length);
+      for( uint32_t i = 0; i < remap_target_args_length; i++){
+      offset += 4 + this->remap_target_args[i].size();
+      }
+      offset += sizeof(this->my_argv_length);
+      for( uint32_t i = 0; i < my_argv_length; i++){
+      offset += 4 + this->my_argv[i].size();
+      }
+      offset += 4 + this->bond_id.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_type;
       arrToVar(length_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_type-1]=0;
-      this->type = (char *)(inbuffer + offset-1);
+      this->type = ros::StringView((const char *)(inbuffer + offset), length_type, false);
       offset += length_type;
       uint32_t remap_source_args_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       remap_source_args_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -126,19 +139,15 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       remap_source_args_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->remap_source_args_length);
       if(remap_source_args_lengthT > remap_source_args_length)
-        this->remap_source_args = (char**)realloc(this->remap_source_args, remap_source_args_lengthT * sizeof(char*));
+        this->remap_source_args = (ros::StringView*)realloc(this->remap_source_args, remap_source_args_lengthT * sizeof(ros::StringView));
       remap_source_args_length = remap_source_args_lengthT;
       for( uint32_t i = 0; i < remap_source_args_length; i++){
       uint32_t length_st_remap_source_args;
       arrToVar(length_st_remap_source_args, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_remap_source_args; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_remap_source_args-1]=0;
-      this->st_remap_source_args = (char *)(inbuffer + offset-1);
+      this->st_remap_source_args = ros::StringView((const char *)(inbuffer + offset), length_st_remap_source_args, false);
       offset += length_st_remap_source_args;
-        memcpy( &(this->remap_source_args[i]), &(this->st_remap_source_args), sizeof(char*));
+        memcpy( &(this->remap_source_args[i]), &(this->st_remap_source_args), sizeof(ros::StringView));
       }
       uint32_t remap_target_args_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       remap_target_args_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -146,19 +155,15 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       remap_target_args_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->remap_target_args_length);
       if(remap_target_args_lengthT > remap_target_args_length)
-        this->remap_target_args = (char**)realloc(this->remap_target_args, remap_target_args_lengthT * sizeof(char*));
+        this->remap_target_args = (ros::StringView*)realloc(this->remap_target_args, remap_target_args_lengthT * sizeof(ros::StringView));
       remap_target_args_length = remap_target_args_lengthT;
       for( uint32_t i = 0; i < remap_target_args_length; i++){
       uint32_t length_st_remap_target_args;
       arrToVar(length_st_remap_target_args, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_remap_target_args; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_remap_target_args-1]=0;
-      this->st_remap_target_args = (char *)(inbuffer + offset-1);
+      this->st_remap_target_args = ros::StringView((const char *)(inbuffer + offset), length_st_remap_target_args, false);
       offset += length_st_remap_target_args;
-        memcpy( &(this->remap_target_args[i]), &(this->st_remap_target_args), sizeof(char*));
+        memcpy( &(this->remap_target_args[i]), &(this->st_remap_target_args), sizeof(ros::StringView));
       }
       uint32_t my_argv_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       my_argv_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -166,28 +171,20 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       my_argv_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->my_argv_length);
       if(my_argv_lengthT > my_argv_length)
-        this->my_argv = (char**)realloc(this->my_argv, my_argv_lengthT * sizeof(char*));
+        this->my_argv = (ros::StringView*)realloc(this->my_argv, my_argv_lengthT * sizeof(ros::StringView));
       my_argv_length = my_argv_lengthT;
       for( uint32_t i = 0; i < my_argv_length; i++){
       uint32_t length_st_my_argv;
       arrToVar(length_st_my_argv, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_my_argv; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_my_argv-1]=0;
-      this->st_my_argv = (char *)(inbuffer + offset-1);
+      this->st_my_argv = ros::StringView((const char *)(inbuffer + offset), length_st_my_argv, false);
       offset += length_st_my_argv;
-        memcpy( &(this->my_argv[i]), &(this->st_my_argv), sizeof(char*));
+        memcpy( &(this->my_argv[i]), &(this->st_my_argv), sizeof(ros::StringView));
       }
       uint32_t length_bond_id;
       arrToVar(length_bond_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_bond_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_bond_id-1]=0;
-      this->bond_id = (char *)(inbuffer + offset-1);
+      this->bond_id = ros::StringView((const char *)(inbuffer + offset), length_bond_id, false);
       offset += length_bond_id;
      return offset;
     }
@@ -221,6 +218,17 @@ static const char NODELETLOAD[] = "nodelet/NodeletLoad";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
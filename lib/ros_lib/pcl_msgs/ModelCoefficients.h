@@ -35,18 +35,16 @@ namespace pcl_msgs
       *(outbuffer + offset + 2) = (this->values_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->values_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->values_length);
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_valuesi;
-      u_valuesi.real = this->values[i];
-      *(outbuffer + offset + 0) = (u_valuesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_valuesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_valuesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_valuesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->values[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->values, values_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->values_length);
+      offset += values_length * sizeof(this->values[0]);
       return offset;
     }
 
@@ -62,20 +60,7 @@ namespace pcl_msgs
       if(values_lengthT > values_length)
         this->values = (float*)realloc(this->values, values_lengthT * sizeof(float));
       values_length = values_lengthT;
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_values;
-      u_st_values.base = 0;
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_values = u_st_values.real;
-      offset += sizeof(this->st_values);
-        memcpy( &(this->values[i]), &(this->st_values), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->values, values_length);
      return offset;
     }
 
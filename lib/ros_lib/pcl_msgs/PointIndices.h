@@ -35,18 +35,16 @@ namespace pcl_msgs
       *(outbuffer + offset + 2) = (this->indices_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->indices_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->indices_length);
-      for( uint32_t i = 0; i < indices_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_indicesi;
-      u_indicesi.real = this->indices[i];
-      *(outbuffer + offset + 0) = (u_indicesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_indicesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_indicesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_indicesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->indices[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->indices, indices_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->indices_length);
+      offset += indices_length * sizeof(this->indices[0]);
       return offset;
     }
 
@@ -62,20 +60,7 @@ namespace pcl_msgs
       if(indices_lengthT > indices_length)
         this->indices = (int32_t*)realloc(this->indices, indices_lengthT * sizeof(int32_t));
       indices_length = indices_lengthT;
-      for( uint32_t i = 0; i < indices_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_st_indices;
-      u_st_indices.base = 0;
-      u_st_indices.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_indices.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_indices.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_indices.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_indices = u_st_indices.real;
-      offset += sizeof(this->st_indices);
-        memcpy( &(this->indices[i]), &(this->st_indices), sizeof(int32_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->indices, indices_length);
      return offset;
     }
 
@@ -23,11 +23,12 @@ namespace pcl_msgs
       typedef pcl_msgs::Vertices _polygons_type;
       _polygons_type st_polygons;
       _polygons_type * polygons;
+      uint32_t polygons_capacity;
 
     PolygonMesh():
       header(),
       cloud(),
-      polygons_length(0), st_polygons(), polygons(nullptr)
+      polygons_length(0), st_polygons(), polygons(nullptr), polygons_capacity(0)
     {
     }
 
@@ -47,6 +48,18 @@ namespace pcl_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += this->cloud.serializedLength();
+      offset += sizeof(this->polygons_length);
+      for( uint32_t i = 0; i < polygons_length; i++){
+      offset += this->polygons[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -57,12 +70,10 @@ namespace pcl_msgs
       polygons_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       polygons_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->polygons_length);
-      if(polygons_lengthT > polygons_length)
-        this->polygons = (pcl_msgs::Vertices*)realloc(this->polygons, polygons_lengthT * sizeof(pcl_msgs::Vertices));
+      this->polygons = ros::reserveMsgs(this->polygons, this->polygons_capacity, polygons_lengthT);
       polygons_length = polygons_lengthT;
       for( uint32_t i = 0; i < polygons_length; i++){
-      offset += this->st_polygons.deserialize(inbuffer + offset);
-        memcpy( &(this->polygons[i]), &(this->st_polygons), sizeof(pcl_msgs::Vertices));
+      offset += this->polygons[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -13,7 +13,7 @@ static const char UPDATEFILENAME[] = "pcl_msgs/UpdateFilename";
   class UpdateFilenameRequest : public ros::Msg
   {
     public:
-      typedef const char* _filename_type;
+      typedef ros::StringView _filename_type;
       _filename_type filename;
 
     UpdateFilenameRequest():
@@ -24,25 +24,28 @@ static const char UPDATEFILENAME[] = "pcl_msgs/UpdateFilename";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_filename = strlen(this->filename);
+      uint32_t length_filename = this->filename.size();
       varToArr(outbuffer + offset, length_filename);
       offset += 4;
-      memcpy(outbuffer + offset, this->filename, length_filename);
+      memcpy(outbuffer + offset, this->filename.data(), length_filename);
       offset += length_filename;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->filename.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_filename;
       arrToVar(length_filename, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_filename; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_filename-1]=0;
-      this->filename = (char *)(inbuffer + offset-1);
+      this->filename = ros::StringView((const char *)(inbuffer + offset), length_filename, false);
       offset += length_filename;
      return offset;
     }
@@ -76,6 +79,17 @@ static const char UPDATEFILENAME[] = "pcl_msgs/UpdateFilename";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
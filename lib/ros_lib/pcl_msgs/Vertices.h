@@ -30,13 +30,15 @@ namespace pcl_msgs
       *(outbuffer + offset + 2) = (this->vertices_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->vertices_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->vertices_length);
-      for( uint32_t i = 0; i < vertices_length; i++){
-      *(outbuffer + offset + 0) = (this->vertices[i] >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->vertices[i] >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->vertices[i] >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->vertices[i] >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->vertices[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->vertices, vertices_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->vertices_length);
+      offset += vertices_length * sizeof(this->vertices[0]);
       return offset;
     }
 
@@ -51,14 +53,7 @@ namespace pcl_msgs
       if(vertices_lengthT > vertices_length)
         this->vertices = (uint32_t*)realloc(this->vertices, vertices_lengthT * sizeof(uint32_t));
       vertices_length = vertices_lengthT;
-      for( uint32_t i = 0; i < vertices_length; i++){
-      this->st_vertices =  ((uint32_t) (*(inbuffer + offset)));
-      this->st_vertices |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->st_vertices |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->st_vertices |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->st_vertices);
-        memcpy( &(this->vertices[i]), &(this->st_vertices), sizeof(uint32_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->vertices, vertices_length);
      return offset;
     }
 
@@ -16,7 +16,7 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
   class GetPolledImageRequest : public ros::Msg
   {
     public:
-      typedef const char* _response_namespace_type;
+      typedef ros::StringView _response_namespace_type;
       _response_namespace_type response_namespace;
       typedef ros::Duration _timeout_type;
       _timeout_type timeout;
@@ -39,10 +39,10 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_response_namespace = strlen(this->response_namespace);
+      uint32_t length_response_namespace = this->response_namespace.size();
       varToArr(outbuffer + offset, length_response_namespace);
       offset += 4;
-      memcpy(outbuffer + offset, this->response_namespace, length_response_namespace);
+      memcpy(outbuffer + offset, this->response_namespace.data(), length_response_namespace);
       offset += length_response_namespace;
       *(outbuffer + offset + 0) = (this->timeout.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->timeout.sec >> (8 * 1)) & 0xFF;
@@ -68,17 +68,25 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->response_namespace.size();
+      offset += sizeof(this->timeout.sec);
+      offset += sizeof(this->timeout.nsec);
+      offset += sizeof(this->binning_x);
+      offset += sizeof(this->binning_y);
+      offset += this->roi.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_response_namespace;
       arrToVar(length_response_namespace, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_response_namespace; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_response_namespace-1]=0;
-      this->response_namespace = (char *)(inbuffer + offset-1);
+      this->response_namespace = ros::StringView((const char *)(inbuffer + offset), length_response_namespace, false);
       offset += length_response_namespace;
       this->timeout.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->timeout.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -114,7 +122,7 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _status_message_type;
+      typedef ros::StringView _status_message_type;
       _status_message_type status_message;
       typedef ros::Time _stamp_type;
       _stamp_type stamp;
@@ -136,10 +144,10 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_status_message = strlen(this->status_message);
+      uint32_t length_status_message = this->status_message.size();
       varToArr(outbuffer + offset, length_status_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->status_message, length_status_message);
+      memcpy(outbuffer + offset, this->status_message.data(), length_status_message);
       offset += length_status_message;
       *(outbuffer + offset + 0) = (this->stamp.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->stamp.sec >> (8 * 1)) & 0xFF;
@@ -154,6 +162,16 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->status_message.size();
+      offset += sizeof(this->stamp.sec);
+      offset += sizeof(this->stamp.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -168,11 +186,7 @@ static const char GETPOLLEDIMAGE[] = "polled_camera/GetPolledImage";
       uint32_t length_status_message;
       arrToVar(length_status_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_status_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_status_message-1]=0;
-      this->status_message = (char *)(inbuffer + offset-1);
+      this->status_message = ros::StringView((const char *)(inbuffer + offset), length_status_message, false);
       offset += length_status_message;
       this->stamp.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->stamp.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
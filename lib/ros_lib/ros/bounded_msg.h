@@ -0,0 +1,199 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_BOUNDED_MSG_H_
+#define ROS_BOUNDED_MSG_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/msg.h"
+
+namespace ros
+{
+
+/*
+ * Base of message variants that keep their variable length fields in
+ * fixed capacity inline arrays instead of realloc'ed pointers, so a
+ * subscriber never touches the heap. The wire format and type are the
+ * same as the regular message. Elements beyond the capacity of a field
+ * are skipped on receive and reported through truncated.
+ */
+class BoundedMsg : public Msg
+{
+public:
+  bool truncated = false;
+
+protected:
+  static uint32_t readLength(const unsigned char* inbuffer)
+  {
+    uint32_t length;
+    arrToVar(length, inbuffer);
+    return length;
+  }
+
+  /* Clamp a received element count to the capacity of its field. */
+  uint32_t clampLength(uint32_t count, uint32_t capacity)
+  {
+    if (count <= capacity)
+      return count;
+    truncated = true;
+    return capacity;
+  }
+
+  template<typename T>
+  static int serializeValue(unsigned char* outbuffer, const T& value)
+  {
+    return serializeArray(outbuffer, &value, 1);
+  }
+
+  template<typename T>
+  static int deserializeValue(const unsigned char* inbuffer, T& value)
+  {
+    return deserializeArray(inbuffer, &value, 1);
+  }
+
+  template<typename T>
+  static int serializeBounded(unsigned char* outbuffer, const T* arr, uint32_t length)
+  {
+    varToArr(outbuffer, length);
+    return 4 + serializeArray(outbuffer + 4, arr, length);
+  }
+
+  template<typename T>
+  int deserializeBounded(const unsigned char* inbuffer, T* arr, uint32_t capacity, uint32_t& length)
+  {
+    uint32_t count = readLength(inbuffer);
+    length = clampLength(count, capacity);
+    deserializeArray(inbuffer + 4, arr, length);
+    return 4 + count * sizeof(T);
+  }
+
+  static int serializeBoundedFloat64(unsigned char* outbuffer, const float64_t* arr, uint32_t length)
+  {
+    varToArr(outbuffer, length);
+    int offset = 4;
+    for (uint32_t i = 0; i < length; i++)
+      offset += serializeFloat64(outbuffer + offset, arr[i]);
+    return offset;
+  }
+
+  int deserializeBoundedFloat64(const unsigned char* inbuffer, float64_t* arr, uint32_t capacity, uint32_t& length)
+  {
+    uint32_t count = readLength(inbuffer);
+    length = clampLength(count, capacity);
+    for (uint32_t i = 0; i < length; i++)
+      deserializeFloat64(inbuffer + 4 + i * 8, &arr[i]);
+    return 4 + count * 8;
+  }
+
+  template<typename M>
+  static int serializeBoundedMsgs(unsigned char* outbuffer, const M* arr, uint32_t length)
+  {
+    varToArr(outbuffer, length);
+    int offset = 4;
+    for (uint32_t i = 0; i < length; i++)
+      offset += arr[i].serialize(outbuffer + offset);
+    return offset;
+  }
+
+  template<typename M>
+  static int serializedLengthMsgs(const M* arr, uint32_t length)
+  {
+    int offset = 4;
+    for (uint32_t i = 0; i < length; i++)
+      offset += arr[i].serializedLength();
+    return offset;
+  }
+
+  /* Surplus elements are decoded into a scratch message to find their end. */
+  template<typename M>
+  int deserializeBoundedMsgs(unsigned char* inbuffer, M* arr, uint32_t capacity, uint32_t& length)
+  {
+    uint32_t count = readLength(inbuffer);
+    length = clampLength(count, capacity);
+    int offset = 4;
+    for (uint32_t i = 0; i < count; i++)
+    {
+      if (i < length)
+      {
+        offset += arr[i].deserialize(inbuffer + offset);
+      }
+      else
+      {
+        M skipped;
+        offset += skipped.deserialize(inbuffer + offset);
+      }
+    }
+    return offset;
+  }
+
+  static int serializeBoundedStrings(unsigned char* outbuffer, const StringView* arr, uint32_t length)
+  {
+    varToArr(outbuffer, length);
+    int offset = 4;
+    for (uint32_t i = 0; i < length; i++)
+      offset += arr[i].serialize(outbuffer + offset);
+    return offset;
+  }
+
+  static int serializedLengthStrings(const StringView* arr, uint32_t length)
+  {
+    int offset = 4;
+    for (uint32_t i = 0; i < length; i++)
+      offset += 4 + arr[i].size();
+    return offset;
+  }
+
+  /* Strings stay in the receive buffer, see StringView. */
+  int deserializeBoundedStrings(unsigned char* inbuffer, StringView* arr, uint32_t capacity, uint32_t& length)
+  {
+    uint32_t count = readLength(inbuffer);
+    length = clampLength(count, capacity);
+    int offset = 4;
+    for (uint32_t i = 0; i < count; i++)
+    {
+      if (i < length)
+        offset += arr[i].deserialize(inbuffer + offset);
+      else
+        offset += 4 + readLength(inbuffer + offset);
+    }
+    return offset;
+  }
+};
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_GENERIC_SUBSCRIBER_H_
+#define ROS_GENERIC_SUBSCRIBER_H_
+
+#include "ros/subscriber.h"
+#include "ros/msg_schema.h"
+
+namespace ros
+{
+
+/*
+ * Subscriber for a message type that is only known at runtime. Frames are
+ * decoded against a MsgSchema and every value is handed to the callback
+ * with the id of its field, see MsgSchema::find(). Arrays of numbers are
+ * handed over as one span that points into the receive buffer, it is only
+ * valid during the callback. type and md5 must be
+ * those of the published message (`rosmsg md5 pkg/Type`), rosserial_python
+ * refuses the topic otherwise.
+ */
+class GenericSubscriber: public Subscriber_
+{
+public:
+  typedef void(*CallbackT)(int field, uint32_t index, const SchemaValue& value);
+
+  GenericSubscriber(const char * topic_name, const char * type, const char * md5, const MsgSchema& schema,
+                    CallbackT cb, int endpoint = rosserial_msgs::TopicInfo::ID_SUBSCRIBER) :
+    schema_(schema),
+    type_(type),
+    md5_(md5),
+    cb_(cb),
+    endpoint_(endpoint)
+  {
+    topic_ = topic_name;
+  };
+
+  /*
+   * Only report the field at path. Until the first call every field is
+   * reported. Returns the field id, -1 if the schema has no such field.
+   */
+  int select(const char * path)
+  {
+    int field = schema_.find(path);
+    if (field < 0)
+      return -1;
+    if (!filtered_)
+      memset(selected_, 0, sizeof(selected_));
+    filtered_ = true;
+    selected_[field >> 3] |= 1 << (field & 7);
+    return field;
+  }
+
+  void selectAll()
+  {
+    filtered_ = false;
+  }
+
+  /* Frames that did not match the schema. */
+  uint32_t errors() const
+  {
+    return errors_;
+  }
+
+  virtual void callback(unsigned char* data) override
+  {
+  }
+
+  virtual void receive(unsigned char* data, int length) override
+  {
+    if (!schema_.decode(data, length, filtered_ ? selected_ : nullptr, *this))
+      errors_++;
+  }
+
+  void onField(int field, uint32_t index, const SchemaValue& value)
+  {
+    cb_(field, index, value);
+  }
+
+  virtual const char * getMsgType() override
+  {
+    return type_;
+  }
+  virtual const char * getMsgMD5() override
+  {
+    return md5_;
+  }
+  virtual int getEndpointType() override
+  {
+    return endpoint_;
+  }
+
+private:
+  const MsgSchema& schema_;
+  const char * type_;
+  const char * md5_;
+  CallbackT cb_;
+  int endpoint_;
+  bool filtered_{false};
+  uint8_t selected_[(SCHEMA_MAX_OPS + 7) / 8];
+  uint32_t errors_{0};
+};
+
+}
+
+#endif
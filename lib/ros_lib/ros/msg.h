@@ -37,16 +37,54 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
+#include <new>
+
+#include "ros/string_view.h"
+
+/*
+ * Set when the target stores integers and floats in the little endian
+ * order of the wire format, so primitive arrays can be copied as a block.
+ */
+#ifndef ROSSERIAL_LITTLE_ENDIAN
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define ROSSERIAL_LITTLE_ENDIAN 1
+#else
+#define ROSSERIAL_LITTLE_ENDIAN 0
+#endif
+#endif
+
+/*
+ * Set when double is a 64 bit IEEE type, so float64 fields are stored as
+ * double and copied as is. AVR, whose double is 32 bit, stores them as
+ * float and converts with serializeAvrFloat64().
+ */
+#ifndef ROSSERIAL_NATIVE_FLOAT64
+#if defined(__AVR__) || (defined(__SIZEOF_DOUBLE__) && __SIZEOF_DOUBLE__ != 8)
+#define ROSSERIAL_NATIVE_FLOAT64 0
+#else
+#define ROSSERIAL_NATIVE_FLOAT64 1
+#endif
+#endif
 
 namespace ros
 {
 
+/* C type of float64 message fields */
+#if ROSSERIAL_NATIVE_FLOAT64
+typedef double float64_t;
+#else
+typedef float float64_t;
+#endif
+
 /* Base Message Type */
 class Msg
 {
 public:
   virtual int serialize(unsigned char *outbuffer) const = 0;
+  /* Bytes serialize() would write for the current content */
+  virtual int serializedLength() const = 0;
   virtual int deserialize(unsigned char *data) = 0;
   virtual const char * getType() = 0;
   virtual const char * getMD5() = 0;
@@ -183,6 +221,39 @@ public:
     return 8;
   }
 
+  // Copy a float64 field to the wire. Returns the number of bytes written.
+  static int serializeFloat64(unsigned char* outbuffer, const float64_t f)
+  {
+#if !ROSSERIAL_NATIVE_FLOAT64
+    return serializeAvrFloat64(outbuffer, f);
+#elif ROSSERIAL_LITTLE_ENDIAN
+    memcpy(outbuffer, &f, 8);
+    return 8;
+#else
+    uint64_t val;
+    memcpy(&val, &f, 8);
+    varToArr(outbuffer, val);
+    return 8;
+#endif
+  }
+
+  // Copy a float64 field from the wire. Returns the number of bytes read.
+  static int deserializeFloat64(const unsigned char* inbuffer, float64_t* f)
+  {
+#if !ROSSERIAL_NATIVE_FLOAT64
+    return deserializeAvrFloat64(inbuffer, f);
+#elif ROSSERIAL_LITTLE_ENDIAN
+    memcpy(f, inbuffer, 8);
+    return 8;
+#else
+    uint64_t val = 0;
+    for (int i = 0; i < 8; i++)
+      val |= ((uint64_t) inbuffer[i]) << (8 * i);
+    memcpy(f, &val, 8);
+    return 8;
+#endif
+  }
+
   // Copy data from variable into a byte array
   template<typename A, typename V>
   static void varToArr(A arr, const V var)
@@ -191,6 +262,40 @@ public:
       arr[i] = (var >> (8 * i));
   }
 
+  // Copy a primitive array to the wire. Returns the number of bytes written.
+  template<typename T>
+  static int serializeArray(unsigned char* outbuffer, const T* arr, uint32_t count)
+  {
+#if ROSSERIAL_LITTLE_ENDIAN
+    memcpy(outbuffer, arr, count * sizeof(T));
+#else
+    for (uint32_t i = 0; i < count; i++)
+    {
+      const unsigned char* bytes = (const unsigned char*) &arr[i];
+      for (size_t b = 0; b < sizeof(T); b++)
+        outbuffer[i * sizeof(T) + b] = bytes[sizeof(T) - 1 - b];
+    }
+#endif
+    return count * sizeof(T);
+  }
+
+  // Copy a primitive array from the wire. Returns the number of bytes read.
+  template<typename T>
+  static int deserializeArray(const unsigned char* inbuffer, T* arr, uint32_t count)
+  {
+#if ROSSERIAL_LITTLE_ENDIAN
+    memcpy(arr, inbuffer, count * sizeof(T));
+#else
+    for (uint32_t i = 0; i < count; i++)
+    {
+      unsigned char* bytes = (unsigned char*) &arr[i];
+      for (size_t b = 0; b < sizeof(T); b++)
+        bytes[sizeof(T) - 1 - b] = inbuffer[i * sizeof(T) + b];
+    }
+#endif
+    return count * sizeof(T);
+  }
+
   // Copy data from a byte array into variable
   template<typename V, typename A>
   static void arrToVar(V& var, const A arr)
@@ -202,6 +307,82 @@ public:
 
 };
 
+/*
+ * Largest maxSerializedLength() of the given fixed layout message types,
+ * e.g. to size the INPUT_SIZE of a NodeHandle_ from its subscribed types.
+ */
+template<class M, class... More>
+struct MaxSerializedLength
+{
+  enum { rest = MaxSerializedLength<More...>::value };
+  enum { value = M::maxSerializedLength() > (int) rest ? M::maxSerializedLength() : (int) rest };
+};
+
+template<class M>
+struct MaxSerializedLength<M>
+{
+  enum { value = M::maxSerializedLength() };
+};
+
+/* Largest of several sizes, for buffers sized from variable layout bounds. */
+constexpr int maxLength(int a)
+{
+  return a;
+}
+
+template<class... More>
+constexpr int maxLength(int a, int b, More... more)
+{
+  return maxLength(a > b ? a : b, more...);
+}
+
+/*
+ * Codec calls for a message whose exact type is known at compile time.
+ * The qualified calls skip the vtable so the compiler can inline them;
+ * a plain ros::Msg still dispatches virtually. Only pass objects that
+ * are exactly M, not a subclass overriding its codec.
+ */
+template<class M>
+inline int serializeMsg(const M& msg, unsigned char* outbuffer)
+{
+  return msg.M::serialize(outbuffer);
+}
+
+inline int serializeMsg(const Msg& msg, unsigned char* outbuffer)
+{
+  return msg.serialize(outbuffer);
+}
+
+template<class M>
+inline int serializedLengthMsg(const M& msg)
+{
+  return msg.M::serializedLength();
+}
+
+inline int serializedLengthMsg(const Msg& msg)
+{
+  return msg.serializedLength();
+}
+
+/*
+ * Make room to decode length nested messages in place. Used for arrays
+ * of messages that own arrays themselves: copying a decoded scratch
+ * message into each element would leave all of them sharing its
+ * buffers. Elements are constructed once and keep their buffers when a
+ * shorter array arrives; capacity counts the constructed ones.
+ */
+template<class M>
+M* reserveMsgs(M* arr, uint32_t& capacity, uint32_t length)
+{
+  if (length <= capacity)
+    return arr;
+  arr = (M*) realloc(arr, length * sizeof(M));
+  for (uint32_t i = capacity; i < length; i++)
+    new (&arr[i]) M();
+  capacity = length;
+  return arr;
+}
+
 }  // namespace ros
 
 #endif
@@ -0,0 +1,808 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_MSG_SCHEMA_H_
+#define ROS_MSG_SCHEMA_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+
+namespace ros
+{
+
+/*
+ * Binary message schema
+ *
+ * A schema is a flat program of ops, one per primitive field in wire
+ * order. Nested messages are inlined with dotted names ("pose.position.x"),
+ * arrays of messages become a SCHEMA_MESSAGE op followed by the ops of
+ * one element. Encoding:
+ *
+ *   op_count:u8, then per op:
+ *     code:u8       field type | SCHEMA_ARRAY or SCHEMA_FIXED
+ *     count:u16     SCHEMA_FIXED only, number of elements
+ *     body:u8       SCHEMA_MESSAGE only, ops that describe one element
+ *     name_len:u8, name
+ */
+const uint8_t SCHEMA_INT8     = 0;   // also byte
+const uint8_t SCHEMA_UINT8    = 1;   // also bool and char
+const uint8_t SCHEMA_INT16    = 2;
+const uint8_t SCHEMA_UINT16   = 3;
+const uint8_t SCHEMA_INT32    = 4;
+const uint8_t SCHEMA_UINT32   = 5;
+const uint8_t SCHEMA_INT64    = 6;
+const uint8_t SCHEMA_UINT64   = 7;
+const uint8_t SCHEMA_FLOAT32  = 8;
+const uint8_t SCHEMA_FLOAT64  = 9;
+const uint8_t SCHEMA_STRING   = 10;
+const uint8_t SCHEMA_TIME     = 11;  // time and duration, sec and nsec
+const uint8_t SCHEMA_MESSAGE  = 12;
+const uint8_t SCHEMA_TYPE     = 0x0f;
+const uint8_t SCHEMA_ARRAY    = 0x40;  // uint32 count on the wire
+const uint8_t SCHEMA_FIXED    = 0x80;  // count in the schema
+
+const int SCHEMA_MAX_OPS      = 64;   // ops a MsgSchema can hold
+const int SCHEMA_MAX_DEPTH    = 8;    // nesting of message definitions
+const int SCHEMA_MAX_NAME     = 64;   // length of a dotted field name
+
+/* Value of type T stored little endian at p. */
+template<typename T>
+inline T schemaLoad(const uint8_t* p)
+{
+  T value;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  uint8_t bytes[sizeof(T)];
+  for (size_t b = 0; b < sizeof(T); b++)
+    bytes[b] = p[sizeof(T) - 1 - b];
+  memcpy(&value, bytes, sizeof(T));
+#else
+  memcpy(&value, p, sizeof(T));
+#endif
+  return value;
+}
+
+/*
+ * One decoded value, see MsgSchema::decode(). Arrays of numbers and
+ * times are reported as a single span instead: span is set and the count
+ * elements are still in the frame at data, read them with at() or
+ * copyTo(). Consecutive fields of the same type that are all selected,
+ * like the x, y and z of a Vector3, come as one span too; fields is set
+ * and element k is the value of field id + k.
+ */
+struct SchemaValue
+{
+  uint8_t type;
+  bool span;
+  bool fields;
+  union
+  {
+    int64_t i;        // signed integers, sec of a time
+    uint64_t u;       // unsigned integers
+    double f;         // float32 and float64
+  };
+  int32_t nsec;       // nsec of a time
+  const char* str;    // string characters, not NUL-terminated
+  uint32_t length;    // string length
+  const uint8_t* data;  // span elements, little endian
+  uint32_t count;       // span elements
+
+  /* Element k of a span as a single value. */
+  SchemaValue at(uint32_t k) const
+  {
+    SchemaValue v = SchemaValue();
+    v.type = type;
+    v.span = false;
+    v.fields = false;
+    v.data = data + k * size(type);
+    v.count = 1;
+    v.read();
+    return v;
+  }
+
+  /* Set the value from the type and the wire bytes at data. */
+  void read()
+  {
+    switch (type)
+    {
+      case SCHEMA_INT8:    i = schemaLoad<int8_t>(data); break;
+      case SCHEMA_UINT8:   u = schemaLoad<uint8_t>(data); break;
+      case SCHEMA_INT16:   i = schemaLoad<int16_t>(data); break;
+      case SCHEMA_UINT16:  u = schemaLoad<uint16_t>(data); break;
+      case SCHEMA_INT32:   i = schemaLoad<int32_t>(data); break;
+      case SCHEMA_UINT32:  u = schemaLoad<uint32_t>(data); break;
+      case SCHEMA_INT64:   i = schemaLoad<int64_t>(data); break;
+      case SCHEMA_UINT64:  u = schemaLoad<uint64_t>(data); break;
+      case SCHEMA_FLOAT32: f = schemaLoad<float>(data); break;
+      case SCHEMA_FLOAT64: f = schemaLoad<double>(data); break;
+      case SCHEMA_TIME:
+        i = schemaLoad<uint32_t>(data);
+        nsec = schemaLoad<int32_t>(data + 4);
+        break;
+      default:
+        break;
+    }
+  }
+
+  /*
+   * Convert up to max elements of a span to T, times give their seconds.
+   * Returns the number written. A span whose wire type is T is copied
+   * in one piece on little endian targets.
+   */
+  template<typename T>
+  uint32_t copyTo(T* out, uint32_t max) const
+  {
+    uint32_t n = count < max ? count : max;
+    switch (type)
+    {
+      case SCHEMA_INT8:    convert<int8_t>(out, n); break;
+      case SCHEMA_UINT8:   convert<uint8_t>(out, n); break;
+      case SCHEMA_INT16:   convert<int16_t>(out, n); break;
+      case SCHEMA_UINT16:  convert<uint16_t>(out, n); break;
+      case SCHEMA_INT32:   convert<int32_t>(out, n); break;
+      case SCHEMA_UINT32:  convert<uint32_t>(out, n); break;
+      case SCHEMA_INT64:   convert<int64_t>(out, n); break;
+      case SCHEMA_UINT64:  convert<uint64_t>(out, n); break;
+      case SCHEMA_FLOAT32: convert<float>(out, n); break;
+      case SCHEMA_FLOAT64: convert<double>(out, n); break;
+      default:
+        for (uint32_t k = 0; k < n; k++)
+          out[k] = (T) schemaLoad<uint32_t>(data + k * 8);
+        break;
+    }
+    return n;
+  }
+
+  /* Wire size of one element of a number or time type. */
+  static int size(uint8_t type)
+  {
+    static const uint8_t sizes[] = {1, 1, 2, 2, 4, 4, 8, 8, 4, 8, 0, 8, 0};
+    return sizes[type];
+  }
+
+  /* Numeric value as double, strings give their length. */
+  double toDouble() const
+  {
+    switch (type)
+    {
+      case SCHEMA_FLOAT32:
+      case SCHEMA_FLOAT64:
+        return f;
+      case SCHEMA_UINT8:
+      case SCHEMA_UINT16:
+      case SCHEMA_UINT32:
+      case SCHEMA_UINT64:
+        return (double) u;
+      case SCHEMA_STRING:
+        return length;
+      case SCHEMA_TIME:
+        return i + nsec * 1e-9;
+      default:
+        return (double) i;
+    }
+  }
+
+private:
+  template<typename W, typename T>
+  void convert(T* out, uint32_t n) const
+  {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+    if (std::is_same<W, T>::value)
+    {
+      memcpy(out, data, n * sizeof(T));
+      return;
+    }
+#endif
+    for (uint32_t k = 0; k < n; k++)
+      out[k] = (T) schemaLoad<W>(data + k * sizeof(W));
+  }
+};
+
+/*
+ * A compiled schema and the interpreter that decodes frames against it.
+ * The schema buffer passed to compile() or load() must outlive it.
+ */
+class MsgSchema
+{
+public:
+  /*
+   * Compile a message definition as ROS ships it in message_definition or
+   * `gendeps --cat`: the fields of type, then a "MSG: pkg/Type" section
+   * for every message it uses. Returns the bytes written to buffer, -1 if
+   * the definition is invalid or does not fit.
+   */
+  int compile(const char* type, const char* definition, uint8_t* buffer, int size)
+  {
+    Compiler c(definition, buffer, size);
+    const char* slash = strchr(type, '/');
+    if (slash == nullptr || !c.emitMessage(definition, slash - type, type, "", 0))
+      return -1;
+    buffer[0] = c.ops;
+    int used = c.pos;
+    return load(buffer, used) ? used : -1;
+  }
+
+  /* Use an already compiled schema. */
+  bool load(const uint8_t* schema, int size)
+  {
+    count_ = 0;
+    if (size < 1 || schema[0] > SCHEMA_MAX_OPS)
+      return false;
+    schema_ = schema;
+    int pos = 1;
+    for (int i = 0; i < schema[0]; i++)
+    {
+      if (pos >= size)
+        return false;
+      Op& op = ops_[i];
+      op.code = schema[pos++];
+      op.count = 1;
+      op.body = 0;
+      op.element = 0;
+      if (op.code & SCHEMA_FIXED)
+      {
+        if (pos + 2 > size)
+          return false;
+        op.count = schema[pos] | (schema[pos + 1] << 8);
+        pos += 2;
+      }
+      if ((op.code & SCHEMA_TYPE) == SCHEMA_MESSAGE)
+      {
+        if (pos >= size)
+          return false;
+        op.body = schema[pos++];
+        if (i + 1 + op.body > schema[0])
+          return false;
+      }
+      if (pos >= size || pos + 1 + schema[pos] > size)
+        return false;
+      op.name = pos;
+      pos += 1 + schema[pos];
+      uint8_t type = op.code & SCHEMA_TYPE;
+      op.bytes = (op.code & SCHEMA_ARRAY) ? 0 : op.count * typeSize(type);
+    }
+    count_ = schema[0];
+    link(0, count_);
+    return true;
+  }
+
+  int fields() const
+  {
+    return count_;
+  }
+
+  uint8_t type(int field) const
+  {
+    return ops_[field].code & SCHEMA_TYPE;
+  }
+
+  /*
+   * Field id of a dotted path such as "pose.pose.position.x". Elements of
+   * message arrays are addressed without an index, e.g. "transforms.child_frame_id".
+   * Returns -1 if there is no such field.
+   */
+  int find(const char* path) const
+  {
+    return find(path, 0, count_);
+  }
+
+  /*
+   * Decode a payload of length bytes. Every value of a selected field is
+   * passed to visitor.onField(field, index, value); index counts the
+   * elements of the innermost message array. Arrays of numbers and runs
+   * of same type fields come as one span, see SchemaValue. selected is a
+   * bitmap with a bit per field id, nullptr selects all. Returns false if
+   * the payload does not match the schema.
+   */
+  template<class Visitor>
+  bool decode(const uint8_t* data, int length, const uint8_t* selected, Visitor& visitor) const
+  {
+    /* message arrays being decoded, innermost last */
+    struct Level
+    {
+      int first;          // first op of the element
+      int last;           // op after the element
+      uint32_t element;
+      uint32_t count;
+    };
+    Level levels[SCHEMA_MAX_DEPTH];
+    int depth = 0;
+    int last = count_;
+    uint32_t index = 0;
+    const uint8_t* p = data;
+    const uint8_t* end = data + length;
+    SchemaValue v = SchemaValue();
+    for (int i = 0;;)
+    {
+      if (i >= last)
+      {
+        if (depth == 0)
+          break;
+        Level& level = levels[depth - 1];
+        if (++level.element < level.count)
+        {
+          i = level.first;
+          index = level.element;
+          continue;
+        }
+        i = level.last;
+        depth--;
+        last = depth ? levels[depth - 1].last : count_;
+        index = depth ? levels[depth - 1].element : 0;
+        continue;
+      }
+      const Op& op = ops_[i];
+      /* a run of fixed size fields needs a single bounds check */
+      if (op.run_ops)
+      {
+        if ((uint32_t)(end - p) < op.run_bytes)
+          return false;
+        if (anySelected(selected, i, i + op.run_ops))
+          decodeRun(i, i + op.run_ops, p, index, selected, visitor);
+        else
+          p += op.run_bytes;
+        i += op.run_ops;
+        continue;
+      }
+      v.type = op.code & SCHEMA_TYPE;
+      v.span = false;
+      v.fields = false;
+      uint32_t n = op.count;
+      if (op.code & SCHEMA_ARRAY)
+      {
+        if (end - p < 4)
+          return false;
+        n = read32(p);
+        p += 4;
+      }
+      if (v.type == SCHEMA_MESSAGE)
+      {
+        int body_end = i + 1 + op.body;
+        /* elements of a fixed size without selected fields are skipped whole */
+        if (op.element && !anySelected(selected, i + 1, body_end))
+        {
+          if ((uint64_t) n * op.element > (uint64_t)(end - p))
+            return false;
+          p += n * op.element;
+          i = body_end;
+          continue;
+        }
+        if (n == 0)
+        {
+          i = body_end;
+          continue;
+        }
+        if (depth == SCHEMA_MAX_DEPTH)
+          return false;
+        Level& level = levels[depth++];
+        level.first = i + 1;
+        level.last = body_end;
+        level.element = 0;
+        level.count = n;
+        last = body_end;
+        index = 0;
+        i++;
+        continue;
+      }
+      bool want = isSelected(selected, i);
+      bool array = (op.code & (SCHEMA_ARRAY | SCHEMA_FIXED)) != 0;
+      if (v.type == SCHEMA_STRING)
+      {
+        for (uint32_t k = 0; k < n; k++)
+        {
+          if (end - p < 4 || (uint32_t)(end - p - 4) < read32(p))
+            return false;
+          v.length = read32(p);
+          v.str = (const char*)(p + 4);
+          p += 4 + v.length;
+          if (want)
+            visitor.onField(i, array ? k : index, v);
+        }
+        i++;
+        continue;
+      }
+      /* arrays of numbers and times, the fixed size ones are part of a run */
+      uint32_t size = typeSize(v.type);
+      if ((uint64_t) n * size > (uint64_t)(end - p))
+        return false;
+      if (want)
+      {
+        v.span = true;
+        v.data = p;
+        v.count = n;
+        visitor.onField(i, index, v);
+      }
+      p += n * size;
+      i++;
+    }
+    return p == end;
+  }
+
+protected:
+  struct Op
+  {
+    uint8_t code;
+    uint8_t body;
+    uint16_t count;
+    uint16_t name;
+    uint8_t run_ops;    // fixed size fields from here to the next other one, 0 if this is not one
+    uint8_t same;       // single values of this type from here on in the run
+    uint32_t bytes;     // wire size of a fixed size field, 0 for the others
+    uint32_t run_bytes; // wire size of the run_ops fields
+    uint32_t element;   // wire size of a message array element if fixed, else 0
+  };
+
+  /* Fill in element and the runs of fixed size fields for ops [first, last). */
+  void link(int first, int last)
+  {
+    uint8_t scope[SCHEMA_MAX_OPS];
+    int n = 0;
+    for (int i = first; i < last; i++)
+    {
+      scope[n++] = i;
+      if ((ops_[i].code & SCHEMA_TYPE) == SCHEMA_MESSAGE)
+      {
+        link(i + 1, i + 1 + ops_[i].body);
+        ops_[i].element = elementSize(i);
+        i += ops_[i].body;
+      }
+    }
+    int ops = 0;
+    uint32_t bytes = 0;
+    int same = 0;
+    for (int k = n - 1; k >= 0; k--)
+    {
+      Op& op = ops_[scope[k]];
+      if (op.bytes == 0 || (op.code & SCHEMA_TYPE) == SCHEMA_MESSAGE)
+      {
+        ops = 0;
+        bytes = 0;
+      }
+      else
+      {
+        ops++;
+        bytes += op.bytes;
+      }
+      /* runs are consecutive op ids, k + 1 is the next op in the run */
+      if (ops > 1 && !(op.code & SCHEMA_FIXED) && op.code == ops_[scope[k] + 1].code)
+        same++;
+      else
+        same = 1;
+      op.run_ops = ops;
+      op.run_bytes = bytes;
+      op.same = same;
+    }
+  }
+
+  /* Wire size of one element of message array op, 0 if it varies. */
+  uint32_t elementSize(int op) const
+  {
+    uint32_t total = 0;
+    for (int i = op + 1; i <= op + ops_[op].body; i++)
+    {
+      const Op& o = ops_[i];
+      if ((o.code & SCHEMA_TYPE) == SCHEMA_MESSAGE)
+      {
+        if ((o.code & SCHEMA_ARRAY) || o.element == 0)
+          return 0;
+        total += o.count * o.element;
+        i += o.body;
+      }
+      else if (o.bytes == 0)
+        return 0;
+      else
+        total += o.bytes;
+    }
+    return total;
+  }
+
+  static int typeSize(uint8_t type)
+  {
+    return SchemaValue::size(type);
+  }
+
+  int find(const char* path, int first, int last) const
+  {
+    for (int i = first; i < last; i++)
+    {
+      const Op& op = ops_[i];
+      const char* name = (const char*) schema_ + op.name + 1;
+      int len = schema_[op.name];
+      if (strncmp(path, name, len) == 0)
+      {
+        if (path[len] == 0)
+          return i;
+        if (path[len] == '.' && (op.code & SCHEMA_TYPE) == SCHEMA_MESSAGE)
+          return find(path + len + 1, i + 1, i + 1 + op.body);
+      }
+      i += op.body;
+    }
+    return -1;
+  }
+
+  static uint32_t read32(const uint8_t* p)
+  {
+    return schemaLoad<uint32_t>(p);
+  }
+
+  static bool isSelected(const uint8_t* selected, int field)
+  {
+    return selected == nullptr || (selected[field >> 3] & (1 << (field & 7)));
+  }
+
+  static bool allSelected(const uint8_t* selected, int first, int last)
+  {
+    if (selected == nullptr)
+      return true;
+    for (int i = first; i < last; i++)
+    {
+      if (!isSelected(selected, i))
+        return false;
+    }
+    return true;
+  }
+
+  /* Is any field in [first, last) selected? */
+  static bool anySelected(const uint8_t* selected, int first, int last)
+  {
+    if (selected == nullptr)
+      return true;
+    for (int i = first; i < last; i++)
+    {
+      if (isSelected(selected, i))
+        return true;
+    }
+    return false;
+  }
+
+  /* Decode the fixed size fields [first, last), their bytes are known to be there. */
+  template<class Visitor>
+  void decodeRun(int first, int last, const uint8_t*& p, uint32_t index, const uint8_t* selected,
+                 Visitor& visitor) const
+  {
+    SchemaValue v = SchemaValue();
+    for (int i = first; i < last; i++)
+    {
+      const Op& op = ops_[i];
+      v.type = op.code & SCHEMA_TYPE;
+      v.data = p;
+      if (op.same > 1 && allSelected(selected, i, i + op.same))
+      {
+        v.span = true;
+        v.fields = true;
+        v.count = op.same;
+        visitor.onField(i, index, v);
+        p += op.same * op.bytes;
+        i += op.same - 1;
+        continue;
+      }
+      if (isSelected(selected, i))
+      {
+        v.span = (op.code & SCHEMA_FIXED) != 0;
+        v.fields = false;
+        v.count = op.count;
+        if (!v.span)
+          v.read();
+        visitor.onField(i, index, v);
+      }
+      p += op.bytes;
+    }
+  }
+
+  /* Translates .msg text into ops, see compile(). */
+  struct Compiler
+  {
+    const char* definition;
+    uint8_t* out;
+    int size;
+    int pos;
+    int ops;
+
+    Compiler(const char* def, uint8_t* buffer, int buffer_size) :
+      definition(def), out(buffer), size(buffer_size), pos(1), ops(0)
+    {
+    }
+
+    bool put(uint8_t byte)
+    {
+      if (pos >= size)
+        return false;
+      out[pos++] = byte;
+      return true;
+    }
+
+    /* Start of the "MSG: type" section, nullptr if there is none. */
+    const char* findSection(const char* type, int len)
+    {
+      for (const char* p = strstr(definition, "\nMSG: "); p; p = strstr(p + 1, "\nMSG: "))
+      {
+        if (strncmp(p + 6, type, len) == 0 && (p[6 + len] == '\n' || p[6 + len] == '\r'))
+          return strchr(p + 6, '\n');
+      }
+      return nullptr;
+    }
+
+    static bool builtin(const char* t, int len, uint8_t* type)
+    {
+      static const char* const names[] = {"int8", "byte", "uint8", "bool", "char", "int16", "uint16", "int32",
+                                          "uint32", "int64", "uint64", "float32", "float64", "string", "time", "duration"};
+      static const uint8_t types[] = {SCHEMA_INT8, SCHEMA_INT8, SCHEMA_UINT8, SCHEMA_UINT8, SCHEMA_UINT8, SCHEMA_INT16,
+                                      SCHEMA_UINT16, SCHEMA_INT32, SCHEMA_UINT32, SCHEMA_INT64, SCHEMA_UINT64,
+                                      SCHEMA_FLOAT32, SCHEMA_FLOAT64, SCHEMA_STRING, SCHEMA_TIME, SCHEMA_TIME};
+      for (size_t i = 0; i < sizeof(types); i++)
+      {
+        if ((int) strlen(names[i]) == len && strncmp(t, names[i], len) == 0)
+        {
+          *type = types[i];
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool emitOp(uint8_t code, uint16_t count, const char* prefix, const char* name, int name_len)
+    {
+      int prefix_len = strlen(prefix);
+      if (ops >= SCHEMA_MAX_OPS || prefix_len + name_len >= SCHEMA_MAX_NAME)
+        return false;
+      ops++;
+      if (!put(code))
+        return false;
+      if ((code & SCHEMA_FIXED) && !(put(count & 0xff) && put(count >> 8)))
+        return false;
+      if ((code & SCHEMA_TYPE) == SCHEMA_MESSAGE && !put(0))  // body is patched later
+        return false;
+      if (!put(prefix_len + name_len) || pos + prefix_len + name_len > size)
+        return false;
+      memcpy(out + pos, prefix, prefix_len);
+      memcpy(out + pos + prefix_len, name, name_len);
+      pos += prefix_len + name_len;
+      return true;
+    }
+
+    /*
+     * Emit the fields of the message whose definition starts at text and
+     * ends at the next section. pkg_len is the length of its package name
+     * in type, fields are named prefix + field name.
+     */
+    bool emitMessage(const char* text, int pkg_len, const char* type, const char* prefix, int depth)
+    {
+      if (depth >= SCHEMA_MAX_DEPTH)
+        return false;
+      const char* p = text;
+      while (*p)
+      {
+        const char* line = p;
+        const char* eol = strchr(p, '\n');
+        if (eol == nullptr)
+          eol = p + strlen(p);
+        p = *eol ? eol + 1 : eol;
+        while (line < eol && (*line == ' ' || *line == '\t'))
+          line++;
+        if (strncmp(line, "===", 3) == 0 || strncmp(line, "MSG:", 4) == 0)
+          break;
+        if (line == eol || *line == '#' || *line == '\r')
+          continue;
+
+        /* "type[N] name", constants have an '=' after the name */
+        const char* t = line;
+        const char* te = t;
+        while (te < eol && *te != ' ' && *te != '\t' && *te != '[')
+          te++;
+        uint8_t flags = 0;
+        long count = 0;
+        const char* q = te;
+        if (q < eol && *q == '[')
+        {
+          q++;
+          if (*q == ']')
+            flags = SCHEMA_ARRAY;
+          else
+          {
+            flags = SCHEMA_FIXED;
+            count = strtol(q, nullptr, 10);
+            if (count <= 0 || count > 0xffff)
+              return false;
+          }
+          while (q < eol && *q != ']')
+            q++;
+          q++;
+        }
+        while (q < eol && (*q == ' ' || *q == '\t'))
+          q++;
+        const char* n = q;
+        while (q < eol && *q != ' ' && *q != '\t' && *q != '=' && *q != '#' && *q != '\r')
+          q++;
+        const char* ne = q;
+        while (q < eol && (*q == ' ' || *q == '\t'))
+          q++;
+        if (q < eol && *q == '=')
+          continue;
+        if (n == ne)
+          return false;
+
+        uint8_t builtin_type;
+        if (builtin(t, te - t, &builtin_type))
+        {
+          if (!emitOp(builtin_type | flags, count, prefix, n, ne - n))
+            return false;
+          continue;
+        }
+
+        /* nested message: resolve "Header" and names relative to the package */
+        char full[SCHEMA_MAX_NAME];
+        int tlen = te - t;
+        if (tlen == 6 && strncmp(t, "Header", 6) == 0)
+          snprintf(full, sizeof(full), "std_msgs/Header");
+        else if (memchr(t, '/', tlen))
+          snprintf(full, sizeof(full), "%.*s", tlen, t);
+        else
+          snprintf(full, sizeof(full), "%.*s/%.*s", pkg_len, type, tlen, t);
+        const char* section = findSection(full, strlen(full));
+        if (section == nullptr)
+          return false;
+        int sub_pkg = strchr(full, '/') - full;
+
+        char sub_prefix[SCHEMA_MAX_NAME];
+        if (flags == 0)
+        {
+          if (snprintf(sub_prefix, sizeof(sub_prefix), "%s%.*s.", prefix, (int)(ne - n), n) >= (int) sizeof(sub_prefix))
+            return false;
+          if (!emitMessage(section + 1, sub_pkg, full, sub_prefix, depth + 1))
+            return false;
+          continue;
+        }
+        int op = ops;
+        int body_pos = pos + 1 + ((flags & SCHEMA_FIXED) ? 2 : 0);
+        if (!emitOp(SCHEMA_MESSAGE | flags, count, prefix, n, ne - n))
+          return false;
+        if (!emitMessage(section + 1, sub_pkg, full, "", depth + 1))
+          return false;
+        out[body_pos] = ops - op - 1;
+      }
+      return true;
+    }
+  };
+
+  const uint8_t* schema_ = nullptr;
+  int count_ = 0;
+  Op ops_[SCHEMA_MAX_OPS];
+};
+
+}
+
+#endif
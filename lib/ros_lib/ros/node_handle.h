@@ -43,6 +43,8 @@
 #include "rosserial_msgs/RequestParam.h"
 
 #include "ros/msg.h"
+#include "ros/tx_buffer.h"
+#include "ros/timebase.h"
 
 namespace ros
 {
@@ -93,31 +95,117 @@ const uint8_t MODE_MSG_CHECKSUM   = 8;    // checksum for msg and topic id
 
 const uint8_t SERIAL_MSG_TIMEOUT  = 20;   // 20 milliseconds to recieve all of message data
 
+const int RX_CHUNK_SIZE           = 128;  // bytes pulled per bulk hardware read
+const int FRAME_OVERHEAD          = 8;    // header and checksum around the payload
+const int MAX_FRAME_PAYLOAD       = 65535; // largest payload the 16 bit length allows
+
+const uint8_t SYNC_SAMPLES        = 8;        // time sync round trips kept for outlier filtering
+const uint32_t SYNC_RTT_SLACK     = 2000;     // us a round trip may exceed twice the best one
+const uint32_t SYNC_MIN_RTT       = 100;      // us, a faster reply can not belong to the last request
+const uint32_t SYNC_REPLY_TIMEOUT = 50000;    // us until an unanswered time request is taken as lost
+const uint64_t SYNC_DRIFT_WINDOW  = 300000000ULL; // us before the drift baseline is restarted
+const int32_t SYNC_MAX_DRIFT      = 1000000;  // ppb (1000 ppm)
+const int64_t SYNC_STEP_LIMIT     = 100000;   // us of error that are stepped instead of slewed
+
 using rosserial_msgs::TopicInfo;
 
+/*
+ * Detects whether a Hardware class offers a bulk `read(uint8_t*, size_t)`
+ * in addition to the per-byte `read()`. Hardware that does gets its input
+ * parsed a chunk at a time, everything else keeps the byte-wise path.
+ */
+template<class Hardware>
+class HasBulkRead
+{
+  template<class U>
+  static char test(decltype(((U*)0)->read((uint8_t*)0, (size_t)0))*);
+  template<class U>
+  static long test(...);
+public:
+  enum { value = sizeof(test<Hardware>(0)) == sizeof(char) };
+};
+
+/*
+ * Detects whether a Hardware class offers a non-blocking
+ * `int writeSome(const uint8_t*, int)` that returns the number of bytes
+ * the connection accepted right now (0 if it would block, < 0 on error).
+ */
+template<class Hardware>
+class HasWriteSome
+{
+  template<class U>
+  static char test(decltype(((U*)0)->writeSome((const uint8_t*)0, 0))*);
+  template<class U>
+  static long test(...);
+public:
+  enum { value = sizeof(test<Hardware>(0)) == sizeof(char) };
+};
+
+template<bool B> struct BoolTag {};
+
 /* Node Handle */
 template<class Hardware,
          int MAX_SUBSCRIBERS = 25,
          int MAX_PUBLISHERS = 25,
          int INPUT_SIZE = 512,
-         int OUTPUT_SIZE = 512>
+         int OUTPUT_SIZE = 512,
+         int TX_BUFFER_SIZE = 0,
+         int NEGOTIATION_CACHE_SIZE = 0>
 class NodeHandle_ : public NodeHandleBase_
 {
 protected:
   Hardware hardware_{};
 
-  /* time used for syncing */
-  uint32_t rt_time{0};
+  /* local time in us when the last time sync request was sent */
+  uint64_t rt_time{0};
+  /* time requests sent since the last reply */
+  uint8_t sync_sent_{0};
 
-  /* used for computing current time */
-  uint32_t sec_offset{0}, nsec_offset{0};
+  /*
+   * used for computing current time:
+   * ros time = local + time_offset_ + drift_ppb_ * (local - time_offset_ref_)
+   */
+  int64_t time_offset_{0};
+  uint64_t time_offset_ref_{0};
+  int32_t drift_ppb_{0};
+  bool time_synced_{false};
+
+  /* time sync samples and drift baseline */
+  struct SyncSample
+  {
+    uint32_t rtt;
+    int64_t offset;
+  };
+  SyncSample sync_samples_[SYNC_SAMPLES] = {};
+  uint8_t sync_count_{0};
+  uint8_t sync_next_{0};
+  uint32_t sync_rtt_{0};
+  int64_t drift_ref_offset_{0};
+  uint64_t drift_ref_time_{0};
 
   /* Spinonce maximum work timeout */
   uint32_t spin_timeout_{0};
 
-  uint8_t message_in[INPUT_SIZE] = {0};
+  /* one spare byte so StringView can terminate the last string of a full frame */
+  uint8_t message_in[INPUT_SIZE + 1] = {0};
   uint8_t message_out[OUTPUT_SIZE] = {0};
 
+  /* bulk receive buffer, only sized for hardware with a bulk read */
+  uint8_t rx_chunk_[HasBulkRead<Hardware>::value ? RX_CHUNK_SIZE : 1] = {0};
+  int rx_pos_{0};
+  int rx_len_{0};
+
+  /* outgoing frames collected while batching is enabled */
+  TxBuffer<TX_BUFFER_SIZE> tx_buffer_;
+  bool tx_batching_{false};
+  int tx_flush_bytes_{TX_BUFFER_SIZE};
+  uint32_t tx_max_age_{0};
+  uint32_t tx_first_time_{0};
+
+  /* pre-serialized topic negotiation burst, 0 length = not built yet */
+  uint8_t negotiation_cache_[NEGOTIATION_CACHE_SIZE > 0 ? NEGOTIATION_CACHE_SIZE : 1] = {0};
+  int negotiation_cache_len_{0};
+
   Publisher * publishers[MAX_PUBLISHERS] = {nullptr};
   Subscriber_ * subscribers[MAX_SUBSCRIBERS] {nullptr};
 
@@ -138,6 +226,11 @@ public:
     bytes_ = 0;
     index_ = 0;
     topic_ = 0;
+    endPayload(false);
+    rx_pos_ = 0;
+    rx_len_ = 0;
+    tx_buffer_.clear();
+    sync_sent_ = 0;
   };
 
   /* Start a named port, which may be network server IP, initialize buffers */
@@ -148,6 +241,11 @@ public:
     bytes_ = 0;
     index_ = 0;
     topic_ = 0;
+    endPayload(false);
+    rx_pos_ = 0;
+    rx_len_ = 0;
+    tx_buffer_.clear();
+    sync_sent_ = 0;
   };
 
   /**
@@ -163,6 +261,54 @@ public:
      spin_timeout_ = timeout;
   }
 
+  /**
+   * @brief Collects the frames published between two spinOnce() calls into
+   * one buffer and hands them to the hardware with a single write at the end
+   * of spinOnce(), or earlier once flush_bytes are pending or the oldest
+   * pending frame is max_age milliseconds old. Requires TX_BUFFER_SIZE > 0.
+   * @return false if the node handle has no TX buffer.
+   */
+  bool setTxBatching(bool enable, int flush_bytes = TX_BUFFER_SIZE, uint32_t max_age = 20)
+  {
+    if (TX_BUFFER_SIZE <= 0)
+      return false;
+    if (!enable)
+      flush();
+    tx_batching_ = enable;
+    tx_flush_bytes_ = flush_bytes < TX_BUFFER_SIZE ? flush_bytes : TX_BUFFER_SIZE;
+    tx_max_age_ = max_age;
+    return true;
+  }
+
+  /*
+   * Write pending frames to the hardware. Hardware with a non-blocking
+   * writeSome() only gets what the connection accepts right now, the rest
+   * stays queued for the next flush.
+   */
+  void flush()
+  {
+    if (tx_buffer_.size() > 0)
+      flushPending(BoolTag<HasWriteSome<Hardware>::value>());
+  }
+
+  /* Received frames skipped because they did not fit INPUT_SIZE. */
+  uint32_t getRxSkipped() const
+  {
+    return rx_skipped_;
+  }
+
+  /* Frames dropped because the TX buffer was full or the link failed. */
+  uint32_t getTxDropped() const
+  {
+    return tx_buffer_.dropped();
+  }
+
+  /* Latest-only frames that were replaced by a newer one before sending. */
+  uint32_t getTxReplaced() const
+  {
+    return tx_buffer_.replaced();
+  }
+
 protected:
   // State machine variables for spinOnce
   int mode_{0};
@@ -171,6 +317,12 @@ protected:
   int index_{0};
   int checksum_{0};
 
+  /* frames larger than INPUT_SIZE are streamed to a decoder or skipped */
+  StreamDecoder* stream_{nullptr};
+  bool skip_frame_{false};
+  uint32_t rx_skipped_{0};
+  bool stream_input_{false};
+
   bool configured_{false};
 
   /* used for syncing the time */
@@ -178,6 +330,12 @@ protected:
   uint32_t last_sync_receive_time{0};
   uint32_t last_msg_timeout_time{0};
 
+  /* liveness check, a timeout of 0 disables it */
+  uint32_t liveness_timeout_{0};
+  uint32_t liveness_probe_{0};
+  uint32_t last_rx_time_{0};
+  uint32_t last_probe_time_{0};
+
 public:
   /* This function goes in your loop() function, it handles
    *  serial input and callbacks for subscribers.
@@ -185,6 +343,14 @@ public:
 
 
   virtual int spinOnce() override
+  {
+    int rv = spinInput();
+    flush();
+    return rv;
+  }
+
+protected:
+  int spinInput()
   {
     /* restart if timed out */
     uint32_t c_time = hardware_.time();
@@ -192,147 +358,368 @@ public:
     {
       configured_ = false;
     }
+    if (configured_ && liveness_timeout_ > 0)
+      checkLiveness(c_time);
 
     /* reset if message has timed out */
     if (mode_ != MODE_FIRST_FF)
     {
-      if (c_time > last_msg_timeout_time)
+      if ((int32_t)(c_time - last_msg_timeout_time) > 0)
       {
         mode_ = MODE_FIRST_FF;
+        endPayload(false);
       }
     }
 
     /* while available buffer, read data */
+    int rv = receive(c_time, BoolTag<HasBulkRead<Hardware>::value>());
+    if (rv != SPIN_OK)
+      return rv;
+
+    /* occasionally sync time, and retry a request that got lost */
+    if (configured_ && ((c_time - last_sync_time) > (SYNC_SECONDS * 500) || sync_sent_ > 0))
+    {
+      requestSyncTime();
+      last_sync_time = c_time;
+    }
+
+    return SPIN_OK;
+  }
+
+  void flushPending(BoolTag<false>)
+  {
+    hardware_.write(tx_buffer_.pending(), tx_buffer_.size());
+    tx_buffer_.consume(tx_buffer_.size());
+  }
+
+  void flushPending(BoolTag<true>)
+  {
+    int n = hardware_.writeSome(tx_buffer_.pending(), tx_buffer_.size());
+    if (n < 0)
+      tx_buffer_.clear();
+    else if (n > 0)
+      tx_buffer_.consume(n);
+  }
+
+  /*
+   * Declare the link dead if no valid frame arrived for liveness_timeout_.
+   * A quiet but healthy host is probed with a time request, which it
+   * answers right away.
+   */
+  void checkLiveness(uint32_t c_time)
+  {
+    uint32_t silent = c_time - last_rx_time_;
+    if (silent > liveness_timeout_)
+    {
+      configured_ = false;
+    }
+    else if (silent >= liveness_probe_ && (c_time - last_probe_time_) >= liveness_probe_)
+    {
+      requestSyncTime();
+      last_probe_time_ = c_time;
+    }
+  }
+
+  /* If a timeout has been specified, check how long spinOnce has been running. */
+  bool spinTimedOut(uint32_t c_time)
+  {
+    // If the maximum processing timeout has been exceeded, exit with error.
+    // The next spinOnce can continue where it left off, or optionally
+    // based on the application in use, the hardware buffer could be flushed
+    // and start fresh.
+    return spin_timeout_ > 0 && (hardware_.time() - c_time) > spin_timeout_;
+  }
+
+  /* Byte-wise receive path for hardware that only offers read(). */
+  int receive(uint32_t c_time, BoolTag<false>)
+  {
     while (true)
     {
-      // If a timeout has been specified, check how long spinOnce has been running.
-      if (spin_timeout_ > 0)
-      {
-        // If the maximum processing timeout has been exceeded, exit with error.
-        // The next spinOnce can continue where it left off, or optionally
-        // based on the application in use, the hardware buffer could be flushed
-        // and start fresh.
-        if ((hardware_.time() - c_time) > spin_timeout_)
-        {
-          // Exit the spin, processing timeout exceeded.
-          return SPIN_TIMEOUT;
-        }
-      }
+      if (spinTimedOut(c_time))
+        return SPIN_TIMEOUT;
       int data = hardware_.read();
       if (data < 0)
         break;
-      checksum_ += data;
-      if (mode_ == MODE_MESSAGE)          /* message data being recieved */
+      int rv = processByte(data, c_time);
+      if (rv != SPIN_OK)
+        return rv;
+    }
+    return SPIN_OK;
+  }
+
+  /* Bulk receive path: pull a chunk at a time and parse it in place. */
+  int receive(uint32_t c_time, BoolTag<true>)
+  {
+    while (true)
+    {
+      if (spinTimedOut(c_time))
+        return SPIN_TIMEOUT;
+      if (rx_pos_ >= rx_len_)
       {
-        message_in[index_++] = data;
-        bytes_--;
-        if (bytes_ == 0)                 /* is message complete? if so, checksum */
-          mode_ = MODE_MSG_CHECKSUM;
+        int n = hardware_.read(rx_chunk_, sizeof(rx_chunk_));
+        if (n <= 0)
+          break;
+        rx_pos_ = 0;
+        rx_len_ = n;
       }
-      else if (mode_ == MODE_FIRST_FF)
+      int rv = processChunk(c_time);
+      if (rv != SPIN_OK)
+        return rv;
+    }
+    return SPIN_OK;
+  }
+
+  /*
+   * Parse the unconsumed part of rx_chunk_. Sync bytes are searched with
+   * memchr, a frame header that is all in the chunk is read at once and
+   * message payloads are copied in one go. Everything else runs through
+   * the byte-wise state machine. Bytes left over when a frame asks
+   * spinOnce to return stay in rx_chunk_ for the next call.
+   */
+  int processChunk(uint32_t c_time)
+  {
+    while (rx_pos_ < rx_len_)
+    {
+      if (mode_ == MODE_FIRST_FF && rx_chunk_[rx_pos_] == 0xff && rx_len_ - rx_pos_ >= 7
+          && rx_chunk_[rx_pos_ + 1] == PROTOCOL_VER)
       {
-        if (data == 0xff)
-        {
-          mode_++;
-          last_msg_timeout_time = c_time + SERIAL_MSG_TIMEOUT;
-        }
-        else if (hardware_.time() - c_time > (SYNC_SECONDS * 1000))
-        {
-          /* We have been stuck in spinOnce too long, return error */
-          configured_ = false;
-          return SPIN_TIMEOUT;
-        }
+        processHeader(rx_chunk_ + rx_pos_, c_time);
+        continue;
       }
-      else if (mode_ == MODE_PROTOCOL_VER)
+      if (mode_ == MODE_FIRST_FF && rx_chunk_[rx_pos_] != 0xff)
       {
-        if (data == PROTOCOL_VER)
+        const uint8_t* sync = (const uint8_t*) memchr(rx_chunk_ + rx_pos_, 0xff, rx_len_ - rx_pos_);
+        if (sync == nullptr)
         {
-          mode_++;
-        }
-        else
-        {
-          mode_ = MODE_FIRST_FF;
-          if (configured_ == false)
-            requestSyncTime();  /* send a msg back showing our protocol version */
+          rx_pos_ = rx_len_;
+          if (hardware_.time() - c_time > (SYNC_SECONDS * 1000))
+          {
+            /* We have been stuck in spinOnce too long, return error */
+            configured_ = false;
+            return SPIN_TIMEOUT;
+          }
+          break;
         }
+        rx_pos_ = sync - rx_chunk_;
       }
-      else if (mode_ == MODE_SIZE_L)      /* bottom half of message size */
+      else if (mode_ == MODE_MESSAGE)
       {
-        bytes_ = data;
-        index_ = 0;
-        mode_++;
-        checksum_ = data;               /* first byte for calculating size checksum */
+        int n = rx_len_ - rx_pos_;
+        if (n > bytes_)
+          n = bytes_;
+        const uint8_t* src = rx_chunk_ + rx_pos_;
+        storePayload(src, n, c_time);
+        for (int i = 0; i < n; i++)
+          checksum_ += src[i];
+        index_ += n;
+        bytes_ -= n;
+        rx_pos_ += n;
+        if (bytes_ == 0)
+          mode_ = MODE_MSG_CHECKSUM;
+        continue;
       }
-      else if (mode_ == MODE_SIZE_H)      /* top half of message size */
+      int rv = processByte(rx_chunk_[rx_pos_++], c_time);
+      if (rv != SPIN_OK)
+        return rv;
+    }
+    return SPIN_OK;
+  }
+
+  /*
+   * The 7 header bytes of a frame, sync and protocol version already
+   * checked. Same result as feeding them to processByte() one by one.
+   */
+  void processHeader(const uint8_t* h, uint32_t c_time)
+  {
+    last_msg_timeout_time = c_time + SERIAL_MSG_TIMEOUT;
+    if ((h[2] + h[3] + h[4]) % 256 != 255)
+    {
+      rx_pos_ += 5;  /* Abandon the frame if the msg len is wrong */
+      return;
+    }
+    bytes_ = h[2] | (h[3] << 8);
+    index_ = 0;
+    topic_ = h[5] | (h[6] << 8);
+    checksum_ = h[5] + h[6];
+    rx_pos_ += 7;
+    beginPayload();
+    mode_ = bytes_ ? MODE_MESSAGE : MODE_MSG_CHECKSUM;
+  }
+
+  /* Advance the frame state machine by one byte. */
+  int processByte(int data, uint32_t c_time)
+  {
+    checksum_ += data;
+    if (mode_ == MODE_MESSAGE)          /* message data being recieved */
+    {
+      uint8_t byte = data;
+      storePayload(&byte, 1, c_time);
+      index_++;
+      bytes_--;
+      if (bytes_ == 0)                 /* is message complete? if so, checksum */
+        mode_ = MODE_MSG_CHECKSUM;
+    }
+    else if (mode_ == MODE_FIRST_FF)
+    {
+      if (data == 0xff)
       {
-        bytes_ += data << 8;
         mode_++;
+        last_msg_timeout_time = c_time + SERIAL_MSG_TIMEOUT;
       }
-      else if (mode_ == MODE_SIZE_CHECKSUM)
+      else if (hardware_.time() - c_time > (SYNC_SECONDS * 1000))
       {
-        if ((checksum_ % 256) == 255)
-          mode_++;
-        else
-          mode_ = MODE_FIRST_FF;          /* Abandon the frame if the msg len is wrong */
+        /* We have been stuck in spinOnce too long, return error */
+        configured_ = false;
+        return SPIN_TIMEOUT;
       }
-      else if (mode_ == MODE_TOPIC_L)     /* bottom half of topic id */
+    }
+    else if (mode_ == MODE_PROTOCOL_VER)
+    {
+      if (data == PROTOCOL_VER)
       {
-        topic_ = data;
         mode_++;
-        checksum_ = data;               /* first byte included in checksum */
       }
-      else if (mode_ == MODE_TOPIC_H)     /* top half of topic id */
+      else
       {
-        topic_ += data << 8;
-        mode_ = MODE_MESSAGE;
-        if (bytes_ == 0)
-          mode_ = MODE_MSG_CHECKSUM;
+        mode_ = MODE_FIRST_FF;
+        if (configured_ == false)
+          requestSyncTime();  /* send a msg back showing our protocol version */
       }
-      else if (mode_ == MODE_MSG_CHECKSUM)    /* do checksum */
+    }
+    else if (mode_ == MODE_SIZE_L)      /* bottom half of message size */
+    {
+      bytes_ = data;
+      index_ = 0;
+      mode_++;
+      checksum_ = data;               /* first byte for calculating size checksum */
+    }
+    else if (mode_ == MODE_SIZE_H)      /* top half of message size */
+    {
+      bytes_ += data << 8;
+      mode_++;
+    }
+    else if (mode_ == MODE_SIZE_CHECKSUM)
+    {
+      if ((checksum_ % 256) == 255)
+        mode_++;
+      else
+        mode_ = MODE_FIRST_FF;          /* Abandon the frame if the msg len is wrong */
+    }
+    else if (mode_ == MODE_TOPIC_L)     /* bottom half of topic id */
+    {
+      topic_ = data;
+      mode_++;
+      checksum_ = data;               /* first byte included in checksum */
+    }
+    else if (mode_ == MODE_TOPIC_H)     /* top half of topic id */
+    {
+      topic_ += data << 8;
+      beginPayload();
+      mode_ = MODE_MESSAGE;
+      if (bytes_ == 0)
+        mode_ = MODE_MSG_CHECKSUM;
+    }
+    else if (mode_ == MODE_MSG_CHECKSUM)    /* do checksum */
+    {
+      mode_ = MODE_FIRST_FF;
+      bool valid = (checksum_ % 256) == 255;
+      if (stream_ || skip_frame_)
       {
-        mode_ = MODE_FIRST_FF;
-        if ((checksum_ % 256) == 255)
-        {
-          if (topic_ == TopicInfo::ID_PUBLISHER)
-          {
-            requestSyncTime();
-            negotiateTopics();
-            last_sync_time = c_time;
-            last_sync_receive_time = c_time;
-            return SPIN_ERR;
-          }
-          else if (topic_ == TopicInfo::ID_TIME)
-          {
-            syncTime(message_in);
-          }
-          else if (topic_ == TopicInfo::ID_PARAMETER_REQUEST)
-          {
-            req_param_resp.deserialize(message_in);
-            param_received = true;
-          }
-          else if (topic_ == TopicInfo::ID_TX_STOP)
-          {
-            configured_ = false;
-          }
-          else
-          {
-            if (subscribers[topic_ - 100])
-              subscribers[topic_ - 100]->callback(message_in);
-          }
-        }
+        if (valid)
+          last_rx_time_ = c_time;
+        endPayload(valid);
       }
+      else if (valid)
+      {
+        return handleFrame(c_time);
+      }
+    }
+    return SPIN_OK;
+  }
+
+  /*
+   * Decide where the payload of the frame whose header was just read goes:
+   * the stream decoder of its subscriber, message_in if it fits, or
+   * nowhere. Skipped frames are still consumed byte by byte, so their
+   * content can not be mistaken for the start of another frame.
+   */
+  void beginPayload()
+  {
+    Subscriber_* s = subscriberFor(topic_);
+    if (s)
+      stream_ = s->getStreamDecoder();
+    if (stream_)
+      stream_->begin(bytes_);
+    else if (bytes_ > INPUT_SIZE)
+    {
+      skip_frame_ = true;
+      rx_skipped_++;
+    }
+  }
+
+  void storePayload(const uint8_t* data, int length, uint32_t c_time)
+  {
+    if (!stream_ && !skip_frame_)
+    {
+      memcpy(message_in + index_, data, length);
+      return;
     }
+    if (stream_)
+      stream_->feed(data, length);
+    /* large frames only time out when they stop making progress */
+    last_msg_timeout_time = c_time + SERIAL_MSG_TIMEOUT;
+  }
+
+  void endPayload(bool valid)
+  {
+    if (stream_)
+      stream_->end(valid);
+    stream_ = nullptr;
+    skip_frame_ = false;
+  }
+
+  /* Subscriber registered for a topic id, null for ids the host made up. */
+  Subscriber_* subscriberFor(int topic)
+  {
+    int i = topic - 100;
+    return i >= 0 && i < MAX_SUBSCRIBERS ? subscribers[i] : nullptr;
+  }
 
-    /* occasionally sync time */
-    if (configured_ && ((c_time - last_sync_time) > (SYNC_SECONDS * 500)))
+  /* Dispatch a complete, checksum verified frame. */
+  int handleFrame(uint32_t c_time)
+  {
+    last_rx_time_ = c_time;
+    if (topic_ == TopicInfo::ID_PUBLISHER)
     {
       requestSyncTime();
+      negotiateTopics();
       last_sync_time = c_time;
+      last_sync_receive_time = c_time;
+      return SPIN_ERR;
+    }
+    else if (topic_ == TopicInfo::ID_TIME)
+    {
+      syncTime(message_in);
+    }
+    else if (topic_ == TopicInfo::ID_PARAMETER_REQUEST)
+    {
+      req_param_resp.deserialize(message_in);
+      param_received = true;
+    }
+    else if (topic_ == TopicInfo::ID_TX_STOP)
+    {
+      configured_ = false;
+    }
+    else
+    {
+      Subscriber_* s = subscriberFor(topic_);
+      if (s)
+        s->receive(message_in, index_);
     }
-
     return SPIN_OK;
   }
 
+public:
 
   /* Are we connected to the PC? */
   virtual bool connected() override
@@ -340,55 +727,193 @@ public:
     return configured_;
   };
 
+  /*
+   * Detect a dead host within timeout ms instead of the time sync timeout.
+   * After probe ms without input the host is probed. The host has to
+   * answer within the remaining time, so probe should be well below
+   * timeout. A timeout of 0 turns the check off.
+   */
+  void setLiveness(uint32_t timeout, uint32_t probe)
+  {
+    liveness_timeout_ = timeout;
+    liveness_probe_ = probe;
+  }
+
+  /* hardware_.time() when the last valid frame was received */
+  uint32_t getLastRxTime() const
+  {
+    return last_rx_time_;
+  }
+
   /********************************************************************
    * Time functions
    */
 
+  /*
+   * The host's replies carry no reference to their request. So while one
+   * is unanswered no other is sent, its reply also serves as a liveness
+   * probe. After SYNC_REPLY_TIMEOUT it is given up as lost and spinOnce()
+   * sends a new one; the next reply could belong to either request and is
+   * not used for the clock.
+   */
   void requestSyncTime()
   {
+    if (sync_sent_ > 0 && timeUs() - rt_time < SYNC_REPLY_TIMEOUT)
+      return;
     std_msgs::Time t;
-    publish(TopicInfo::ID_TIME, &t);
-    rt_time = hardware_.time();
+    publishMsg(TopicInfo::ID_TIME, t);
+    flush();  /* the round trip starts when the request leaves */
+    rt_time = timeUs();
+    if (sync_sent_ < 255)
+      sync_sent_++;
   }
 
+  /*
+   * NTP style sync: the host stamps its reply about half way through the
+   * round trip. Round trips much slower than the best recent one are
+   * treated as outliers, implausibly fast ones as stale replies. Accepted
+   * samples slew the offset and update the drift estimate, which is
+   * measured over a baseline of up to SYNC_DRIFT_WINDOW.
+   */
   void syncTime(uint8_t * data)
   {
     std_msgs::Time t;
-    uint32_t offset = hardware_.time() - rt_time;
-
+    uint64_t t_recv = timeUs();
     t.deserialize(data);
-    t.data.sec += offset / 1000;
-    t.data.nsec += (offset % 1000) * 1000000UL;
-
-    this->setNow(t.data);
+    uint32_t rtt = (uint32_t)(t_recv - rt_time);
+    int64_t offset = (int64_t)(t.data.toUSec() + rtt / 2) - (int64_t)t_recv;
     last_sync_receive_time = hardware_.time();
+    uint8_t sent = sync_sent_;
+    sync_sent_ = 0;
+    if (sent != 1 || rtt < SYNC_MIN_RTT)
+      return;
+
+    sync_samples_[sync_next_].rtt = rtt;
+    sync_samples_[sync_next_].offset = offset;
+    sync_next_ = (sync_next_ + 1) % SYNC_SAMPLES;
+    if (sync_count_ < SYNC_SAMPLES)
+      sync_count_++;
+    uint32_t best_rtt = rtt;
+    for (int i = 0; i < sync_count_; i++)
+    {
+      if (sync_samples_[i].rtt < best_rtt)
+        best_rtt = sync_samples_[i].rtt;
+    }
+    if (time_synced_ && rtt > 2 * best_rtt + SYNC_RTT_SLACK)
+      return;
+
+    sync_rtt_ = rtt;
+    if (!time_synced_)
+    {
+      time_offset_ = offset;
+      time_offset_ref_ = t_recv;
+      drift_ref_offset_ = offset;
+      drift_ref_time_ = t_recv;
+      time_synced_ = true;
+      return;
+    }
+
+    int64_t predicted = currentOffset(t_recv);
+    int64_t error = offset - predicted;
+    if (error > SYNC_STEP_LIMIT || error < -SYNC_STEP_LIMIT)
+    {
+      /* host clock jumped, start over */
+      time_offset_ = offset;
+      drift_ppb_ = 0;
+      drift_ref_offset_ = offset;
+      drift_ref_time_ = t_recv;
+    }
+    else
+    {
+      time_offset_ = predicted + error / 4;
+      uint64_t baseline = t_recv - drift_ref_time_;
+      if (baseline >= 10000000ULL)
+      {
+        int64_t drift = (offset - drift_ref_offset_) * 1000000000LL / (int64_t) baseline;
+        if (drift > SYNC_MAX_DRIFT)
+          drift = SYNC_MAX_DRIFT;
+        if (drift < -SYNC_MAX_DRIFT)
+          drift = -SYNC_MAX_DRIFT;
+        drift_ppb_ = (int32_t) drift;
+      }
+      if (baseline >= SYNC_DRIFT_WINDOW)
+      {
+        drift_ref_offset_ = time_offset_;
+        drift_ref_time_ = t_recv;
+      }
+    }
+    time_offset_ref_ = t_recv;
+  }
+
+  /* Local monotonic time in microseconds. */
+  uint64_t timeUs()
+  {
+    return timeUs(BoolTag<HasTimeUs<Hardware>::value>());
+  }
+
+  /* Synchronized ROS time in microseconds for a local timeUs() value. */
+  uint64_t rosTimeUs(uint64_t local)
+  {
+    return local + currentOffset(local);
   }
 
   Time now()
   {
-    uint32_t ms = hardware_.time();
     Time current_time;
-    current_time.sec = ms / 1000 + sec_offset;
-    current_time.nsec = (ms % 1000) * 1000000UL + nsec_offset;
-    normalizeSecNSec(current_time.sec, current_time.nsec);
+    current_time.fromUSec(rosTimeUs(timeUs()));
     return current_time;
   }
 
   void setNow(const Time & new_now)
   {
-    uint32_t ms = hardware_.time();
-    sec_offset = new_now.sec - ms / 1000 - 1;
-    nsec_offset = new_now.nsec - (ms % 1000) * 1000000UL + 1000000000UL;
-    normalizeSecNSec(sec_offset, nsec_offset);
+    uint64_t local = timeUs();
+    time_offset_ = (int64_t) new_now.toUSec() - (int64_t) local;
+    time_offset_ref_ = local;
+    time_synced_ = true;
+  }
+
+  /* Round trip time of the last accepted time sync in us. */
+  uint32_t getSyncRtt() const
+  {
+    return sync_rtt_;
+  }
+
+  /* Estimated drift of the host clock against ours in ppb. */
+  int32_t getClockDrift() const
+  {
+    return drift_ppb_;
   }
 
+protected:
+  int64_t currentOffset(uint64_t local)
+  {
+    int64_t elapsed = (int64_t)(local - time_offset_ref_);
+    return time_offset_ + elapsed * drift_ppb_ / 1000000000LL;
+  }
+
+  uint64_t timeUs(BoolTag<true>)
+  {
+    return hardware_.time_us();
+  }
+
+  uint64_t timeUs(BoolTag<false>)
+  {
+    return micros64();
+  }
+
+public:
   /********************************************************************
    * Topic Management
    */
 
-  /* Register a new publisher */
+  /* Register a new publisher. Registering it again is a no-op. */
   bool advertise(Publisher & p)
   {
+    for (int i = 0; i < MAX_PUBLISHERS; i++)
+    {
+      if (publishers[i] == &p)
+        return true;
+    }
     for (int i = 0; i < MAX_PUBLISHERS; i++)
     {
       if (publishers[i] == 0) // empty slot
@@ -396,21 +921,41 @@ public:
         publishers[i] = &p;
         p.id_ = i + 100 + MAX_SUBSCRIBERS;
         p.nh_ = this;
+        negotiation_cache_len_ = 0;
+        announceTopic(i);
         return true;
       }
     }
     return false;
   }
 
-  /* Register a new subscriber */
+  /* Register a publisher that keeps its serialized frame and patches it. */
+  template<typename MsgT, int SIZE>
+  bool advertise(FramePublisher<MsgT, SIZE> & p)
+  {
+    p.build_ = &NodeHandle_::buildStatic<MsgT>;
+    p.write_ = &NodeHandle_::writeStatic;
+    return advertise(static_cast<Publisher &>(p));
+  }
+
+  /* Register a new subscriber. Registering it again is a no-op. */
   bool subscribe(Subscriber_& s)
   {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++)
+    {
+      if (subscribers[i] == &s)
+        return true;
+    }
     for (int i = 0; i < MAX_SUBSCRIBERS; i++)
     {
       if (subscribers[i] == 0) // empty slot
       {
         subscribers[i] = &s;
         s.id_ = i + 100;
+        if (s.getStreamDecoder())
+          stream_input_ = true;
+        negotiation_cache_len_ = 0;
+        announceTopic(i + MAX_PUBLISHERS);
         return true;
       }
     }
@@ -435,73 +980,251 @@ public:
     return v && w;
   }
 
+  /*
+   * Answer a topic request from the host. The TopicInfo frames only change
+   * when topics are registered, so with a NEGOTIATION_CACHE_SIZE the burst
+   * is serialized once and replayed as a single write on reconnects. If it
+   * does not fit, every frame is serialized and published on its own.
+   */
   void negotiateTopics()
+  {
+    if (NEGOTIATION_CACHE_SIZE > 0 && negotiation_cache_len_ == 0)
+    {
+      int len = negotiateTopics(negotiation_cache_, NEGOTIATION_CACHE_SIZE);
+      negotiation_cache_len_ = len > 0 ? len : -1; // -1: does not fit, don't retry
+    }
+    if (negotiation_cache_len_ > 0)
+      writeFrame(TopicInfo::ID_PUBLISHER, negotiation_cache_, negotiation_cache_len_);
+    else
+      negotiateTopics(nullptr, 0);
+    configured_ = true;
+  }
+
+protected:
+  /*
+   * Serialize the TopicInfo frames of all topics into cache, or publish
+   * them one by one if cache is null. Returns the cached length, 0 if the
+   * frames did not fit.
+   */
+  int negotiateTopics(uint8_t* cache, int cache_size)
   {
     rosserial_msgs::TopicInfo ti;
-    int i;
-    for (i = 0; i < MAX_PUBLISHERS; i++)
+    int cache_len = 0;
+    for (int i = 0; i < MAX_PUBLISHERS + MAX_SUBSCRIBERS; i++)
     {
-      if (publishers[i] != 0) // non-empty slot
+      int endpoint = topicInfo(i, ti);
+      if (endpoint < 0) // empty slot
+        continue;
+      if (cache == nullptr)
       {
-        ti.topic_id = publishers[i]->id_;
-        ti.topic_name = (char *) publishers[i]->topic_;
-        ti.message_type = (char *) publishers[i]->msg_->getType();
-        ti.md5sum = (char *) publishers[i]->msg_->getMD5();
-        ti.buffer_size = OUTPUT_SIZE;
-        publish(publishers[i]->getEndpointType(), &ti);
+        publishMsg(endpoint, ti);
+        continue;
       }
+      int l = serializeFrame(endpoint, ti);
+      if (l < 0 || cache_len + l > cache_size)
+        return 0;
+      memcpy(cache + cache_len, message_out, l);
+      cache_len += l;
     }
-    for (i = 0; i < MAX_SUBSCRIBERS; i++)
+    return cache_len;
+  }
+
+  /*
+   * Topics registered while connected, e.g. a subscription made at
+   * runtime, are negotiated on their own right away.
+   */
+  void announceTopic(int i)
+  {
+    if (!configured_)
+      return;
+    rosserial_msgs::TopicInfo ti;
+    int endpoint = topicInfo(i, ti);
+    if (endpoint >= 0)
+      publishMsg(endpoint, ti);
+  }
+
+  /*
+   * Fill ti for publisher slot i, or subscriber slot i - MAX_PUBLISHERS.
+   * Returns the endpoint type, -1 for an empty slot.
+   */
+  int topicInfo(int i, rosserial_msgs::TopicInfo & ti)
+  {
+    if (i < MAX_PUBLISHERS)
     {
-      if (subscribers[i] != 0) // non-empty slot
-      {
-        ti.topic_id = subscribers[i]->id_;
-        ti.topic_name = (char *) subscribers[i]->topic_;
-        ti.message_type = (char *) subscribers[i]->getMsgType();
-        ti.md5sum = (char *) subscribers[i]->getMsgMD5();
-        ti.buffer_size = INPUT_SIZE;
-        publish(subscribers[i]->getEndpointType(), &ti);
-      }
+      Publisher* pub = publishers[i];
+      if (pub == 0)
+        return -1;
+      ti.topic_id = pub->id_;
+      ti.topic_name = (char *) pub->topic_;
+      ti.message_type = (char *) pub->msg_->getType();
+      ti.md5sum = (char *) pub->msg_->getMD5();
+      ti.buffer_size = OUTPUT_SIZE;
+      return pub->getEndpointType();
     }
-    configured_ = true;
+    Subscriber_* sub = subscribers[i - MAX_PUBLISHERS];
+    if (sub == 0)
+      return -1;
+    ti.topic_id = sub->id_;
+    ti.topic_name = (char *) sub->topic_;
+    ti.message_type = (char *) sub->getMsgType();
+    ti.md5sum = (char *) sub->getMsgMD5();
+    /* rosserial_python applies one subscriber buffer size to all topics */
+    ti.buffer_size = stream_input_ ? MAX_FRAME_PAYLOAD : INPUT_SIZE;
+    return sub->getEndpointType();
   }
 
-  virtual int publish(int id, const Msg * msg) override
+  /*
+   * Build a complete frame for msg in message_out. Returns its length, or
+   * -1 without touching the buffer if it does not fit.
+   */
+  template<typename M>
+  int serializeFrame(int id, const M & msg)
   {
-    if (id >= 100 && !configured_)
-      return 0;
+    return serializeFrame(id, msg, message_out, OUTPUT_SIZE);
+  }
+
+  /* Same as above into a buffer of size bytes. */
+  template<typename M>
+  static int serializeFrame(int id, const M & msg, uint8_t* out, int size)
+  {
+    if (serializedLengthMsg(msg) + FRAME_OVERHEAD > size)
+      return -1;
 
     /* serialize message */
-    int l = msg->serialize(message_out + 7);
+    int l = serializeMsg(msg, out + 7);
 
     /* setup the header */
-    message_out[0] = 0xff;
-    message_out[1] = PROTOCOL_VER;
-    message_out[2] = (uint8_t)((uint16_t)l & 255);
-    message_out[3] = (uint8_t)((uint16_t)l >> 8);
-    message_out[4] = 255 - ((message_out[2] + message_out[3]) % 256);
-    message_out[5] = (uint8_t)((int16_t)id & 255);
-    message_out[6] = (uint8_t)((int16_t)id >> 8);
+    out[0] = 0xff;
+    out[1] = PROTOCOL_VER;
+    out[2] = (uint8_t)((uint16_t)l & 255);
+    out[3] = (uint8_t)((uint16_t)l >> 8);
+    out[4] = 255 - ((out[2] + out[3]) % 256);
+    out[5] = (uint8_t)((int16_t)id & 255);
+    out[6] = (uint8_t)((int16_t)id >> 8);
 
     /* calculate checksum */
     int chk = 0;
     for (int i = 5; i < l + 7; i++)
-      chk += message_out[i];
+      chk += out[i];
     l += 7;
-    message_out[l++] = 255 - (chk % 256);
+    out[l++] = 255 - (chk % 256);
+
+    return l;
+  }
 
-    if (l <= OUTPUT_SIZE)
+public:
+  /*
+   * OUTPUT_SIZE needed by the registered topics: their negotiation frames
+   * and the current content of every publisher's message. Call it once
+   * the messages are set up to check or tune the buffer size.
+   */
+  int getRequiredOutputSize()
+  {
+    rosserial_msgs::TopicInfo ti;
+    int size = 0;
+    for (int i = 0; i < MAX_PUBLISHERS + MAX_SUBSCRIBERS; i++)
     {
-      hardware_.write(message_out, l);
+      if (topicInfo(i, ti) < 0)
+        continue;
+      if (ti.serializedLength() > size)
+        size = ti.serializedLength();
+      if (i < MAX_PUBLISHERS && publishers[i]->msg_->serializedLength() > size)
+        size = publishers[i]->msg_->serializedLength();
+    }
+    return size + FRAME_OVERHEAD;
+  }
+
+  virtual int publish(int id, const Msg * msg) override
+  {
+    return publishMsg(id, *msg);
+  }
+
+  /*
+   * Publish a message of static type M. For a concrete message class the
+   * codec is called directly, for ros::Msg through its vtable.
+   */
+  template<typename M>
+  int publishMsg(int id, const M & msg)
+  {
+    if (id >= 100 && !configured_)
+      return 0;
+
+    int l = serializeFrame(id, msg);
+    if (l > 0)
+    {
+      writeFrame(id, message_out, l);
       return l;
     }
     else
     {
-      logerror("Message from device dropped: message larger than buffer.");
+      /* a log message that does not fit must not report itself */
+      if (id != TopicInfo::ID_LOG)
+        logerror("Message from device dropped: message larger than buffer.");
       return -1;
     }
   }
 
+protected:
+  /*
+   * Queue a complete frame and write it right away unless batching. Frames
+   * of latest-only publishers replace their unsent predecessor. Without a
+   * TX buffer frames go straight to the hardware.
+   */
+  void writeFrame(int id, uint8_t* frame, int length)
+  {
+    if (TX_BUFFER_SIZE <= 0)
+    {
+      hardware_.write(frame, length);
+      return;
+    }
+    bool latest = isLatestOnly(id);
+    if (!tx_buffer_.append(id, frame, length, latest))
+    {
+      flush();
+      if (!tx_buffer_.append(id, frame, length, latest))
+      {
+        if (tx_buffer_.size() == 0 && length > tx_buffer_.capacity())
+          hardware_.write(frame, length);
+        else
+          tx_buffer_.countDropped();
+        return;
+      }
+    }
+    if (!tx_batching_)
+    {
+      flush();
+      return;
+    }
+    uint32_t c_time = hardware_.time();
+    if (tx_buffer_.size() == length)
+      tx_first_time_ = c_time;
+    if (tx_buffer_.size() >= tx_flush_bytes_ || (c_time - tx_first_time_) >= tx_max_age_)
+      flush();
+  }
+
+  template<typename MsgT>
+  static int buildStatic(int id, const MsgT & msg, uint8_t* frame, int size)
+  {
+    return serializeFrame(id, msg, frame, size);
+  }
+
+  /* Send a frame built by a FramePublisher. */
+  static int writeStatic(NodeHandleBase_* nh, int id, uint8_t* frame, int length)
+  {
+    NodeHandle_* self = static_cast<NodeHandle_*>(nh);
+    if (!self->configured_)
+      return 0;
+    self->writeFrame(id, frame, length);
+    return length;
+  }
+
+  bool isLatestOnly(int id)
+  {
+    int i = id - 100 - MAX_SUBSCRIBERS;
+    return i >= 0 && i < MAX_PUBLISHERS && publishers[i] != 0 && publishers[i]->isLatestOnly();
+  }
+
+public:
   /********************************************************************
    * Logging
    */
@@ -512,7 +1235,7 @@ protected:
     rosserial_msgs::Log l;
     l.level = byte;
     l.msg = (char*)msg;
-    publish(rosserial_msgs::TopicInfo::ID_LOG, &l);
+    publishMsg(rosserial_msgs::TopicInfo::ID_LOG, l);
   }
 
 public:
@@ -550,12 +1273,12 @@ protected:
     param_received = false;
     rosserial_msgs::RequestParamRequest req;
     req.name  = (char*)name;
-    publish(TopicInfo::ID_PARAMETER_REQUEST, &req);
+    publishMsg(TopicInfo::ID_PARAMETER_REQUEST, req);
     uint32_t end_time = hardware_.time() + time_out;
     while (!param_received)
     {
       spinOnce();
-      if (hardware_.time() > end_time)
+      if ((int32_t)(hardware_.time() - end_time) > 0)
       {
         logwarn("Failed to get param: timeout expired");
         return false;
@@ -609,7 +1332,11 @@ public:
       {
         //copy it over
         for (int i = 0; i < length; i++)
-          strcpy(param[i], req_param_resp.strings[i]);
+        {
+          const StringView& str = req_param_resp.strings[i];
+          memcpy(param[i], str.data(), str.size());
+          param[i][str.size()] = 0;
+        }
         return true;
       }
       else
@@ -59,6 +59,17 @@ public:
     return endpoint_;
   }
 
+  /* Unsent frames of a latest-only publisher are replaced by newer ones
+   * instead of queuing up when the link is congested. */
+  void setLatestOnly(bool latest)
+  {
+    latest_ = latest;
+  }
+  bool isLatestOnly() const
+  {
+    return latest_;
+  }
+
   const char * topic_;
   Msg *msg_;
   // id_ and no_ are set by NodeHandle when we advertise
@@ -67,6 +78,166 @@ public:
 
 private:
   int endpoint_;
+  bool latest_ = false;
+};
+
+const int FRAME_MAX_FIELDS = 8;   // fields a FramePublisher can patch
+
+/*
+ * Publisher for messages whose shape never changes. The complete frame is
+ * serialized once and kept. Publishing copies only the bound fields into
+ * it and adjusts the checksum by the bytes that changed, then hands the
+ * frame to the node handle. Fields that are not bound keep the value they
+ * had when the frame was built; call rebuild() after changing them.
+ */
+template<typename MsgT, int SIZE>
+class FramePublisher : public Publisher
+{
+public:
+  typedef int (*BuildT)(int id, const MsgT & msg, uint8_t* frame, int size);
+  typedef int (*WriteT)(NodeHandleBase_* nh, int id, uint8_t* frame, int length);
+
+  FramePublisher(const char * topic_name, MsgT * msg, int endpoint = rosserial_msgs::TopicInfo::ID_PUBLISHER) :
+    Publisher(topic_name, msg, endpoint),
+    msg_t_(msg) {};
+
+  /*
+   * Patch field on every publish. field points into the message or to an
+   * array the message points to, count is the number of elements. Its
+   * memory must match the wire format, which holds for the fixed size
+   * types on little endian targets. Returns false if there is no room.
+   */
+  template<typename T>
+  bool bind(T * field, int count = 1)
+  {
+    if (fields_ >= FRAME_MAX_FIELDS)
+      return false;
+    bindings_[fields_].data = (uint8_t*) field;
+    bindings_[fields_].size = sizeof(T) * count;
+    bindings_[fields_].offset = 0;
+    fields_++;
+    length_ = 0;
+    return true;
+  }
+
+  /*
+   * Serialize the frame and find the bound fields in it, needs to be
+   * advertised. publish() does it the first time, call it after changing
+   * fields that are not bound. A field is located by serializing it once
+   * more with its bytes inverted by a pattern: the bytes that differ are
+   * its position, and they have to differ by exactly that pattern.
+   */
+  bool rebuild()
+  {
+    static uint8_t scratch[SIZE];   // not on the stack of the publishing task
+    length_ = build_(id_, *msg_t_, frame_, SIZE);
+    patchable_ = length_ > 0;
+    for (int i = 0; i < fields_ && patchable_; i++)
+    {
+      Binding& b = bindings_[i];
+      invert(b.data, b.size);
+      int l = build_(id_, *msg_t_, scratch, SIZE);
+      invert(b.data, b.size);
+      b.offset = 0;
+      while (b.offset < l && frame_[b.offset] == scratch[b.offset])
+        b.offset++;
+      int end = b.offset + b.size;
+      patchable_ = l == length_ && end < l && memcmp(frame_ + end, scratch + end, l - 1 - end) == 0;
+      for (int k = 0; patchable_ && k < b.size; k++)
+        patchable_ = (uint8_t)(frame_[b.offset + k] ^ scratch[b.offset + k]) == pattern(k);
+    }
+    return length_ > 0;
+  }
+
+  int publish()
+  {
+    if (length_ == 0 && !rebuild())
+      return -1;
+    if (!patchable_)
+    {
+      length_ = build_(id_, *msg_t_, frame_, SIZE);
+      if (length_ <= 0)
+        return -1;
+    }
+    else
+    {
+      uint32_t chk = frame_[length_ - 1];
+      for (int i = 0; i < fields_; i++)
+        chk += patch(frame_ + bindings_[i].offset, bindings_[i].data, bindings_[i].size);
+      frame_[length_ - 1] = (uint8_t) chk;
+    }
+    return write_(nh_, id_, frame_, length_);
+  }
+
+  /* Can bound fields be patched in place? False until the first publish. */
+  bool isPatchable() const
+  {
+    return length_ > 0 && patchable_;
+  }
+
+  // set by NodeHandle when we advertise
+  BuildT build_ = nullptr;
+  WriteT write_ = nullptr;
+
+protected:
+  struct Binding
+  {
+    uint8_t* data;
+    int size;
+    int offset;     // in frame_
+  };
+
+  static uint8_t pattern(int k)
+  {
+    return (uint8_t)(k % 255 + 1);
+  }
+
+  static void invert(uint8_t* data, int size)
+  {
+    for (int k = 0; k < size; k++)
+      data[k] ^= pattern(k);
+  }
+
+  /* Sum of the four bytes of word, in the low byte. */
+  static uint32_t byteSum(uint32_t word)
+  {
+    word = (word & 0x00ff00ff) + ((word >> 8) & 0x00ff00ff);
+    return word + (word >> 16);
+  }
+
+  /*
+   * Copy size bytes from src to dst, a word at a time. Returns how much
+   * the checksum byte changes: the old bytes' sum minus the new ones'.
+   */
+  static uint32_t patch(uint8_t* dst, const uint8_t* src, int size)
+  {
+    uint32_t delta = 0;
+    int k = 0;
+    for (; k + 4 <= size; k += 4)
+    {
+      uint32_t old_word, new_word;
+      memcpy(&old_word, dst + k, 4);
+      memcpy(&new_word, src + k, 4);
+      if (old_word != new_word)
+      {
+        delta += byteSum(old_word) - byteSum(new_word);
+        memcpy(dst + k, &new_word, 4);
+      }
+    }
+    for (; k < size; k++)
+    {
+      delta += dst[k] - src[k];
+      dst[k] = src[k];
+    }
+    return delta;
+  }
+
+  MsgT * msg_t_;
+  Binding bindings_[FRAME_MAX_FIELDS];
+  int fields_ = 0;
+  uint8_t frame_[SIZE];
+  int length_ = 0;
+  bool patchable_ = false;
 };
 
 }
@@ -0,0 +1,292 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_SERIAL_LINK_H_
+#define ROS_SERIAL_LINK_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ARDUINO)
+  #include <Arduino.h>
+#else
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <termios.h>
+  #include <unistd.h>
+#endif
+
+#include "ros/timebase.h"
+
+namespace ros
+{
+
+const int SERIAL_PROBE_SIZE = 64;   // bytes kept while looking for a host
+
+/*
+ * NodeHandle_ hardware for rosserial over a serial port at high baud
+ * rates: a HardwareSerial on Arduino, a tty device elsewhere. Input is
+ * read in bulk, and writeSome() only hands over what the port takes
+ * without blocking.
+ *
+ * probe() tells whether a rosserial host is talking on the port while the
+ * link is not used yet, without losing the host's first frame.
+ */
+class SerialLink
+{
+public:
+#if defined(ARDUINO)
+  void begin(HardwareSerial& port, uint32_t baud)
+  {
+    port_ = &port;
+    port_->begin(baud);
+    pending_len_ = 0;
+    pending_pos_ = 0;
+  }
+
+  void end()
+  {
+    port_ = nullptr;
+  }
+
+  bool isOpen() const
+  {
+    return port_ != nullptr;
+  }
+#else
+  ~SerialLink()
+  {
+    end();
+  }
+
+  /* Open a tty, e.g. one end of a pseudo terminal pair, in raw mode. */
+  bool begin(const char* device, uint32_t baud)
+  {
+    end();
+    fd_ = open(device, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd_ < 0)
+      return false;
+    struct termios tio;
+    if (tcgetattr(fd_, &tio) == 0)
+    {
+      cfmakeraw(&tio);
+      speed_t speed = speedOf(baud);
+      if (speed != B0)
+      {
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+      }
+      tcsetattr(fd_, TCSANOW, &tio);
+    }
+    pending_len_ = 0;
+    pending_pos_ = 0;
+    return true;
+  }
+
+  void end()
+  {
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+  }
+
+  bool isOpen() const
+  {
+    return fd_ >= 0;
+  }
+#endif
+
+  void init()
+  {
+  }
+
+  /* read a byte. -1 = nothing available */
+  int read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+
+  /* read up to length bytes that already arrived. <= 0 = nothing available */
+  int read(uint8_t* data, size_t length)
+  {
+    if (pending_pos_ < pending_len_)
+    {
+      int n = pending_len_ - pending_pos_;
+      if ((size_t) n > length)
+        n = length;
+      memcpy(data, pending_ + pending_pos_, n);
+      pending_pos_ += n;
+      return n;
+    }
+    return readPort(data, length);
+  }
+
+  void write(uint8_t* data, int length)
+  {
+    while (length > 0)
+    {
+      int n = writeSome(data, length);
+      if (n < 0)
+        return;
+      if (n == 0)
+        waitWritable();
+      data += n;
+      length -= n;
+    }
+  }
+
+  /* write as much as the port takes without blocking. < 0 on error */
+  int writeSome(const uint8_t* data, int length)
+  {
+#if defined(ARDUINO)
+    if (port_ == nullptr)
+      return -1;
+    int room = port_->availableForWrite();
+    if (room <= 0)
+      return 0;
+    return port_->write(data, length < room ? length : room);
+#else
+    int n = ::write(fd_, data, length);
+    if (n < 0)
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    return n;
+#endif
+  }
+
+  unsigned long time()
+  {
+    return (unsigned long)(micros64() / 1000);
+  }
+
+  /*
+   * True once the sync bytes of a rosserial frame (0xff, protocol version)
+   * arrived. They and what follows stay queued for read(). Other bytes
+   * are dropped, so only call it while the link is not in use.
+   */
+  bool probe()
+  {
+    if (pending_pos_ > 0)
+    {
+      pending_len_ -= pending_pos_;
+      memmove(pending_, pending_ + pending_pos_, pending_len_);
+      pending_pos_ = 0;
+    }
+    int n = readPort(pending_ + pending_len_, SERIAL_PROBE_SIZE - pending_len_);
+    if (n > 0)
+      pending_len_ += n;
+    for (int i = 0; i + 1 < pending_len_; i++)
+    {
+      if (pending_[i] == 0xff && pending_[i + 1] == 0xfe)  // PROTOCOL_VER2
+      {
+        pending_pos_ = i;
+        return true;
+      }
+    }
+    /* a trailing 0xff may be the start of the sync bytes */
+    bool keep = pending_len_ > 0 && pending_[pending_len_ - 1] == 0xff;
+    pending_len_ = keep ? 1 : 0;
+    pending_[0] = 0xff;
+    return false;
+  }
+
+protected:
+  int readPort(uint8_t* data, size_t length)
+  {
+#if defined(ARDUINO)
+    if (port_ == nullptr)
+      return -1;
+    int n = port_->available();
+    if (n <= 0)
+      return n;
+    if ((size_t) n > length)
+      n = length;
+    return port_->readBytes(data, n);
+#else
+    if (fd_ < 0)
+      return -1;
+    return ::read(fd_, data, length);
+#endif
+  }
+
+  void waitWritable()
+  {
+#if defined(ARDUINO)
+    port_->flush();
+#else
+    struct pollfd p = {fd_, POLLOUT, 0};
+    poll(&p, 1, 10);
+#endif
+  }
+
+#if defined(ARDUINO)
+  HardwareSerial* port_ = nullptr;
+#else
+  static speed_t speedOf(uint32_t baud)
+  {
+    switch (baud)
+    {
+      case 115200:
+        return B115200;
+      case 230400:
+        return B230400;
+#ifdef B921600
+      case 460800:
+        return B460800;
+      case 921600:
+        return B921600;
+      case 1000000:
+        return B1000000;
+      case 1500000:
+        return B1500000;
+      case 2000000:
+        return B2000000;
+#endif
+      default:
+        return B0;
+    }
+  }
+
+  int fd_ = -1;
+#endif
+  uint8_t pending_[SERIAL_PROBE_SIZE];
+  int pending_len_ = 0;
+  int pending_pos_ = 0;
+};
+
+}
+
+#endif
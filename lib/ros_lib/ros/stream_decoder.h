@@ -0,0 +1,215 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_STREAM_DECODER_H_
+#define ROS_STREAM_DECODER_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ros/msg.h"
+
+namespace ros
+{
+
+const uint8_t STREAM_VALUE  = 0;  // count fixed size values, e.g. an int32 or a float64[9]
+const uint8_t STREAM_STRING = 1;  // uint32 length followed by characters
+const uint8_t STREAM_ARRAY  = 2;  // uint32 count followed by fixed size values
+
+/*
+ * One wire field of a message layout for StreamDecoder. Nested messages
+ * are flattened into their fields; arrays of messages can not be
+ * described.
+ */
+struct StreamField
+{
+  uint8_t kind;
+  uint8_t size;     // bytes of one value, at most 8
+  uint16_t count;   // values of a STREAM_VALUE field
+};
+
+/*
+ * Incremental decoder for messages that do not fit into INPUT_SIZE. The
+ * payload is fed in chunks as it arrives and every value is reported
+ * through the on...() callbacks, so a subscriber can reduce a large
+ * message on the fly in constant memory.
+ *
+ * The callbacks run before the frame checksum has been verified.
+ * onEnd() reports whether the frame was intact and matched the layout;
+ * results gathered from an invalid frame should be thrown away.
+ */
+class StreamDecoder
+{
+public:
+  StreamDecoder(const StreamField* layout, int fields) :
+    layout_(layout), fields_(fields)
+  {
+  }
+
+  virtual ~StreamDecoder() {}
+
+  /* Start a frame with a payload of length bytes. */
+  void begin(uint32_t length)
+  {
+    field_ = -1;
+    overrun_ = false;
+    nextField();
+    onBegin(length);
+  }
+
+  void feed(const uint8_t* data, int length)
+  {
+    while (length > 0 && field_ < fields_)
+    {
+      const StreamField& f = layout_[field_];
+      if (want_length_)
+      {
+        int n = take(data, length, 4);
+        data += n;
+        length -= n;
+        if (acc_len_ < 4)
+          break;
+        acc_len_ = 0;
+        remaining_ = ((uint32_t) acc_[0]) | ((uint32_t) acc_[1] << 8) |
+                     ((uint32_t) acc_[2] << 16) | ((uint32_t) acc_[3] << 24);
+        want_length_ = false;
+        onArray(field_, remaining_);
+      }
+      else if (f.kind == STREAM_STRING)
+      {
+        int n = length < (int) remaining_ ? length : (int) remaining_;
+        if (n > 0)
+          onString(field_, (const char*) data, n);
+        data += n;
+        length -= n;
+        remaining_ -= n;
+      }
+      else if (acc_len_ == 0 && length >= f.size)
+      {
+        /* whole value in the chunk, no copy needed */
+        onValue(field_, index_++, data);
+        data += f.size;
+        length -= f.size;
+        remaining_--;
+      }
+      else
+      {
+        int n = take(data, length, f.size);
+        data += n;
+        length -= n;
+        if (acc_len_ < f.size)
+          break;
+        acc_len_ = 0;
+        onValue(field_, index_++, acc_);
+        remaining_--;
+      }
+      if (!want_length_ && remaining_ == 0)
+        nextField();
+    }
+    if (length > 0)
+      overrun_ = true;
+  }
+
+  /* Finish the frame, valid tells whether its checksum matched. */
+  void end(bool valid)
+  {
+    onEnd(valid && !overrun_ && field_ >= fields_);
+  }
+
+  /* Value of a scalar reported to onValue(). */
+  template<typename T>
+  static T value(const uint8_t* bytes)
+  {
+    T v;
+#if ROSSERIAL_LITTLE_ENDIAN
+    memcpy(&v, bytes, sizeof(T));
+#else
+    uint8_t swapped[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++)
+      swapped[i] = bytes[sizeof(T) - 1 - i];
+    memcpy(&v, swapped, sizeof(T));
+#endif
+    return v;
+  }
+
+protected:
+  virtual void onBegin(uint32_t /* length */) {}
+  /* Count of an array field or length of a string, before its content. */
+  virtual void onArray(int /* field */, uint32_t /* count */) {}
+  /* One value of field, index counts the values of array fields. */
+  virtual void onValue(int /* field */, uint32_t /* index */, const uint8_t* /* bytes */) {}
+  /* The next characters of a string field, it may arrive in pieces. */
+  virtual void onString(int /* field */, const char* /* chars */, uint32_t /* length */) {}
+  virtual void onEnd(bool /* valid */) {}
+
+  void nextField()
+  {
+    for (field_++; field_ < fields_; field_++)
+    {
+      const StreamField& f = layout_[field_];
+      index_ = 0;
+      acc_len_ = 0;
+      want_length_ = f.kind != STREAM_VALUE;
+      remaining_ = f.kind == STREAM_VALUE ? f.count : 0;
+      if (want_length_ || remaining_ > 0)
+        return;
+    }
+  }
+
+  /* Collect up to size bytes of a value that straddles two chunks. */
+  int take(const uint8_t* data, int length, int size)
+  {
+    int n = size - acc_len_;
+    if (n > length)
+      n = length;
+    memcpy(acc_ + acc_len_, data, n);
+    acc_len_ += n;
+    return n;
+  }
+
+  const StreamField* layout_;
+  int fields_;
+  int field_{0};
+  uint32_t index_{0};
+  uint32_t remaining_{0};
+  bool want_length_{false};
+  bool overrun_{false};
+  uint8_t acc_[8] = {0};
+  int acc_len_{0};
+};
+
+}
+
+#endif
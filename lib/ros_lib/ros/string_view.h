@@ -0,0 +1,148 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_STRING_VIEW_H_
+#define ROS_STRING_VIEW_H_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ros
+{
+
+/*
+ * String field of a message: a pointer plus its length.
+ *
+ * Assigning a C string measures it once, so publishing the same message
+ * again does not strlen() every field. The length is taken at assignment,
+ * so re-assign the field after rewriting the characters it points at.
+ *
+ * Deserialized strings point straight into the receive buffer and are
+ * not NUL-terminated there. data(), size() and equals() read them in
+ * place and never write.
+ *
+ * c_str() and the implicit const char* conversion do write: on first use
+ * they put a NUL into the receive buffer (message_in of the node handle)
+ * right behind the string. That byte may be the first byte of the
+ * following field, a length prefix or a plain scalar like Image's
+ * is_bigendian after encoding, or a spare byte after the frame. This is
+ * safe only because every field has already been decoded when the
+ * callback runs. The buffer is not left as it arrived: code that reads
+ * the raw frame after the callback, or a receive buffer that is const,
+ * must stick to data() and size(). As with the generated code before, the
+ * string is only valid until the next message arrives.
+ */
+class StringView
+{
+public:
+  StringView() :
+    data_(""), length_(0), terminated_(true)
+  {
+  }
+
+  StringView(const char* str) :
+    data_(str ? str : ""), length_(str ? strlen(str) : 0), terminated_(true)
+  {
+  }
+
+  StringView(const char* str, uint32_t length, bool terminated = true) :
+    data_(str), length_(length), terminated_(terminated)
+  {
+  }
+
+  const char* data() const
+  {
+    return data_;
+  }
+
+  uint32_t size() const
+  {
+    return length_;
+  }
+
+  bool empty() const
+  {
+    return length_ == 0;
+  }
+
+  /* Compare with a C string without terminating this one. */
+  bool equals(const char* str) const
+  {
+    return strlen(str) == length_ && memcmp(data_, str, length_) == 0;
+  }
+
+  /* NUL-terminated string, writes into a deserialized string's buffer, see above. */
+  const char* c_str() const
+  {
+    if (!terminated_)
+    {
+      const_cast<char*>(data_)[length_] = 0;
+      terminated_ = true;
+    }
+    return data_;
+  }
+
+  operator const char*() const
+  {
+    return c_str();
+  }
+
+  /* Length prefixed wire format, returns the bytes written. */
+  int serialize(unsigned char* outbuffer) const
+  {
+    for (int i = 0; i < 4; i++)
+      outbuffer[i] = (length_ >> (8 * i)) & 0xFF;
+    memcpy(outbuffer + 4, data_, length_);
+    return 4 + length_;
+  }
+
+  int deserialize(unsigned char* inbuffer)
+  {
+    length_ = ((uint32_t) inbuffer[0]) | ((uint32_t) inbuffer[1] << 8) |
+              ((uint32_t) inbuffer[2] << 16) | ((uint32_t) inbuffer[3] << 24);
+    data_ = (const char*)(inbuffer + 4);
+    terminated_ = false;
+    return 4 + length_;
+  }
+
+private:
+  const char* data_;
+  uint32_t length_;
+  mutable bool terminated_;
+};
+
+}
+
+#endif
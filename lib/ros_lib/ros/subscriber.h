@@ -36,6 +36,7 @@
 #define ROS_SUBSCRIBER_H_
 
 #include "rosserial_msgs/TopicInfo.h"
+#include "ros/stream_decoder.h"
 
 namespace ros
 {
@@ -45,6 +46,12 @@ class Subscriber_
 {
 public:
   virtual void callback(unsigned char *data) = 0;
+  /* Called with every complete frame, subscribers that need its length override it. */
+  virtual void receive(unsigned char *data, int length)
+  {
+    (void) length;
+    callback(data);
+  }
   virtual int getEndpointType() = 0;
 
   // id_ is set by NodeHandle when we advertise
@@ -52,6 +59,11 @@ public:
 
   virtual const char * getMsgType() = 0;
   virtual const char * getMsgMD5() = 0;
+  /* Subscribers that decode their frames incrementally return their decoder. */
+  virtual StreamDecoder * getStreamDecoder()
+  {
+    return nullptr;
+  }
   const char * topic_;
 };
 
@@ -135,6 +147,49 @@ private:
   int endpoint_;
 };
 
+/*
+ * Subscriber that receives MsgT through a StreamDecoder instead of
+ * message_in, so its frames may be larger than INPUT_SIZE. Derive from it
+ * and override the StreamDecoder callbacks; layout describes MsgT.
+ */
+template<typename MsgT>
+class StreamSubscriber: public Subscriber_, public StreamDecoder
+{
+public:
+  StreamSubscriber(const char * topic_name, const StreamField* layout, int fields,
+                   int endpoint = rosserial_msgs::TopicInfo::ID_SUBSCRIBER) :
+    StreamDecoder(layout, fields),
+    endpoint_(endpoint)
+  {
+    topic_ = topic_name;
+  };
+
+  /* frames are fed to the decoder while they arrive */
+  virtual void callback(unsigned char* data) override
+  {
+  }
+
+  virtual StreamDecoder * getStreamDecoder() override
+  {
+    return this;
+  }
+  virtual const char * getMsgType() override
+  {
+    return MsgT().getType();
+  }
+  virtual const char * getMsgMD5() override
+  {
+    return MsgT().getMD5();
+  }
+  virtual int getEndpointType() override
+  {
+    return endpoint_;
+  }
+
+private:
+  int endpoint_;
+};
+
 }
 
 #endif
@@ -70,6 +70,17 @@ public:
   };
   Time& fromNSec(int32_t t);
 
+  uint64_t toUSec() const
+  {
+    return (uint64_t)sec * 1000000ULL + nsec / 1000;
+  };
+  Time& fromUSec(uint64_t t)
+  {
+    sec = (uint32_t)(t / 1000000ULL);
+    nsec = (uint32_t)(t % 1000000ULL) * 1000UL;
+    return *this;
+  };
+
   Time& operator +=(const Duration &rhs);
   Time& operator -=(const Duration &rhs);
   Duration operator -(const Time &rhs) const;
@@ -0,0 +1,92 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ROS_TIMEBASE_H_
+#define ROS_TIMEBASE_H_
+
+#include <stdint.h>
+
+#if defined(ESP32)
+  #include <esp_timer.h>
+#elif !defined(ARDUINO)
+  #include <chrono>
+#else
+  #include <Arduino.h>
+#endif
+
+namespace ros
+{
+
+/*
+ * Monotonic 64 bit microsecond clock that does not wrap during the
+ * lifetime of the device.
+ */
+inline uint64_t micros64()
+{
+#if defined(ESP32)
+  return (uint64_t) esp_timer_get_time();
+#elif !defined(ARDUINO)
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+  // Extend micros() across its 71 minute wrap. Needs to be called at least
+  // once per wrap period, which spinOnce() does.
+  static uint32_t last = 0;
+  static uint64_t high = 0;
+  uint32_t now = micros();
+  if (now < last)
+    high += 1ULL << 32;
+  last = now;
+  return high | now;
+#endif
+}
+
+/*
+ * Detects whether a Hardware class offers its own `uint64_t time_us()`.
+ * Hardware without it uses micros64().
+ */
+template<class Hardware>
+class HasTimeUs
+{
+  template<class U>
+  static char test(decltype(((U*)0)->time_us())*);
+  template<class U>
+  static long test(...);
+public:
+  enum { value = sizeof(test<Hardware>(0)) == sizeof(char) };
+};
+
+}
+
+#endif
@@ -0,0 +1,220 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ROS_TX_BUFFER_H_
+#define ROS_TX_BUFFER_H_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ros
+{
+
+const int TX_MAX_FRAMES = 16;   // frames that can be pending at once
+
+/*
+ * Contiguous buffer that collects outgoing rosserial frames so several
+ * of them can be handed to the hardware with a single write.
+ *
+ * Frames stay in publish order. A frame published as "latest only"
+ * replaces a not yet transmitted frame of the same topic instead of
+ * queuing behind it, and such frames are the first to be evicted when a
+ * reliable frame needs room. Sent bytes are consumed from the front and
+ * the first frame may be partially sent; it can no longer be replaced.
+ */
+template<int SIZE>
+class TxBuffer
+{
+public:
+  /* Queue a complete frame. Returns false if it does not fit. */
+  bool append(int id, const uint8_t* data, int length, bool latest = false)
+  {
+    if (latest && replace(id, data, length))
+      return true;
+    if (length > SIZE)
+      return false;
+    while (used_ + length > SIZE || count_ >= TX_MAX_FRAMES)
+    {
+      if (latest || !evictLatest())
+        return false;
+    }
+    memcpy(buffer_ + used_, data, length);
+    frames_[count_].id = id;
+    frames_[count_].offset = used_;
+    frames_[count_].length = length;
+    frames_[count_].latest = latest;
+    count_++;
+    used_ += length;
+    return true;
+  }
+
+  /* Mark the first `length` pending bytes as transmitted. */
+  void consume(int length)
+  {
+    if (SIZE == 0)
+      return;  // Nothing is ever queued, and frames_ has a single dummy entry
+    sent_ += length;
+    int done = 0;
+    int bytes = 0;
+    while (done < count_ && sent_ >= bytes + frames_[done].length)
+    {
+      bytes += frames_[done].length;
+      done++;
+    }
+    if (done == 0)
+      return;
+    memmove(buffer_, buffer_ + bytes, used_ - bytes);
+    for (int i = done; i < count_; i++)
+    {
+      frames_[i - done] = frames_[i];
+      frames_[i - done].offset -= bytes;
+    }
+    count_ -= done;
+    used_ -= bytes;
+    sent_ -= bytes;
+  }
+
+  /* Discard everything, e.g. after the connection broke. */
+  void clear()
+  {
+    dropped_ += count_;
+    used_ = 0;
+    sent_ = 0;
+    count_ = 0;
+  }
+
+  /* Bytes waiting to be transmitted. */
+  uint8_t* pending()
+  {
+    return buffer_ + sent_;
+  }
+
+  int size() const
+  {
+    return used_ - sent_;
+  }
+
+  int capacity() const
+  {
+    return SIZE;
+  }
+
+  uint32_t dropped() const
+  {
+    return dropped_;
+  }
+
+  uint32_t replaced() const
+  {
+    return replaced_;
+  }
+
+  void countDropped()
+  {
+    dropped_++;
+  }
+
+protected:
+  struct Frame
+  {
+    uint16_t id;
+    uint16_t offset;
+    uint16_t length;
+    bool latest;
+  };
+
+  /* Frames that have not started transmitting may still be changed. */
+  int firstUnsent() const
+  {
+    return sent_ > 0 ? 1 : 0;
+  }
+
+  bool replace(int id, const uint8_t* data, int length)
+  {
+    for (int i = firstUnsent(); i < count_; i++)
+    {
+      if (frames_[i].id != id)
+        continue;
+      replaced_++;
+      if (frames_[i].length == length)
+      {
+        memcpy(buffer_ + frames_[i].offset, data, length);
+        return true;
+      }
+      remove(i);
+      return false;
+    }
+    return false;
+  }
+
+  bool evictLatest()
+  {
+    for (int i = firstUnsent(); i < count_; i++)
+    {
+      if (frames_[i].latest)
+      {
+        remove(i);
+        dropped_++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void remove(int index)
+  {
+    int offset = frames_[index].offset;
+    int length = frames_[index].length;
+    memmove(buffer_ + offset, buffer_ + offset + length, used_ - offset - length);
+    for (int i = index + 1; i < count_; i++)
+    {
+      frames_[i - 1] = frames_[i];
+      frames_[i - 1].offset -= length;
+    }
+    count_--;
+    used_ -= length;
+  }
+
+  uint8_t buffer_[SIZE > 0 ? SIZE : 1];
+  Frame frames_[SIZE > 0 ? TX_MAX_FRAMES : 1];
+  int used_{0};
+  int sent_{0};
+  int count_{0};
+  uint32_t dropped_{0};
+  uint32_t replaced_{0};
+};
+
+}
+
+#endif
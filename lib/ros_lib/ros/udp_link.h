@@ -0,0 +1,284 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *  * Neither the name of Willow Garage, Inc. nor the names of its
+ *    contributors may be used to endorse or promote prducts derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ROS_UDP_LINK_H_
+#define ROS_UDP_LINK_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(ESP32)
+  #include <lwip/sockets.h>
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#include "ros/timebase.h"
+
+namespace ros
+{
+
+const int UDP_MAX_DATAGRAM    = 1472;  // largest datagram that is not fragmented on Ethernet
+const int UDP_RESEND_SIZE     = 512;   // negotiation frames held for their repeats
+const uint32_t UDP_RESEND_MS  = 15;    // between repeats, the first comes after the WiFi retries of the original
+const uint8_t UDP_RESEND_TRIES = 30;   // repeats at most, a host that went away is not flooded
+const uint16_t UDP_LAST_NEGOTIATION_ID = 5;  // topic ids up to this carry TopicInfo
+const uint16_t UDP_TIME_ID    = 10;    // topic id of time sync frames
+
+/*
+ * NodeHandle_ hardware that carries rosserial over UDP, the way
+ * rosserial_server's udp_socket_node expects it: frames are sent to the
+ * host's server_port, the host answers to local_port (its client_port).
+ *
+ * Every frame goes out as a datagram of its own. A lost frame costs only
+ * itself, instead of stalling all frames behind it until TCP retransmits.
+ * State topics like Joy are simply superseded by the next frame.
+ *
+ * The host sends no acknowledgements. The node handle sends a time
+ * request with every negotiation, so the first time reply after it is
+ * taken as confirmation: until then the negotiation frames (TopicInfo)
+ * are repeated every UDP_RESEND_MS, at least once and at most
+ * UDP_RESEND_TRIES times. Registering a topic twice is harmless on the
+ * host. Time requests are not repeated here, a repeat would be answered
+ * with a wrong round trip; the node handle sends a new one when a request
+ * stays unanswered.
+ */
+class UdpLink
+{
+public:
+  ~UdpLink()
+  {
+    end();
+  }
+
+  /* Open the socket. host_ip is in network byte order. */
+  bool begin(uint32_t host_ip, uint16_t host_port, uint16_t local_port)
+  {
+    end();
+    fd_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd_ < 0)
+      return false;
+    int on = 1;
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(local_port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd_, (struct sockaddr*) &local, sizeof(local)) < 0)
+    {
+      end();
+      return false;
+    }
+    fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL, 0) | O_NONBLOCK);
+    memset(&host_, 0, sizeof(host_));
+    host_.sin_family = AF_INET;
+    host_.sin_port = htons(host_port);
+    host_.sin_addr.s_addr = host_ip;
+    rx_len_ = 0;
+    rx_pos_ = 0;
+    resend_len_ = 0;
+    resend_tries_ = 0;
+    return true;
+  }
+
+  void end()
+  {
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+  }
+
+  bool isOpen() const
+  {
+    return fd_ >= 0;
+  }
+
+  void init()
+  {
+  }
+
+  /* read a byte of the current datagram. -1 = nothing received */
+  int read()
+  {
+    if (rx_pos_ >= rx_len_ && !receive())
+      return -1;
+    return rx_[rx_pos_++];
+  }
+
+  /* read up to length bytes of the current datagram. <= 0 = nothing received */
+  int read(uint8_t* data, size_t length)
+  {
+    if (rx_pos_ >= rx_len_ && !receive())
+      return -1;
+    int n = rx_len_ - rx_pos_;
+    if ((size_t) n > length)
+      n = length;
+    memcpy(data, rx_ + rx_pos_, n);
+    rx_pos_ += n;
+    return n;
+  }
+
+  /*
+   * The node handle hands over whole frames, possibly several at once.
+   * The negotiation frames of a write replace the ones held before.
+   */
+  void write(uint8_t* data, int length)
+  {
+    bool held = false;
+    while (length > 0)
+    {
+      int frame = frameLength(data, length);
+      send(data, frame);
+      if (frameTopic(data, frame) <= UDP_LAST_NEGOTIATION_ID)
+      {
+        if (!held)
+          resend_len_ = 0;
+        held = true;
+        if (resend_len_ + frame <= UDP_RESEND_SIZE)
+        {
+          memcpy(resend_ + resend_len_, data, frame);
+          resend_len_ += frame;
+        }
+        resend_time_ = (uint32_t)(micros64() / 1000) + UDP_RESEND_MS;
+        resend_tries_ = UDP_RESEND_TRIES;
+      }
+      data += frame;
+      length -= frame;
+    }
+  }
+
+  unsigned long time()
+  {
+    return (unsigned long)(micros64() / 1000);
+  }
+
+  /* Datagrams the network stack refused, e.g. because its queue was full. */
+  uint32_t sendErrors() const
+  {
+    return send_errors_;
+  }
+
+protected:
+  /* Length of the frame at data: 0xff, version, length L/H, length checksum, topic L/H, payload, checksum */
+  static int frameLength(const uint8_t* data, int length)
+  {
+    bool framed = length >= 8 && data[0] == 0xff && 8 + (data[2] | (data[3] << 8)) <= length;
+    return framed ? 8 + (data[2] | (data[3] << 8)) : length;
+  }
+
+  /* Topic id of a frame, 0xffff if it is none. */
+  static uint16_t frameTopic(const uint8_t* data, int frame)
+  {
+    return frame >= 8 && data[0] == 0xff ? (data[5] | (data[6] << 8)) : 0xffff;
+  }
+
+  void send(const uint8_t* data, int length)
+  {
+    if (fd_ < 0 || sendto(fd_, data, length, 0, (struct sockaddr*) &host_, sizeof(host_)) != length)
+      send_errors_++;
+  }
+
+  /* Repeat the unconfirmed negotiation frames once they are due. */
+  void resendDue()
+  {
+    uint32_t now = (uint32_t)(micros64() / 1000);
+    if (resend_tries_ == 0 || (int32_t)(now - resend_time_) < 0)
+      return;
+    int pos = 0;
+    while (pos < resend_len_)
+    {
+      int frame = 8 + (resend_[pos + 2] | (resend_[pos + 3] << 8));
+      send(resend_ + pos, frame);
+      pos += frame;
+    }
+    resend_time_ = now + UDP_RESEND_MS;
+    resend_tries_--;
+  }
+
+  /* A time reply confirms the negotiation, the frames are repeated at least once. */
+  void confirm()
+  {
+    int pos = 0;
+    while (resend_tries_ > 0 && pos < rx_len_)
+    {
+      int frame = frameLength(rx_ + pos, rx_len_ - pos);
+      if (frameTopic(rx_ + pos, frame) == UDP_TIME_ID)
+        resend_tries_ = resend_tries_ == UDP_RESEND_TRIES ? 1 : 0;
+      pos += frame;
+    }
+  }
+
+  /* Fetch the next datagram of the host, others are dropped. */
+  bool receive()
+  {
+    resendDue();
+    if (fd_ < 0)
+      return false;
+    for (;;)
+    {
+      struct sockaddr_in from;
+      socklen_t from_len = sizeof(from);
+      int n = recvfrom(fd_, rx_, sizeof(rx_), 0, (struct sockaddr*) &from, &from_len);
+      if (n <= 0)
+        return false;
+      if (from.sin_addr.s_addr != host_.sin_addr.s_addr)
+        continue;
+      rx_len_ = n;
+      rx_pos_ = 0;
+      confirm();
+      return true;
+    }
+  }
+
+  int fd_ = -1;
+  struct sockaddr_in host_;
+  uint8_t rx_[UDP_MAX_DATAGRAM];
+  int rx_len_ = 0;
+  int rx_pos_ = 0;
+  uint8_t resend_[UDP_RESEND_SIZE];
+  int resend_len_ = 0;
+  uint32_t resend_time_ = 0;
+  uint8_t resend_tries_ = 0;
+  uint32_t send_errors_ = 0;
+};
+
+}
+
+#endif
@@ -12,9 +12,9 @@ namespace roscpp
   class Logger : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _level_type;
+      typedef ros::StringView _level_type;
       _level_type level;
 
     Logger():
@@ -26,39 +26,39 @@ namespace roscpp
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_level = strlen(this->level);
+      uint32_t length_level = this->level.size();
       varToArr(outbuffer + offset, length_level);
       offset += 4;
-      memcpy(outbuffer + offset, this->level, length_level);
+      memcpy(outbuffer + offset, this->level.data(), length_level);
       offset += length_level;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += 4 + this->level.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_level;
       arrToVar(length_level, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_level; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_level-1]=0;
-      this->level = (char *)(inbuffer + offset-1);
+      this->level = ros::StringView((const char *)(inbuffer + offset), length_level, false);
       offset += length_level;
      return offset;
     }
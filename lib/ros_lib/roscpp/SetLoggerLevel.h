@@ -13,9 +13,9 @@ static const char SETLOGGERLEVEL[] = "roscpp/SetLoggerLevel";
   class SetLoggerLevelRequest : public ros::Msg
   {
     public:
-      typedef const char* _logger_type;
+      typedef ros::StringView _logger_type;
       _logger_type logger;
-      typedef const char* _level_type;
+      typedef ros::StringView _level_type;
       _level_type level;
 
     SetLoggerLevelRequest():
@@ -27,39 +27,39 @@ static const char SETLOGGERLEVEL[] = "roscpp/SetLoggerLevel";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_logger = strlen(this->logger);
+      uint32_t length_logger = this->logger.size();
       varToArr(outbuffer + offset, length_logger);
       offset += 4;
-      memcpy(outbuffer + offset, this->logger, length_logger);
+      memcpy(outbuffer + offset, this->logger.data(), length_logger);
       offset += length_logger;
-      uint32_t length_level = strlen(this->level);
+      uint32_t length_level = this->level.size();
       varToArr(outbuffer + offset, length_level);
       offset += 4;
-      memcpy(outbuffer + offset, this->level, length_level);
+      memcpy(outbuffer + offset, this->level.data(), length_level);
       offset += length_level;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->logger.size();
+      offset += 4 + this->level.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_logger;
       arrToVar(length_logger, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_logger; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_logger-1]=0;
-      this->logger = (char *)(inbuffer + offset-1);
+      this->logger = ros::StringView((const char *)(inbuffer + offset), length_logger, false);
       offset += length_logger;
       uint32_t length_level;
       arrToVar(length_level, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_level; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_level-1]=0;
-      this->level = (char *)(inbuffer + offset-1);
+      this->level = ros::StringView((const char *)(inbuffer + offset), length_level, false);
       offset += length_level;
      return offset;
     }
@@ -83,6 +83,17 @@ static const char SETLOGGERLEVEL[] = "roscpp/SetLoggerLevel";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -58,6 +58,17 @@ static const char TWOINTS[] = "roscpp_tutorials/TwoInts";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 16;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -130,6 +141,17 @@ static const char TWOINTS[] = "roscpp_tutorials/TwoInts";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 8;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -17,18 +17,18 @@ namespace rosgraph_msgs
       _header_type header;
       typedef int8_t _level_type;
       _level_type level;
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _msg_type;
+      typedef ros::StringView _msg_type;
       _msg_type msg;
-      typedef const char* _file_type;
+      typedef ros::StringView _file_type;
       _file_type file;
-      typedef const char* _function_type;
+      typedef ros::StringView _function_type;
       _function_type function;
       typedef uint32_t _line_type;
       _line_type line;
       uint32_t topics_length;
-      typedef char* _topics_type;
+      typedef ros::StringView _topics_type;
       _topics_type st_topics;
       _topics_type * topics;
       enum { DEBUG = 1  };
@@ -60,25 +60,25 @@ namespace rosgraph_msgs
       u_level.real = this->level;
       *(outbuffer + offset + 0) = (u_level.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->level);
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_msg = strlen(this->msg);
+      uint32_t length_msg = this->msg.size();
       varToArr(outbuffer + offset, length_msg);
       offset += 4;
-      memcpy(outbuffer + offset, this->msg, length_msg);
+      memcpy(outbuffer + offset, this->msg.data(), length_msg);
       offset += length_msg;
-      uint32_t length_file = strlen(this->file);
+      uint32_t length_file = this->file.size();
       varToArr(outbuffer + offset, length_file);
       offset += 4;
-      memcpy(outbuffer + offset, this->file, length_file);
+      memcpy(outbuffer + offset, this->file.data(), length_file);
       offset += length_file;
-      uint32_t length_function = strlen(this->function);
+      uint32_t length_function = this->function.size();
       varToArr(outbuffer + offset, length_function);
       offset += 4;
-      memcpy(outbuffer + offset, this->function, length_function);
+      memcpy(outbuffer + offset, this->function.data(), length_function);
       offset += length_function;
       *(outbuffer + offset + 0) = (this->line >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->line >> (8 * 1)) & 0xFF;
@@ -91,15 +91,32 @@ namespace rosgraph_msgs
       *(outbuffer + offset + 3) = (this->topics_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->topics_length);
       for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_topicsi = strlen(this->topics[i]);
+      uint32_t length_topicsi = this->topics[i].size();
       varToArr(outbuffer + offset, length_topicsi);
       offset += 4;
-      memcpy(outbuffer + offset, this->topics[i], length_topicsi);
+      memcpy(outbuffer + offset, this->topics[i].data(), length_topicsi);
       offset += length_topicsi;
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->level);
+      offset += 4 + this->name.size();
+      offset += 4 + this->msg.size();
+      offset += 4 + this->file.size();
+      offset += 4 + this->function.size();
+      offset += sizeof(this->line);
+      offset += sizeof(this->topics_length);
+      for( uint32_t i = 0; i < topics_length; i++){
+      offset += 4 + this->topics[i].size();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -115,38 +132,22 @@ namespace rosgraph_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_msg;
       arrToVar(length_msg, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_msg; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_msg-1]=0;
-      this->msg = (char *)(inbuffer + offset-1);
+      this->msg = ros::StringView((const char *)(inbuffer + offset), length_msg, false);
       offset += length_msg;
       uint32_t length_file;
       arrToVar(length_file, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_file; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_file-1]=0;
-      this->file = (char *)(inbuffer + offset-1);
+      this->file = ros::StringView((const char *)(inbuffer + offset), length_file, false);
       offset += length_file;
       uint32_t length_function;
       arrToVar(length_function, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_function; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_function-1]=0;
-      this->function = (char *)(inbuffer + offset-1);
+      this->function = ros::StringView((const char *)(inbuffer + offset), length_function, false);
       offset += length_function;
       this->line =  ((uint32_t) (*(inbuffer + offset)));
       this->line |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -159,19 +160,15 @@ namespace rosgraph_msgs
       topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->topics_length);
       if(topics_lengthT > topics_length)
-        this->topics = (char**)realloc(this->topics, topics_lengthT * sizeof(char*));
+        this->topics = (ros::StringView*)realloc(this->topics, topics_lengthT * sizeof(ros::StringView));
       topics_length = topics_lengthT;
       for( uint32_t i = 0; i < topics_length; i++){
       uint32_t length_st_topics;
       arrToVar(length_st_topics, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_topics; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_topics-1]=0;
-      this->st_topics = (char *)(inbuffer + offset-1);
+      this->st_topics = ros::StringView((const char *)(inbuffer + offset), length_st_topics, false);
       offset += length_st_topics;
-        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(char*));
+        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(ros::StringView));
       }
      return offset;
     }
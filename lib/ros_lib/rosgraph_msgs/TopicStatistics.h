@@ -14,11 +14,11 @@ namespace rosgraph_msgs
   class TopicStatistics : public ros::Msg
   {
     public:
-      typedef const char* _topic_type;
+      typedef ros::StringView _topic_type;
       _topic_type topic;
-      typedef const char* _node_pub_type;
+      typedef ros::StringView _node_pub_type;
       _node_pub_type node_pub;
-      typedef const char* _node_sub_type;
+      typedef ros::StringView _node_sub_type;
       _node_sub_type node_sub;
       typedef ros::Time _window_start_type;
       _window_start_type window_start;
@@ -64,20 +64,20 @@ namespace rosgraph_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
+      uint32_t length_topic = this->topic.size();
       varToArr(outbuffer + offset, length_topic);
       offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
+      memcpy(outbuffer + offset, this->topic.data(), length_topic);
       offset += length_topic;
-      uint32_t length_node_pub = strlen(this->node_pub);
+      uint32_t length_node_pub = this->node_pub.size();
       varToArr(outbuffer + offset, length_node_pub);
       offset += 4;
-      memcpy(outbuffer + offset, this->node_pub, length_node_pub);
+      memcpy(outbuffer + offset, this->node_pub.data(), length_node_pub);
       offset += length_node_pub;
-      uint32_t length_node_sub = strlen(this->node_sub);
+      uint32_t length_node_sub = this->node_sub.size();
       varToArr(outbuffer + offset, length_node_sub);
       offset += 4;
-      memcpy(outbuffer + offset, this->node_sub, length_node_sub);
+      memcpy(outbuffer + offset, this->node_sub.data(), length_node_sub);
       offset += length_node_sub;
       *(outbuffer + offset + 0) = (this->window_start.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->window_start.sec >> (8 * 1)) & 0xFF;
@@ -192,35 +192,51 @@ namespace rosgraph_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->topic.size();
+      offset += 4 + this->node_pub.size();
+      offset += 4 + this->node_sub.size();
+      offset += sizeof(this->window_start.sec);
+      offset += sizeof(this->window_start.nsec);
+      offset += sizeof(this->window_stop.sec);
+      offset += sizeof(this->window_stop.nsec);
+      offset += sizeof(this->delivered_msgs);
+      offset += sizeof(this->dropped_msgs);
+      offset += sizeof(this->traffic);
+      offset += sizeof(this->period_mean.sec);
+      offset += sizeof(this->period_mean.nsec);
+      offset += sizeof(this->period_stddev.sec);
+      offset += sizeof(this->period_stddev.nsec);
+      offset += sizeof(this->period_max.sec);
+      offset += sizeof(this->period_max.nsec);
+      offset += sizeof(this->stamp_age_mean.sec);
+      offset += sizeof(this->stamp_age_mean.nsec);
+      offset += sizeof(this->stamp_age_stddev.sec);
+      offset += sizeof(this->stamp_age_stddev.nsec);
+      offset += sizeof(this->stamp_age_max.sec);
+      offset += sizeof(this->stamp_age_max.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_topic;
       arrToVar(length_topic, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
+      this->topic = ros::StringView((const char *)(inbuffer + offset), length_topic, false);
       offset += length_topic;
       uint32_t length_node_pub;
       arrToVar(length_node_pub, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_node_pub; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_node_pub-1]=0;
-      this->node_pub = (char *)(inbuffer + offset-1);
+      this->node_pub = ros::StringView((const char *)(inbuffer + offset), length_node_pub, false);
       offset += length_node_pub;
       uint32_t length_node_sub;
       arrToVar(length_node_sub, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_node_sub; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_node_sub-1]=0;
-      this->node_sub = (char *)(inbuffer + offset-1);
+      this->node_sub = ros::StringView((const char *)(inbuffer + offset), length_node_sub, false);
       offset += length_node_sub;
       this->window_start.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->window_start.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
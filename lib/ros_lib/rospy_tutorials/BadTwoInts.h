@@ -54,6 +54,17 @@ static const char BADTWOINTS[] = "rospy_tutorials/BadTwoInts";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 12;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -118,6 +129,17 @@ static const char BADTWOINTS[] = "rospy_tutorials/BadTwoInts";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 4;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
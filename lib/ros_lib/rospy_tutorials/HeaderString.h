@@ -15,7 +15,7 @@ namespace rospy_tutorials
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _data_type;
+      typedef ros::StringView _data_type;
       _data_type data;
 
     HeaderString():
@@ -28,14 +28,22 @@ namespace rospy_tutorials
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_data = strlen(this->data);
+      uint32_t length_data = this->data.size();
       varToArr(outbuffer + offset, length_data);
       offset += 4;
-      memcpy(outbuffer + offset, this->data, length_data);
+      memcpy(outbuffer + offset, this->data.data(), length_data);
       offset += length_data;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->data.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -43,11 +51,7 @@ namespace rospy_tutorials
       uint32_t length_data;
       arrToVar(length_data, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_data; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_data-1]=0;
-      this->data = (char *)(inbuffer + offset-1);
+      this->data = ros::StringView((const char *)(inbuffer + offset), length_data, false);
       offset += length_data;
      return offset;
     }
@@ -59,6 +59,17 @@ namespace rosserial_arduino
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 12;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -13,7 +13,7 @@ static const char TEST[] = "rosserial_arduino/Test";
   class TestRequest : public ros::Msg
   {
     public:
-      typedef const char* _input_type;
+      typedef ros::StringView _input_type;
       _input_type input;
 
     TestRequest():
@@ -24,25 +24,28 @@ static const char TEST[] = "rosserial_arduino/Test";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_input = strlen(this->input);
+      uint32_t length_input = this->input.size();
       varToArr(outbuffer + offset, length_input);
       offset += 4;
-      memcpy(outbuffer + offset, this->input, length_input);
+      memcpy(outbuffer + offset, this->input.data(), length_input);
       offset += length_input;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->input.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_input;
       arrToVar(length_input, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_input; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_input-1]=0;
-      this->input = (char *)(inbuffer + offset-1);
+      this->input = ros::StringView((const char *)(inbuffer + offset), length_input, false);
       offset += length_input;
      return offset;
     }
@@ -55,7 +58,7 @@ static const char TEST[] = "rosserial_arduino/Test";
   class TestResponse : public ros::Msg
   {
     public:
-      typedef const char* _output_type;
+      typedef ros::StringView _output_type;
       _output_type output;
 
     TestResponse():
@@ -66,25 +69,28 @@ static const char TEST[] = "rosserial_arduino/Test";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_output = strlen(this->output);
+      uint32_t length_output = this->output.size();
       varToArr(outbuffer + offset, length_output);
       offset += 4;
-      memcpy(outbuffer + offset, this->output, length_output);
+      memcpy(outbuffer + offset, this->output.data(), length_output);
       offset += length_output;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->output.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_output;
       arrToVar(length_output, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_output; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_output-1]=0;
-      this->output = (char *)(inbuffer + offset-1);
+      this->output = ros::StringView((const char *)(inbuffer + offset), length_output, false);
       offset += length_output;
      return offset;
     }
@@ -14,7 +14,7 @@ namespace rosserial_msgs
     public:
       typedef uint8_t _level_type;
       _level_type level;
-      typedef const char* _msg_type;
+      typedef ros::StringView _msg_type;
       _msg_type msg;
       enum { ROSDEBUG = 0 };
       enum { INFO = 1 };
@@ -33,14 +33,22 @@ namespace rosserial_msgs
       int offset = 0;
       *(outbuffer + offset + 0) = (this->level >> (8 * 0)) & 0xFF;
       offset += sizeof(this->level);
-      uint32_t length_msg = strlen(this->msg);
+      uint32_t length_msg = this->msg.size();
       varToArr(outbuffer + offset, length_msg);
       offset += 4;
-      memcpy(outbuffer + offset, this->msg, length_msg);
+      memcpy(outbuffer + offset, this->msg.data(), length_msg);
       offset += length_msg;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->level);
+      offset += 4 + this->msg.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -49,11 +57,7 @@ namespace rosserial_msgs
       uint32_t length_msg;
       arrToVar(length_msg, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_msg; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_msg-1]=0;
-      this->msg = (char *)(inbuffer + offset-1);
+      this->msg = ros::StringView((const char *)(inbuffer + offset), length_msg, false);
       offset += length_msg;
      return offset;
     }
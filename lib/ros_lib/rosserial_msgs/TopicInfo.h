@@ -14,11 +14,11 @@ namespace rosserial_msgs
     public:
       typedef uint16_t _topic_id_type;
       _topic_id_type topic_id;
-      typedef const char* _topic_name_type;
+      typedef ros::StringView _topic_name_type;
       _topic_name_type topic_name;
-      typedef const char* _message_type_type;
+      typedef ros::StringView _message_type_type;
       _message_type_type message_type;
-      typedef const char* _md5sum_type;
+      typedef ros::StringView _md5sum_type;
       _md5sum_type md5sum;
       typedef int32_t _buffer_size_type;
       _buffer_size_type buffer_size;
@@ -46,20 +46,20 @@ namespace rosserial_msgs
       *(outbuffer + offset + 0) = (this->topic_id >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->topic_id >> (8 * 1)) & 0xFF;
       offset += sizeof(this->topic_id);
-      uint32_t length_topic_name = strlen(this->topic_name);
+      uint32_t length_topic_name = this->topic_name.size();
       varToArr(outbuffer + offset, length_topic_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->topic_name, length_topic_name);
+      memcpy(outbuffer + offset, this->topic_name.data(), length_topic_name);
       offset += length_topic_name;
-      uint32_t length_message_type = strlen(this->message_type);
+      uint32_t length_message_type = this->message_type.size();
       varToArr(outbuffer + offset, length_message_type);
       offset += 4;
-      memcpy(outbuffer + offset, this->message_type, length_message_type);
+      memcpy(outbuffer + offset, this->message_type.data(), length_message_type);
       offset += length_message_type;
-      uint32_t length_md5sum = strlen(this->md5sum);
+      uint32_t length_md5sum = this->md5sum.size();
       varToArr(outbuffer + offset, length_md5sum);
       offset += 4;
-      memcpy(outbuffer + offset, this->md5sum, length_md5sum);
+      memcpy(outbuffer + offset, this->md5sum.data(), length_md5sum);
       offset += length_md5sum;
       union {
         int32_t real;
@@ -74,6 +74,23 @@ namespace rosserial_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->topic_id);
+      offset += 4 + this->topic_name.size();
+      offset += 4 + this->message_type.size();
+      offset += 4 + this->md5sum.size();
+      offset += sizeof(this->buffer_size);
+      return offset;
+    }
+
+    /* largest size with up to the given topic_name, message_type and md5sum chars */
+    static constexpr int maxSerializedLength(int topic_name, int message_type, int md5sum = 32)
+    {
+      return 2 + 4 + topic_name + 4 + message_type + 4 + md5sum + 4;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -83,29 +100,17 @@ namespace rosserial_msgs
       uint32_t length_topic_name;
       arrToVar(length_topic_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic_name-1]=0;
-      this->topic_name = (char *)(inbuffer + offset-1);
+      this->topic_name = ros::StringView((const char *)(inbuffer + offset), length_topic_name, false);
       offset += length_topic_name;
       uint32_t length_message_type;
       arrToVar(length_message_type, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_message_type; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message_type-1]=0;
-      this->message_type = (char *)(inbuffer + offset-1);
+      this->message_type = ros::StringView((const char *)(inbuffer + offset), length_message_type, false);
       offset += length_message_type;
       uint32_t length_md5sum;
       arrToVar(length_md5sum, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_md5sum; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_md5sum-1]=0;
-      this->md5sum = (char *)(inbuffer + offset-1);
+      this->md5sum = ros::StringView((const char *)(inbuffer + offset), length_md5sum, false);
       offset += length_md5sum;
       union {
         int32_t real;
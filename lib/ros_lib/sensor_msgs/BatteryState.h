@@ -45,9 +45,9 @@ namespace sensor_msgs
       typedef float _cell_temperature_type;
       _cell_temperature_type st_cell_temperature;
       _cell_temperature_type * cell_temperature;
-      typedef const char* _location_type;
+      typedef ros::StringView _location_type;
       _location_type location;
-      typedef const char* _serial_number_type;
+      typedef ros::StringView _serial_number_type;
       _serial_number_type serial_number;
       enum { POWER_SUPPLY_STATUS_UNKNOWN =  0 };
       enum { POWER_SUPPLY_STATUS_CHARGING =  1 };
@@ -183,48 +183,57 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->cell_voltage_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->cell_voltage_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->cell_voltage_length);
-      for( uint32_t i = 0; i < cell_voltage_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_voltagei;
-      u_cell_voltagei.real = this->cell_voltage[i];
-      *(outbuffer + offset + 0) = (u_cell_voltagei.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_cell_voltagei.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_cell_voltagei.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_cell_voltagei.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_voltage[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->cell_voltage, cell_voltage_length);
       *(outbuffer + offset + 0) = (this->cell_temperature_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->cell_temperature_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->cell_temperature_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->cell_temperature_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->cell_temperature_length);
-      for( uint32_t i = 0; i < cell_temperature_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_cell_temperaturei;
-      u_cell_temperaturei.real = this->cell_temperature[i];
-      *(outbuffer + offset + 0) = (u_cell_temperaturei.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_cell_temperaturei.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_cell_temperaturei.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_cell_temperaturei.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->cell_temperature[i]);
-      }
-      uint32_t length_location = strlen(this->location);
+      offset += serializeArray(outbuffer + offset, this->cell_temperature, cell_temperature_length);
+      uint32_t length_location = this->location.size();
       varToArr(outbuffer + offset, length_location);
       offset += 4;
-      memcpy(outbuffer + offset, this->location, length_location);
+      memcpy(outbuffer + offset, this->location.data(), length_location);
       offset += length_location;
-      uint32_t length_serial_number = strlen(this->serial_number);
+      uint32_t length_serial_number = this->serial_number.size();
       varToArr(outbuffer + offset, length_serial_number);
       offset += 4;
-      memcpy(outbuffer + offset, this->serial_number, length_serial_number);
+      memcpy(outbuffer + offset, this->serial_number.data(), length_serial_number);
       offset += length_serial_number;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->voltage);
+      offset += sizeof(this->temperature);
+      offset += sizeof(this->current);
+      offset += sizeof(this->charge);
+      offset += sizeof(this->capacity);
+      offset += sizeof(this->design_capacity);
+      offset += sizeof(this->percentage);
+      offset += sizeof(this->power_supply_status);
+      offset += sizeof(this->power_supply_health);
+      offset += sizeof(this->power_supply_technology);
+      offset += sizeof(this->present);
+      offset += sizeof(this->cell_voltage_length);
+      offset += cell_voltage_length * sizeof(this->cell_voltage[0]);
+      offset += sizeof(this->cell_temperature_length);
+      offset += cell_temperature_length * sizeof(this->cell_temperature[0]);
+      offset += 4 + this->location.size();
+      offset += 4 + this->serial_number.size();
+      return offset;
+    }
+
+    /* largest size with up to the given string chars and array elements */
+    static constexpr int maxSerializedLength(int frame_id, int cell_voltage, int cell_temperature, int location, int serial_number)
+    {
+      return std_msgs::Header::maxSerializedLength(frame_id) + 7 * 4 + 4 + 4 + cell_voltage * 4 + 4 + cell_temperature * 4
+        + 4 + location + 4 + serial_number;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -328,20 +337,7 @@ namespace sensor_msgs
       if(cell_voltage_lengthT > cell_voltage_length)
         this->cell_voltage = (float*)realloc(this->cell_voltage, cell_voltage_lengthT * sizeof(float));
       cell_voltage_length = cell_voltage_lengthT;
-      for( uint32_t i = 0; i < cell_voltage_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_cell_voltage;
-      u_st_cell_voltage.base = 0;
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_cell_voltage.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_cell_voltage = u_st_cell_voltage.real;
-      offset += sizeof(this->st_cell_voltage);
-        memcpy( &(this->cell_voltage[i]), &(this->st_cell_voltage), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->cell_voltage, cell_voltage_length);
       uint32_t cell_temperature_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       cell_temperature_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       cell_temperature_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
@@ -350,37 +346,16 @@ namespace sensor_msgs
       if(cell_temperature_lengthT > cell_temperature_length)
         this->cell_temperature = (float*)realloc(this->cell_temperature, cell_temperature_lengthT * sizeof(float));
       cell_temperature_length = cell_temperature_lengthT;
-      for( uint32_t i = 0; i < cell_temperature_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_cell_temperature;
-      u_st_cell_temperature.base = 0;
-      u_st_cell_temperature.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_cell_temperature.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_cell_temperature.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_cell_temperature.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_cell_temperature = u_st_cell_temperature.real;
-      offset += sizeof(this->st_cell_temperature);
-        memcpy( &(this->cell_temperature[i]), &(this->st_cell_temperature), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->cell_temperature, cell_temperature_length);
       uint32_t length_location;
       arrToVar(length_location, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_location; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_location-1]=0;
-      this->location = (char *)(inbuffer + offset-1);
+      this->location = ros::StringView((const char *)(inbuffer + offset), length_location, false);
       offset += length_location;
       uint32_t length_serial_number;
       arrToVar(length_serial_number, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_serial_number; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_serial_number-1]=0;
-      this->serial_number = (char *)(inbuffer + offset-1);
+      this->serial_number = ros::StringView((const char *)(inbuffer + offset), length_serial_number, false);
       offset += length_serial_number;
      return offset;
     }
@@ -20,15 +20,15 @@ namespace sensor_msgs
       _height_type height;
       typedef uint32_t _width_type;
       _width_type width;
-      typedef const char* _distortion_model_type;
+      typedef ros::StringView _distortion_model_type;
       _distortion_model_type distortion_model;
       uint32_t D_length;
-      typedef float _D_type;
+      typedef ros::float64_t _D_type;
       _D_type st_D;
       _D_type * D;
-      float K[9];
-      float R[9];
-      float P[12];
+      ros::float64_t K[9];
+      ros::float64_t R[9];
+      ros::float64_t P[12];
       typedef uint32_t _binning_x_type;
       _binning_x_type binning_x;
       typedef uint32_t _binning_y_type;
@@ -65,10 +65,10 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
       offset += sizeof(this->width);
-      uint32_t length_distortion_model = strlen(this->distortion_model);
+      uint32_t length_distortion_model = this->distortion_model.size();
       varToArr(outbuffer + offset, length_distortion_model);
       offset += 4;
-      memcpy(outbuffer + offset, this->distortion_model, length_distortion_model);
+      memcpy(outbuffer + offset, this->distortion_model.data(), length_distortion_model);
       offset += length_distortion_model;
       *(outbuffer + offset + 0) = (this->D_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->D_length >> (8 * 1)) & 0xFF;
@@ -76,16 +76,16 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->D_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->D_length);
       for( uint32_t i = 0; i < D_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->D[i]);
+      offset += serializeFloat64(outbuffer + offset, this->D[i]);
       }
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->K[i]);
+      offset += serializeFloat64(outbuffer + offset, this->K[i]);
       }
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->R[i]);
+      offset += serializeFloat64(outbuffer + offset, this->R[i]);
       }
       for( uint32_t i = 0; i < 12; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->P[i]);
+      offset += serializeFloat64(outbuffer + offset, this->P[i]);
       }
       *(outbuffer + offset + 0) = (this->binning_x >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->binning_x >> (8 * 1)) & 0xFF;
@@ -101,6 +101,24 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->height);
+      offset += sizeof(this->width);
+      offset += 4 + this->distortion_model.size();
+      offset += sizeof(this->D_length);
+      offset += D_length * 8;
+      offset += 9 * 8;
+      offset += 9 * 8;
+      offset += 12 * 8;
+      offset += sizeof(this->binning_x);
+      offset += sizeof(this->binning_y);
+      offset += this->roi.serializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -118,11 +136,7 @@ namespace sensor_msgs
       uint32_t length_distortion_model;
       arrToVar(length_distortion_model, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_distortion_model; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_distortion_model-1]=0;
-      this->distortion_model = (char *)(inbuffer + offset-1);
+      this->distortion_model = ros::StringView((const char *)(inbuffer + offset), length_distortion_model, false);
       offset += length_distortion_model;
       uint32_t D_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       D_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -130,20 +144,20 @@ namespace sensor_msgs
       D_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->D_length);
       if(D_lengthT > D_length)
-        this->D = (float*)realloc(this->D, D_lengthT * sizeof(float));
+        this->D = (ros::float64_t*)realloc(this->D, D_lengthT * sizeof(ros::float64_t));
       D_length = D_lengthT;
       for( uint32_t i = 0; i < D_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_D));
-        memcpy( &(this->D[i]), &(this->st_D), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_D));
+        memcpy( &(this->D[i]), &(this->st_D), sizeof(ros::float64_t));
       }
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->K[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->K[i]));
       }
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->R[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->R[i]));
       }
       for( uint32_t i = 0; i < 12; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->P[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->P[i]));
       }
       this->binning_x =  ((uint32_t) (*(inbuffer + offset)));
       this->binning_x |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -12,7 +12,7 @@ namespace sensor_msgs
   class ChannelFloat32 : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
       uint32_t values_length;
       typedef float _values_type;
@@ -28,28 +28,26 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       *(outbuffer + offset + 0) = (this->values_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->values_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->values_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->values_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->values_length);
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_valuesi;
-      u_valuesi.real = this->values[i];
-      *(outbuffer + offset + 0) = (u_valuesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_valuesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_valuesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_valuesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->values[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->values, values_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += sizeof(this->values_length);
+      offset += values_length * sizeof(this->values[0]);
       return offset;
     }
 
@@ -59,11 +57,7 @@ namespace sensor_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t values_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       values_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -73,20 +67,7 @@ namespace sensor_msgs
       if(values_lengthT > values_length)
         this->values = (float*)realloc(this->values, values_lengthT * sizeof(float));
       values_length = values_lengthT;
-      for( uint32_t i = 0; i < values_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_values;
-      u_st_values.base = 0;
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_values.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_values = u_st_values.real;
-      offset += sizeof(this->st_values);
-        memcpy( &(this->values[i]), &(this->st_values), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->values, values_length);
      return offset;
     }
 
@@ -15,7 +15,7 @@ namespace sensor_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _format_type;
+      typedef ros::StringView _format_type;
       _format_type format;
       uint32_t data_length;
       typedef uint8_t _data_type;
@@ -33,20 +33,27 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_format = strlen(this->format);
+      uint32_t length_format = this->format.size();
       varToArr(outbuffer + offset, length_format);
       offset += 4;
-      memcpy(outbuffer + offset, this->format, length_format);
+      memcpy(outbuffer + offset, this->format.data(), length_format);
       offset += length_format;
       *(outbuffer + offset + 0) = (this->data_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->data_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->format.size();
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -57,24 +64,25 @@ namespace sensor_msgs
       uint32_t length_format;
       arrToVar(length_format, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_format; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_format-1]=0;
-      this->format = (char *)(inbuffer + offset-1);
+      this->format = ros::StringView((const char *)(inbuffer + offset), length_format, false);
       offset += length_format;
       uint32_t data_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      this->st_data =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(uint8_t));
+      if(data_view_)
+      {
+        this->data = inbuffer + offset;  // no copy, see setDataView()
+        data_length = data_lengthT;
+        offset += data_length;
+      }
+      else
+      {
+        if(data_lengthT > data_length)
+          this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
+        data_length = data_lengthT;
+        offset += deserializeArray(inbuffer + offset, this->data, data_length);
       }
      return offset;
     }
@@ -82,6 +90,24 @@ namespace sensor_msgs
     virtual const char * getType() override { return "sensor_msgs/CompressedImage"; };
     virtual const char * getMD5() override { return "8f7a12909da2c9d3332d540a0977563f"; };
 
+    /*
+     * Opt-in zero copy receive: data points straight into the node
+     * handle's receive buffer and is only valid during the subscriber
+     * callback. Set it before the first message arrives; switching drops
+     * the current data, and frees it if deserialize() made a heap copy.
+     */
+    void setDataView(bool view)
+    {
+      if (!data_view_)
+        free(data);
+      data_view_ = view;
+      data_length = 0;
+      data = nullptr;
+    }
+
+    protected:
+      bool data_view_ = false;
+
   };
 
 }
@@ -19,7 +19,7 @@ namespace sensor_msgs
       _height_type height;
       typedef uint32_t _width_type;
       _width_type width;
-      typedef const char* _encoding_type;
+      typedef ros::StringView _encoding_type;
       _encoding_type encoding;
       typedef uint8_t _is_bigendian_type;
       _is_bigendian_type is_bigendian;
@@ -55,10 +55,10 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->width >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->width >> (8 * 3)) & 0xFF;
       offset += sizeof(this->width);
-      uint32_t length_encoding = strlen(this->encoding);
+      uint32_t length_encoding = this->encoding.size();
       varToArr(outbuffer + offset, length_encoding);
       offset += 4;
-      memcpy(outbuffer + offset, this->encoding, length_encoding);
+      memcpy(outbuffer + offset, this->encoding.data(), length_encoding);
       offset += length_encoding;
       *(outbuffer + offset + 0) = (this->is_bigendian >> (8 * 0)) & 0xFF;
       offset += sizeof(this->is_bigendian);
@@ -72,10 +72,21 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->height);
+      offset += sizeof(this->width);
+      offset += 4 + this->encoding.size();
+      offset += sizeof(this->is_bigendian);
+      offset += sizeof(this->step);
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -96,11 +107,7 @@ namespace sensor_msgs
       uint32_t length_encoding;
       arrToVar(length_encoding, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_encoding; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_encoding-1]=0;
-      this->encoding = (char *)(inbuffer + offset-1);
+      this->encoding = ros::StringView((const char *)(inbuffer + offset), length_encoding, false);
       offset += length_encoding;
       this->is_bigendian =  ((uint8_t) (*(inbuffer + offset)));
       offset += sizeof(this->is_bigendian);
@@ -114,13 +121,18 @@ namespace sensor_msgs
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      this->st_data =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(uint8_t));
+      if(data_view_)
+      {
+        this->data = inbuffer + offset;  // no copy, see setDataView()
+        data_length = data_lengthT;
+        offset += data_length;
+      }
+      else
+      {
+        if(data_lengthT > data_length)
+          this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
+        data_length = data_lengthT;
+        offset += deserializeArray(inbuffer + offset, this->data, data_length);
       }
      return offset;
     }
@@ -128,6 +140,24 @@ namespace sensor_msgs
     virtual const char * getType() override { return "sensor_msgs/Image"; };
     virtual const char * getMD5() override { return "060021388200f6f0f447d0fcd9c64743"; };
 
+    /*
+     * Opt-in zero copy receive: data points straight into the node
+     * handle's receive buffer and is only valid during the subscriber
+     * callback. Set it before the first message arrives; switching drops
+     * the current data, and frees it if deserialize() made a heap copy.
+     */
+    void setDataView(bool view)
+    {
+      if (!data_view_)
+        free(data);
+      data_view_ = view;
+      data_length = 0;
+      data = nullptr;
+    }
+
+    protected:
+      bool data_view_ = false;
+
   };
 
 }
@@ -19,13 +19,13 @@ namespace sensor_msgs
       _header_type header;
       typedef geometry_msgs::Quaternion _orientation_type;
       _orientation_type orientation;
-      float orientation_covariance[9];
+      ros::float64_t orientation_covariance[9];
       typedef geometry_msgs::Vector3 _angular_velocity_type;
       _angular_velocity_type angular_velocity;
-      float angular_velocity_covariance[9];
+      ros::float64_t angular_velocity_covariance[9];
       typedef geometry_msgs::Vector3 _linear_acceleration_type;
       _linear_acceleration_type linear_acceleration;
-      float linear_acceleration_covariance[9];
+      ros::float64_t linear_acceleration_covariance[9];
 
     Imu():
       header(),
@@ -44,34 +44,47 @@ namespace sensor_msgs
       offset += this->header.serialize(outbuffer + offset);
       offset += this->orientation.serialize(outbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->orientation_covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->orientation_covariance[i]);
       }
       offset += this->angular_velocity.serialize(outbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->angular_velocity_covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->angular_velocity_covariance[i]);
       }
       offset += this->linear_acceleration.serialize(outbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->linear_acceleration_covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->linear_acceleration_covariance[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += this->orientation.serializedLength();
+      offset += 9 * 8;
+      offset += this->angular_velocity.serializedLength();
+      offset += 9 * 8;
+      offset += this->linear_acceleration.serializedLength();
+      offset += 9 * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->orientation.deserialize(inbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->orientation_covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->orientation_covariance[i]));
       }
       offset += this->angular_velocity.deserialize(inbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->angular_velocity_covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->angular_velocity_covariance[i]));
       }
       offset += this->linear_acceleration.deserialize(inbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->linear_acceleration_covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->linear_acceleration_covariance[i]));
       }
      return offset;
     }
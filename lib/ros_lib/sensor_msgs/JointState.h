@@ -16,19 +16,19 @@ namespace sensor_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t name_length;
-      typedef char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type st_name;
       _name_type * name;
       uint32_t position_length;
-      typedef float _position_type;
+      typedef ros::float64_t _position_type;
       _position_type st_position;
       _position_type * position;
       uint32_t velocity_length;
-      typedef float _velocity_type;
+      typedef ros::float64_t _velocity_type;
       _velocity_type st_velocity;
       _velocity_type * velocity;
       uint32_t effort_length;
-      typedef float _effort_type;
+      typedef ros::float64_t _effort_type;
       _effort_type st_effort;
       _effort_type * effort;
 
@@ -51,10 +51,10 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->name_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->name_length);
       for( uint32_t i = 0; i < name_length; i++){
-      uint32_t length_namei = strlen(this->name[i]);
+      uint32_t length_namei = this->name[i].size();
       varToArr(outbuffer + offset, length_namei);
       offset += 4;
-      memcpy(outbuffer + offset, this->name[i], length_namei);
+      memcpy(outbuffer + offset, this->name[i].data(), length_namei);
       offset += length_namei;
       }
       *(outbuffer + offset + 0) = (this->position_length >> (8 * 0)) & 0xFF;
@@ -63,7 +63,7 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->position_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->position_length);
       for( uint32_t i = 0; i < position_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position[i]);
+      offset += serializeFloat64(outbuffer + offset, this->position[i]);
       }
       *(outbuffer + offset + 0) = (this->velocity_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->velocity_length >> (8 * 1)) & 0xFF;
@@ -71,7 +71,7 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->velocity_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->velocity_length);
       for( uint32_t i = 0; i < velocity_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocity[i]);
+      offset += serializeFloat64(outbuffer + offset, this->velocity[i]);
       }
       *(outbuffer + offset + 0) = (this->effort_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->effort_length >> (8 * 1)) & 0xFF;
@@ -79,11 +79,28 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->effort_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->effort_length);
       for( uint32_t i = 0; i < effort_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort[i]);
+      offset += serializeFloat64(outbuffer + offset, this->effort[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->name_length);
+      for( uint32_t i = 0; i < name_length; i++){
+      offset += 4 + this->name[i].size();
+      }
+      offset += sizeof(this->position_length);
+      offset += position_length * 8;
+      offset += sizeof(this->velocity_length);
+      offset += velocity_length * 8;
+      offset += sizeof(this->effort_length);
+      offset += effort_length * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -94,19 +111,15 @@ namespace sensor_msgs
       name_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->name_length);
       if(name_lengthT > name_length)
-        this->name = (char**)realloc(this->name, name_lengthT * sizeof(char*));
+        this->name = (ros::StringView*)realloc(this->name, name_lengthT * sizeof(ros::StringView));
       name_length = name_lengthT;
       for( uint32_t i = 0; i < name_length; i++){
       uint32_t length_st_name;
       arrToVar(length_st_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_name-1]=0;
-      this->st_name = (char *)(inbuffer + offset-1);
+      this->st_name = ros::StringView((const char *)(inbuffer + offset), length_st_name, false);
       offset += length_st_name;
-        memcpy( &(this->name[i]), &(this->st_name), sizeof(char*));
+        memcpy( &(this->name[i]), &(this->st_name), sizeof(ros::StringView));
       }
       uint32_t position_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -114,11 +127,11 @@ namespace sensor_msgs
       position_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->position_length);
       if(position_lengthT > position_length)
-        this->position = (float*)realloc(this->position, position_lengthT * sizeof(float));
+        this->position = (ros::float64_t*)realloc(this->position, position_lengthT * sizeof(ros::float64_t));
       position_length = position_lengthT;
       for( uint32_t i = 0; i < position_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_position));
-        memcpy( &(this->position[i]), &(this->st_position), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_position));
+        memcpy( &(this->position[i]), &(this->st_position), sizeof(ros::float64_t));
       }
       uint32_t velocity_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -126,11 +139,11 @@ namespace sensor_msgs
       velocity_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->velocity_length);
       if(velocity_lengthT > velocity_length)
-        this->velocity = (float*)realloc(this->velocity, velocity_lengthT * sizeof(float));
+        this->velocity = (ros::float64_t*)realloc(this->velocity, velocity_lengthT * sizeof(ros::float64_t));
       velocity_length = velocity_lengthT;
       for( uint32_t i = 0; i < velocity_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocity));
-        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_velocity));
+        memcpy( &(this->velocity[i]), &(this->st_velocity), sizeof(ros::float64_t));
       }
       uint32_t effort_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -138,11 +151,11 @@ namespace sensor_msgs
       effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->effort_length);
       if(effort_lengthT > effort_length)
-        this->effort = (float*)realloc(this->effort, effort_lengthT * sizeof(float));
+        this->effort = (ros::float64_t*)realloc(this->effort, effort_lengthT * sizeof(ros::float64_t));
       effort_length = effort_lengthT;
       for( uint32_t i = 0; i < effort_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_effort));
-        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_effort));
+        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(ros::float64_t));
       }
      return offset;
     }
@@ -0,0 +1,71 @@
+#ifndef _ROS_sensor_msgs_JointStateBounded_h
+#define _ROS_sensor_msgs_JointStateBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "std_msgs/Header.h"
+
+namespace sensor_msgs
+{
+
+  /* sensor_msgs/JointState with inline storage for up to JOINTS joints */
+  template<uint32_t JOINTS>
+  class JointStateBounded : public ros::BoundedMsg
+  {
+    public:
+      std_msgs::Header header;
+      uint32_t name_length;
+      ros::StringView name[JOINTS];
+      uint32_t position_length;
+      ros::float64_t position[JOINTS];
+      uint32_t velocity_length;
+      ros::float64_t velocity[JOINTS];
+      uint32_t effort_length;
+      ros::float64_t effort[JOINTS];
+
+    JointStateBounded():
+      header(),
+      name_length(0), name(),
+      position_length(0), position(),
+      velocity_length(0), velocity(),
+      effort_length(0), effort()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      offset += serializeBoundedStrings(outbuffer + offset, this->name, name_length);
+      offset += serializeBoundedFloat64(outbuffer + offset, this->position, position_length);
+      offset += serializeBoundedFloat64(outbuffer + offset, this->velocity, velocity_length);
+      offset += serializeBoundedFloat64(outbuffer + offset, this->effort, effort_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      return this->header.serializedLength() + serializedLengthStrings(this->name, name_length) +
+             4 + position_length * 8 + 4 + velocity_length * 8 + 4 + effort_length * 8;
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += this->header.deserialize(inbuffer + offset);
+      offset += deserializeBoundedStrings(inbuffer + offset, this->name, JOINTS, name_length);
+      offset += deserializeBoundedFloat64(inbuffer + offset, this->position, JOINTS, position_length);
+      offset += deserializeBoundedFloat64(inbuffer + offset, this->velocity, JOINTS, velocity_length);
+      offset += deserializeBoundedFloat64(inbuffer + offset, this->effort, JOINTS, effort_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "sensor_msgs/JointState"; };
+    virtual const char * getMD5() override { return "3066dcd76a6cfaef579bd0f34173e9fd"; };
+
+  };
+
+}
+#endif
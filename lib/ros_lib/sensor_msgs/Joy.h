@@ -40,38 +40,33 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->axes_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->axes_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->axes_length);
-      for( uint32_t i = 0; i < axes_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_axesi;
-      u_axesi.real = this->axes[i];
-      *(outbuffer + offset + 0) = (u_axesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_axesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_axesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_axesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->axes[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->axes, axes_length);
       *(outbuffer + offset + 0) = (this->buttons_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->buttons_length >> (8 * 1)) & 0xFF;
       *(outbuffer + offset + 2) = (this->buttons_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->buttons_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->buttons_length);
-      for( uint32_t i = 0; i < buttons_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_buttonsi;
-      u_buttonsi.real = this->buttons[i];
-      *(outbuffer + offset + 0) = (u_buttonsi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_buttonsi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_buttonsi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_buttonsi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->buttons[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->buttons, buttons_length);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->axes_length);
+      offset += axes_length * sizeof(this->axes[0]);
+      offset += sizeof(this->buttons_length);
+      offset += buttons_length * sizeof(this->buttons[0]);
+      return offset;
+    }
+
+    /* largest size with up to the given frame_id chars, axes and buttons */
+    static constexpr int maxSerializedLength(int frame_id, int axes, int buttons)
+    {
+      return std_msgs::Header::maxSerializedLength(frame_id) + 4 + axes * 4 + 4 + buttons * 4;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -84,20 +79,7 @@ namespace sensor_msgs
       if(axes_lengthT > axes_length)
         this->axes = (float*)realloc(this->axes, axes_lengthT * sizeof(float));
       axes_length = axes_lengthT;
-      for( uint32_t i = 0; i < axes_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_axes;
-      u_st_axes.base = 0;
-      u_st_axes.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_axes.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_axes.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_axes.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_axes = u_st_axes.real;
-      offset += sizeof(this->st_axes);
-        memcpy( &(this->axes[i]), &(this->st_axes), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->axes, axes_length);
       uint32_t buttons_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       buttons_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       buttons_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
@@ -106,20 +88,7 @@ namespace sensor_msgs
       if(buttons_lengthT > buttons_length)
         this->buttons = (int32_t*)realloc(this->buttons, buttons_lengthT * sizeof(int32_t));
       buttons_length = buttons_lengthT;
-      for( uint32_t i = 0; i < buttons_length; i++){
-      union {
-        int32_t real;
-        uint32_t base;
-      } u_st_buttons;
-      u_st_buttons.base = 0;
-      u_st_buttons.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_buttons.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_buttons.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_buttons.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_buttons = u_st_buttons.real;
-      offset += sizeof(this->st_buttons);
-        memcpy( &(this->buttons[i]), &(this->st_buttons), sizeof(int32_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->buttons, buttons_length);
      return offset;
     }
 
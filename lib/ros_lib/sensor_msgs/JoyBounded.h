@@ -0,0 +1,60 @@
+#ifndef _ROS_sensor_msgs_JoyBounded_h
+#define _ROS_sensor_msgs_JoyBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "std_msgs/Header.h"
+
+namespace sensor_msgs
+{
+
+  /* sensor_msgs/Joy with inline storage for up to AXES axes and BUTTONS buttons */
+  template<uint32_t AXES, uint32_t BUTTONS>
+  class JoyBounded : public ros::BoundedMsg
+  {
+    public:
+      std_msgs::Header header;
+      uint32_t axes_length;
+      float axes[AXES];
+      uint32_t buttons_length;
+      int32_t buttons[BUTTONS];
+
+    JoyBounded():
+      header(),
+      axes_length(0), axes(),
+      buttons_length(0), buttons()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      offset += serializeBounded(outbuffer + offset, this->axes, axes_length);
+      offset += serializeBounded(outbuffer + offset, this->buttons, buttons_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      return this->header.serializedLength() + 4 + axes_length * sizeof(float) + 4 + buttons_length * sizeof(int32_t);
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += this->header.deserialize(inbuffer + offset);
+      offset += deserializeBounded(inbuffer + offset, this->axes, AXES, axes_length);
+      offset += deserializeBounded(inbuffer + offset, this->buttons, BUTTONS, buttons_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "sensor_msgs/Joy"; };
+    virtual const char * getMD5() override { return "5a9ea5f83505693b71e785041e67a8bb"; };
+
+  };
+
+}
+#endif
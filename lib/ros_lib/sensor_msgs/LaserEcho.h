@@ -30,18 +30,15 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->echoes_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->echoes_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->echoes_length);
-      for( uint32_t i = 0; i < echoes_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_echoesi;
-      u_echoesi.real = this->echoes[i];
-      *(outbuffer + offset + 0) = (u_echoesi.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_echoesi.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_echoesi.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_echoesi.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->echoes[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->echoes, echoes_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->echoes_length);
+      offset += echoes_length * sizeof(this->echoes[0]);
       return offset;
     }
 
@@ -56,20 +53,7 @@ namespace sensor_msgs
       if(echoes_lengthT > echoes_length)
         this->echoes = (float*)realloc(this->echoes, echoes_lengthT * sizeof(float));
       echoes_length = echoes_lengthT;
-      for( uint32_t i = 0; i < echoes_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_echoes;
-      u_st_echoes.base = 0;
-      u_st_echoes.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_echoes.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_echoes.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_echoes.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_echoes = u_st_echoes.real;
-      offset += sizeof(this->st_echoes);
-        memcpy( &(this->echoes[i]), &(this->st_echoes), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->echoes, echoes_length);
      return offset;
     }
 
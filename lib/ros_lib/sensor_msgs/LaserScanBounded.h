@@ -0,0 +1,88 @@
+#ifndef _ROS_sensor_msgs_LaserScanBounded_h
+#define _ROS_sensor_msgs_LaserScanBounded_h
+
+#include <stdint.h>
+#include <string.h>
+#include "ros/bounded_msg.h"
+#include "std_msgs/Header.h"
+
+namespace sensor_msgs
+{
+
+  /* sensor_msgs/LaserScan with inline storage for up to POINTS ranges and intensities */
+  template<uint32_t POINTS>
+  class LaserScanBounded : public ros::BoundedMsg
+  {
+    public:
+      std_msgs::Header header;
+      float angle_min;
+      float angle_max;
+      float angle_increment;
+      float time_increment;
+      float scan_time;
+      float range_min;
+      float range_max;
+      uint32_t ranges_length;
+      float ranges[POINTS];
+      uint32_t intensities_length;
+      float intensities[POINTS];
+
+    LaserScanBounded():
+      header(),
+      angle_min(0),
+      angle_max(0),
+      angle_increment(0),
+      time_increment(0),
+      scan_time(0),
+      range_min(0),
+      range_max(0),
+      ranges_length(0), ranges(),
+      intensities_length(0), intensities()
+    {
+    }
+
+    virtual int serialize(unsigned char *outbuffer) const override
+    {
+      int offset = 0;
+      offset += this->header.serialize(outbuffer + offset);
+      offset += serializeValue(outbuffer + offset, this->angle_min);
+      offset += serializeValue(outbuffer + offset, this->angle_max);
+      offset += serializeValue(outbuffer + offset, this->angle_increment);
+      offset += serializeValue(outbuffer + offset, this->time_increment);
+      offset += serializeValue(outbuffer + offset, this->scan_time);
+      offset += serializeValue(outbuffer + offset, this->range_min);
+      offset += serializeValue(outbuffer + offset, this->range_max);
+      offset += serializeBounded(outbuffer + offset, this->ranges, ranges_length);
+      offset += serializeBounded(outbuffer + offset, this->intensities, intensities_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      return this->header.serializedLength() + 7 * sizeof(float) + 4 + ranges_length * sizeof(float) + 4 + intensities_length * sizeof(float);
+    }
+
+    virtual int deserialize(unsigned char *inbuffer) override
+    {
+      int offset = 0;
+      truncated = false;
+      offset += this->header.deserialize(inbuffer + offset);
+      offset += deserializeValue(inbuffer + offset, this->angle_min);
+      offset += deserializeValue(inbuffer + offset, this->angle_max);
+      offset += deserializeValue(inbuffer + offset, this->angle_increment);
+      offset += deserializeValue(inbuffer + offset, this->time_increment);
+      offset += deserializeValue(inbuffer + offset, this->scan_time);
+      offset += deserializeValue(inbuffer + offset, this->range_min);
+      offset += deserializeValue(inbuffer + offset, this->range_max);
+      offset += deserializeBounded(inbuffer + offset, this->ranges, POINTS, ranges_length);
+      offset += deserializeBounded(inbuffer + offset, this->intensities, POINTS, intensities_length);
+     return offset;
+    }
+
+    virtual const char * getType() override { return "sensor_msgs/LaserScan"; };
+    virtual const char * getMD5() override { return "90c7ef2dc6895d81024acba2ac42f369"; };
+
+  };
+
+}
+#endif
@@ -0,0 +1,45 @@
+#ifndef _ROS_sensor_msgs_LaserScanStream_h
+#define _ROS_sensor_msgs_LaserScanStream_h
+
+#include "ros/subscriber.h"
+#include "sensor_msgs/LaserScan.h"
+
+namespace sensor_msgs
+{
+
+  /*
+   * Streaming subscriber for sensor_msgs/LaserScan of any size. Derive from
+   * it and override onValue(); the field argument is one of the enum
+   * values, e.g. RANGES with the index of each range.
+   */
+  class LaserScanStream : public ros::StreamSubscriber<sensor_msgs::LaserScan>
+  {
+    public:
+      enum
+      {
+        HEADER_SEQ, HEADER_STAMP_SEC, HEADER_STAMP_NSEC, HEADER_FRAME_ID,
+        ANGLE_MIN, ANGLE_MAX, ANGLE_INCREMENT, TIME_INCREMENT, SCAN_TIME,
+        RANGE_MIN, RANGE_MAX, RANGES, INTENSITIES,
+        FIELDS
+      };
+
+    LaserScanStream(const char * topic_name) :
+      ros::StreamSubscriber<sensor_msgs::LaserScan>(topic_name, layout(), FIELDS)
+    {
+    }
+
+    static const ros::StreamField * layout()
+    {
+      static const ros::StreamField fields[FIELDS] =
+      {
+        {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_STRING, 1, 0},
+        {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1},
+        {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_VALUE, 4, 1}, {ros::STREAM_ARRAY, 4, 0}, {ros::STREAM_ARRAY, 4, 0}
+      };
+      return fields;
+    }
+
+  };
+
+}
+#endif
@@ -18,7 +18,7 @@ namespace sensor_msgs
       _header_type header;
       typedef geometry_msgs::Vector3 _magnetic_field_type;
       _magnetic_field_type magnetic_field;
-      float magnetic_field_covariance[9];
+      ros::float64_t magnetic_field_covariance[9];
 
     MagneticField():
       header(),
@@ -33,18 +33,27 @@ namespace sensor_msgs
       offset += this->header.serialize(outbuffer + offset);
       offset += this->magnetic_field.serialize(outbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->magnetic_field_covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->magnetic_field_covariance[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += this->magnetic_field.serializedLength();
+      offset += 9 * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->magnetic_field.deserialize(inbuffer + offset);
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->magnetic_field_covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->magnetic_field_covariance[i]));
       }
      return offset;
     }
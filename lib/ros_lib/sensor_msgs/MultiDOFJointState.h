@@ -19,7 +19,7 @@ namespace sensor_msgs
       typedef std_msgs::Header _header_type;
       _header_type header;
       uint32_t joint_names_length;
-      typedef char* _joint_names_type;
+      typedef ros::StringView _joint_names_type;
       _joint_names_type st_joint_names;
       _joint_names_type * joint_names;
       uint32_t transforms_length;
@@ -54,10 +54,10 @@ namespace sensor_msgs
       *(outbuffer + offset + 3) = (this->joint_names_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->joint_names_length);
       for( uint32_t i = 0; i < joint_names_length; i++){
-      uint32_t length_joint_namesi = strlen(this->joint_names[i]);
+      uint32_t length_joint_namesi = this->joint_names[i].size();
       varToArr(outbuffer + offset, length_joint_namesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->joint_names[i], length_joint_namesi);
+      memcpy(outbuffer + offset, this->joint_names[i].data(), length_joint_namesi);
       offset += length_joint_namesi;
       }
       *(outbuffer + offset + 0) = (this->transforms_length >> (8 * 0)) & 0xFF;
@@ -87,6 +87,23 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->joint_names_length);
+      for( uint32_t i = 0; i < joint_names_length; i++){
+      offset += 4 + this->joint_names[i].size();
+      }
+      offset += sizeof(this->transforms_length);
+      offset += transforms_length * geometry_msgs::Transform::maxSerializedLength();
+      offset += sizeof(this->twist_length);
+      offset += twist_length * geometry_msgs::Twist::maxSerializedLength();
+      offset += sizeof(this->wrench_length);
+      offset += wrench_length * geometry_msgs::Wrench::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -97,19 +114,15 @@ namespace sensor_msgs
       joint_names_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->joint_names_length);
       if(joint_names_lengthT > joint_names_length)
-        this->joint_names = (char**)realloc(this->joint_names, joint_names_lengthT * sizeof(char*));
+        this->joint_names = (ros::StringView*)realloc(this->joint_names, joint_names_lengthT * sizeof(ros::StringView));
       joint_names_length = joint_names_lengthT;
       for( uint32_t i = 0; i < joint_names_length; i++){
       uint32_t length_st_joint_names;
       arrToVar(length_st_joint_names, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_joint_names; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_joint_names-1]=0;
-      this->st_joint_names = (char *)(inbuffer + offset-1);
+      this->st_joint_names = ros::StringView((const char *)(inbuffer + offset), length_st_joint_names, false);
       offset += length_st_joint_names;
-        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(char*));
+        memcpy( &(this->joint_names[i]), &(this->st_joint_names), sizeof(ros::StringView));
       }
       uint32_t transforms_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       transforms_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -34,10 +34,12 @@ namespace sensor_msgs
       typedef sensor_msgs::LaserEcho _ranges_type;
       _ranges_type st_ranges;
       _ranges_type * ranges;
+      uint32_t ranges_capacity;
       uint32_t intensities_length;
       typedef sensor_msgs::LaserEcho _intensities_type;
       _intensities_type st_intensities;
       _intensities_type * intensities;
+      uint32_t intensities_capacity;
 
     MultiEchoLaserScan():
       header(),
@@ -48,8 +50,8 @@ namespace sensor_msgs
       scan_time(0),
       range_min(0),
       range_max(0),
-      ranges_length(0), st_ranges(), ranges(nullptr),
-      intensities_length(0), st_intensities(), intensities(nullptr)
+      ranges_length(0), st_ranges(), ranges(nullptr), ranges_capacity(0),
+      intensities_length(0), st_intensities(), intensities(nullptr), intensities_capacity(0)
     {
     }
 
@@ -146,6 +148,28 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->angle_min);
+      offset += sizeof(this->angle_max);
+      offset += sizeof(this->angle_increment);
+      offset += sizeof(this->time_increment);
+      offset += sizeof(this->scan_time);
+      offset += sizeof(this->range_min);
+      offset += sizeof(this->range_max);
+      offset += sizeof(this->ranges_length);
+      for( uint32_t i = 0; i < ranges_length; i++){
+      offset += this->ranges[i].serializedLength();
+      }
+      offset += sizeof(this->intensities_length);
+      for( uint32_t i = 0; i < intensities_length; i++){
+      offset += this->intensities[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -232,24 +256,20 @@ namespace sensor_msgs
       ranges_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       ranges_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->ranges_length);
-      if(ranges_lengthT > ranges_length)
-        this->ranges = (sensor_msgs::LaserEcho*)realloc(this->ranges, ranges_lengthT * sizeof(sensor_msgs::LaserEcho));
+      this->ranges = ros::reserveMsgs(this->ranges, this->ranges_capacity, ranges_lengthT);
       ranges_length = ranges_lengthT;
       for( uint32_t i = 0; i < ranges_length; i++){
-      offset += this->st_ranges.deserialize(inbuffer + offset);
-        memcpy( &(this->ranges[i]), &(this->st_ranges), sizeof(sensor_msgs::LaserEcho));
+      offset += this->ranges[i].deserialize(inbuffer + offset);
       }
       uint32_t intensities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
       intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       intensities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->intensities_length);
-      if(intensities_lengthT > intensities_length)
-        this->intensities = (sensor_msgs::LaserEcho*)realloc(this->intensities, intensities_lengthT * sizeof(sensor_msgs::LaserEcho));
+      this->intensities = ros::reserveMsgs(this->intensities, this->intensities_capacity, intensities_lengthT);
       intensities_length = intensities_lengthT;
       for( uint32_t i = 0; i < intensities_length; i++){
-      offset += this->st_intensities.deserialize(inbuffer + offset);
-        memcpy( &(this->intensities[i]), &(this->st_intensities), sizeof(sensor_msgs::LaserEcho));
+      offset += this->intensities[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -18,13 +18,13 @@ namespace sensor_msgs
       _header_type header;
       typedef sensor_msgs::NavSatStatus _status_type;
       _status_type status;
-      typedef float _latitude_type;
+      typedef ros::float64_t _latitude_type;
       _latitude_type latitude;
-      typedef float _longitude_type;
+      typedef ros::float64_t _longitude_type;
       _longitude_type longitude;
-      typedef float _altitude_type;
+      typedef ros::float64_t _altitude_type;
       _altitude_type altitude;
-      float position_covariance[9];
+      ros::float64_t position_covariance[9];
       typedef uint8_t _position_covariance_type_type;
       _position_covariance_type_type position_covariance_type;
       enum { COVARIANCE_TYPE_UNKNOWN =  0 };
@@ -48,27 +48,40 @@ namespace sensor_msgs
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
       offset += this->status.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->latitude);
-      offset += serializeAvrFloat64(outbuffer + offset, this->longitude);
-      offset += serializeAvrFloat64(outbuffer + offset, this->altitude);
+      offset += serializeFloat64(outbuffer + offset, this->latitude);
+      offset += serializeFloat64(outbuffer + offset, this->longitude);
+      offset += serializeFloat64(outbuffer + offset, this->altitude);
       for( uint32_t i = 0; i < 9; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->position_covariance[i]);
+      offset += serializeFloat64(outbuffer + offset, this->position_covariance[i]);
       }
       *(outbuffer + offset + 0) = (this->position_covariance_type >> (8 * 0)) & 0xFF;
       offset += sizeof(this->position_covariance_type);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += this->status.serializedLength();
+      offset += 8;
+      offset += 8;
+      offset += 8;
+      offset += 9 * 8;
+      offset += sizeof(this->position_covariance_type);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
       offset += this->status.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->latitude));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->longitude));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->altitude));
+      offset += deserializeFloat64(inbuffer + offset, &(this->latitude));
+      offset += deserializeFloat64(inbuffer + offset, &(this->longitude));
+      offset += deserializeFloat64(inbuffer + offset, &(this->altitude));
       for( uint32_t i = 0; i < 9; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->position_covariance[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->position_covariance[i]));
       }
       this->position_covariance_type =  ((uint8_t) (*(inbuffer + offset)));
       offset += sizeof(this->position_covariance_type);
@@ -25,11 +25,12 @@ namespace sensor_msgs
       typedef sensor_msgs::ChannelFloat32 _channels_type;
       _channels_type st_channels;
       _channels_type * channels;
+      uint32_t channels_capacity;
 
     PointCloud():
       header(),
       points_length(0), st_points(), points(nullptr),
-      channels_length(0), st_channels(), channels(nullptr)
+      channels_length(0), st_channels(), channels(nullptr), channels_capacity(0)
     {
     }
 
@@ -56,6 +57,19 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->points_length);
+      offset += points_length * geometry_msgs::Point32::maxSerializedLength();
+      offset += sizeof(this->channels_length);
+      for( uint32_t i = 0; i < channels_length; i++){
+      offset += this->channels[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -77,12 +91,10 @@ namespace sensor_msgs
       channels_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       channels_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->channels_length);
-      if(channels_lengthT > channels_length)
-        this->channels = (sensor_msgs::ChannelFloat32*)realloc(this->channels, channels_lengthT * sizeof(sensor_msgs::ChannelFloat32));
+      this->channels = ros::reserveMsgs(this->channels, this->channels_capacity, channels_lengthT);
       channels_length = channels_lengthT;
       for( uint32_t i = 0; i < channels_length; i++){
-      offset += this->st_channels.deserialize(inbuffer + offset);
-        memcpy( &(this->channels[i]), &(this->st_channels), sizeof(sensor_msgs::ChannelFloat32));
+      offset += this->channels[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -94,10 +94,7 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
       union {
         bool real;
         uint8_t base;
@@ -108,6 +105,25 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->height);
+      offset += sizeof(this->width);
+      offset += sizeof(this->fields_length);
+      for( uint32_t i = 0; i < fields_length; i++){
+      offset += this->fields[i].serializedLength();
+      }
+      offset += sizeof(this->is_bigendian);
+      offset += sizeof(this->point_step);
+      offset += sizeof(this->row_step);
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
+      offset += sizeof(this->is_dense);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -157,13 +173,18 @@ namespace sensor_msgs
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->data_length);
-      if(data_lengthT > data_length)
-        this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
-      data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      this->st_data =  ((uint8_t) (*(inbuffer + offset)));
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(uint8_t));
+      if(data_view_)
+      {
+        this->data = inbuffer + offset;  // no copy, see setDataView()
+        data_length = data_lengthT;
+        offset += data_length;
+      }
+      else
+      {
+        if(data_lengthT > data_length)
+          this->data = (uint8_t*)realloc(this->data, data_lengthT * sizeof(uint8_t));
+        data_length = data_lengthT;
+        offset += deserializeArray(inbuffer + offset, this->data, data_length);
       }
       union {
         bool real;
@@ -179,6 +200,24 @@ namespace sensor_msgs
     virtual const char * getType() override { return "sensor_msgs/PointCloud2"; };
     virtual const char * getMD5() override { return "1158d486dd51d683ce2f1be655c3c181"; };
 
+    /*
+     * Opt-in zero copy receive: data points straight into the node
+     * handle's receive buffer and is only valid during the subscriber
+     * callback. Set it before the first message arrives; switching drops
+     * the current data, and frees it if deserialize() made a heap copy.
+     */
+    void setDataView(bool view)
+    {
+      if (!data_view_)
+        free(data);
+      data_view_ = view;
+      data_length = 0;
+      data = nullptr;
+    }
+
+    protected:
+      bool data_view_ = false;
+
   };
 
 }
@@ -12,7 +12,7 @@ namespace sensor_msgs
   class PointField : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
       typedef uint32_t _offset_type;
       _offset_type offset;
@@ -40,10 +40,10 @@ namespace sensor_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       *(outbuffer + offset + 0) = (this->offset >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->offset >> (8 * 1)) & 0xFF;
@@ -60,17 +60,23 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += sizeof(this->offset);
+      offset += sizeof(this->datatype);
+      offset += sizeof(this->count);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       this->offset =  ((uint32_t) (*(inbuffer + offset)));
       this->offset |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -87,6 +87,18 @@ namespace sensor_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->radiation_type);
+      offset += sizeof(this->field_of_view);
+      offset += sizeof(this->min_range);
+      offset += sizeof(this->max_range);
+      offset += sizeof(this->range);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -15,9 +15,9 @@ namespace sensor_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef float _relative_humidity_type;
+      typedef ros::float64_t _relative_humidity_type;
       _relative_humidity_type relative_humidity;
-      typedef float _variance_type;
+      typedef ros::float64_t _variance_type;
       _variance_type variance;
 
     RelativeHumidity():
@@ -31,8 +31,17 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      offset += serializeAvrFloat64(outbuffer + offset, this->relative_humidity);
-      offset += serializeAvrFloat64(outbuffer + offset, this->variance);
+      offset += serializeFloat64(outbuffer + offset, this->relative_humidity);
+      offset += serializeFloat64(outbuffer + offset, this->variance);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 8;
+      offset += 8;
       return offset;
     }
 
@@ -40,8 +49,8 @@ namespace sensor_msgs
     {
       int offset = 0;
       offset += this->header.deserialize(inbuffer + offset);
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->relative_humidity));
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->variance));
+      offset += deserializeFloat64(inbuffer + offset, &(this->relative_humidity));
+      offset += deserializeFloat64(inbuffer + offset, &(this->variance));
      return offset;
     }
 
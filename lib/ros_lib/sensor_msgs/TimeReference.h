@@ -18,7 +18,7 @@ namespace sensor_msgs
       _header_type header;
       typedef ros::Time _time_ref_type;
       _time_ref_type time_ref;
-      typedef const char* _source_type;
+      typedef ros::StringView _source_type;
       _source_type source;
 
     TimeReference():
@@ -42,14 +42,24 @@ namespace sensor_msgs
       *(outbuffer + offset + 2) = (this->time_ref.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->time_ref.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->time_ref.nsec);
-      uint32_t length_source = strlen(this->source);
+      uint32_t length_source = this->source.size();
       varToArr(outbuffer + offset, length_source);
       offset += 4;
-      memcpy(outbuffer + offset, this->source, length_source);
+      memcpy(outbuffer + offset, this->source.data(), length_source);
       offset += length_source;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += sizeof(this->time_ref.sec);
+      offset += sizeof(this->time_ref.nsec);
+      offset += 4 + this->source.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -67,11 +77,7 @@ namespace sensor_msgs
       uint32_t length_source;
       arrToVar(length_source, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_source; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_source-1]=0;
-      this->source = (char *)(inbuffer + offset-1);
+      this->source = ros::StringView((const char *)(inbuffer + offset), length_source, false);
       offset += length_source;
      return offset;
     }
@@ -51,6 +51,16 @@ namespace shape_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->triangles_length);
+      offset += triangles_length * shape_msgs::MeshTriangle::maxSerializedLength();
+      offset += sizeof(this->vertices_length);
+      offset += vertices_length * geometry_msgs::Point::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
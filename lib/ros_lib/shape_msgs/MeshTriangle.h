@@ -22,26 +22,25 @@ namespace shape_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      for( uint32_t i = 0; i < 3; i++){
-      *(outbuffer + offset + 0) = (this->vertex_indices[i] >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->vertex_indices[i] >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->vertex_indices[i] >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->vertex_indices[i] >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->vertex_indices[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->vertex_indices, 3);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 12;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      for( uint32_t i = 0; i < 3; i++){
-      this->vertex_indices[i] =  ((uint32_t) (*(inbuffer + offset)));
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->vertex_indices[i] |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->vertex_indices[i]);
-      }
+      offset += deserializeArray(inbuffer + offset, this->vertex_indices, 3);
      return offset;
     }
 
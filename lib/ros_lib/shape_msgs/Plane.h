@@ -12,7 +12,7 @@ namespace shape_msgs
   class Plane : public ros::Msg
   {
     public:
-      float coef[4];
+      ros::float64_t coef[4];
 
     Plane():
       coef()
@@ -23,16 +23,27 @@ namespace shape_msgs
     {
       int offset = 0;
       for( uint32_t i = 0; i < 4; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->coef[i]);
+      offset += serializeFloat64(outbuffer + offset, this->coef[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 32;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       for( uint32_t i = 0; i < 4; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->coef[i]));
+      offset += deserializeFloat64(inbuffer + offset, &(this->coef[i]));
       }
      return offset;
     }
@@ -15,7 +15,7 @@ namespace shape_msgs
       typedef uint8_t _type_type;
       _type_type type;
       uint32_t dimensions_length;
-      typedef float _dimensions_type;
+      typedef ros::float64_t _dimensions_type;
       _dimensions_type st_dimensions;
       _dimensions_type * dimensions;
       enum { BOX = 1 };
@@ -48,11 +48,20 @@ namespace shape_msgs
       *(outbuffer + offset + 3) = (this->dimensions_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->dimensions_length);
       for( uint32_t i = 0; i < dimensions_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->dimensions[i]);
+      offset += serializeFloat64(outbuffer + offset, this->dimensions[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->type);
+      offset += sizeof(this->dimensions_length);
+      offset += dimensions_length * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -64,11 +73,11 @@ namespace shape_msgs
       dimensions_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->dimensions_length);
       if(dimensions_lengthT > dimensions_length)
-        this->dimensions = (float*)realloc(this->dimensions, dimensions_lengthT * sizeof(float));
+        this->dimensions = (ros::float64_t*)realloc(this->dimensions, dimensions_lengthT * sizeof(ros::float64_t));
       dimensions_length = dimensions_lengthT;
       for( uint32_t i = 0; i < dimensions_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_dimensions));
-        memcpy( &(this->dimensions[i]), &(this->st_dimensions), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_dimensions));
+        memcpy( &(this->dimensions[i]), &(this->st_dimensions), sizeof(ros::float64_t));
       }
      return offset;
     }
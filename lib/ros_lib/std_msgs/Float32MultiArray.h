@@ -35,18 +35,16 @@ namespace std_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_datai.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_datai.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_datai.base >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->layout.serializedLength();
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -62,20 +60,7 @@ namespace std_msgs
       if(data_lengthT > data_length)
         this->data = (float*)realloc(this->data, data_lengthT * sizeof(float));
       data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        float real;
-        uint32_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint32_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_data.base |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_data.base |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_data.base |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(float));
-      }
+      offset += deserializeArray(inbuffer + offset, this->data, data_length);
      return offset;
     }
 
@@ -12,7 +12,7 @@ namespace std_msgs
   class Float64 : public ros::Msg
   {
     public:
-      typedef float _data_type;
+      typedef ros::float64_t _data_type;
       _data_type data;
 
     Float64():
@@ -23,14 +23,25 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      offset += serializeAvrFloat64(outbuffer + offset, this->data);
+      offset += serializeFloat64(outbuffer + offset, this->data);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 8;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->data));
+      offset += deserializeFloat64(inbuffer + offset, &(this->data));
      return offset;
     }
 
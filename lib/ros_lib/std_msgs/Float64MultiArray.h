@@ -16,7 +16,7 @@ namespace std_msgs
       typedef std_msgs::MultiArrayLayout _layout_type;
       _layout_type layout;
       uint32_t data_length;
-      typedef float _data_type;
+      typedef ros::float64_t _data_type;
       _data_type st_data;
       _data_type * data;
 
@@ -36,11 +36,20 @@ namespace std_msgs
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
       for( uint32_t i = 0; i < data_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->data[i]);
+      offset += serializeFloat64(outbuffer + offset, this->data[i]);
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->layout.serializedLength();
+      offset += sizeof(this->data_length);
+      offset += data_length * 8;
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -51,11 +60,11 @@ namespace std_msgs
       data_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->data_length);
       if(data_lengthT > data_length)
-        this->data = (float*)realloc(this->data, data_lengthT * sizeof(float));
+        this->data = (ros::float64_t*)realloc(this->data, data_lengthT * sizeof(ros::float64_t));
       data_length = data_lengthT;
       for( uint32_t i = 0; i < data_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_data));
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_data));
+        memcpy( &(this->data[i]), &(this->st_data), sizeof(ros::float64_t));
       }
      return offset;
     }
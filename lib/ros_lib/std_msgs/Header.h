@@ -17,7 +17,7 @@ namespace std_msgs
       _seq_type seq;
       typedef ros::Time _stamp_type;
       _stamp_type stamp;
-      typedef const char* _frame_id_type;
+      typedef ros::StringView _frame_id_type;
       _frame_id_type frame_id;
 
     Header():
@@ -45,14 +45,30 @@ namespace std_msgs
       *(outbuffer + offset + 2) = (this->stamp.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->stamp.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->stamp.nsec);
-      uint32_t length_frame_id = strlen(this->frame_id);
+      uint32_t length_frame_id = this->frame_id.size();
       varToArr(outbuffer + offset, length_frame_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->frame_id, length_frame_id);
+      memcpy(outbuffer + offset, this->frame_id.data(), length_frame_id);
       offset += length_frame_id;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->seq);
+      offset += sizeof(this->stamp.sec);
+      offset += sizeof(this->stamp.nsec);
+      offset += 4 + this->frame_id.size();
+      return offset;
+    }
+
+    /* largest size with a frame_id of up to frame_id chars */
+    static constexpr int maxSerializedLength(int frame_id)
+    {
+      return 12 + 4 + frame_id;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -74,11 +90,7 @@ namespace std_msgs
       uint32_t length_frame_id;
       arrToVar(length_frame_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_frame_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_frame_id-1]=0;
-      this->frame_id = (char *)(inbuffer + offset-1);
+      this->frame_id = ros::StringView((const char *)(inbuffer + offset), length_frame_id, false);
       offset += length_frame_id;
      return offset;
     }
@@ -35,22 +35,16 @@ namespace std_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_datai;
-      u_datai.real = this->data[i];
-      *(outbuffer + offset + 0) = (u_datai.base >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (u_datai.base >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (u_datai.base >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (u_datai.base >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (u_datai.base >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (u_datai.base >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (u_datai.base >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (u_datai.base >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->layout.serializedLength();
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -66,24 +60,7 @@ namespace std_msgs
       if(data_lengthT > data_length)
         this->data = (int64_t*)realloc(this->data, data_lengthT * sizeof(int64_t));
       data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      union {
-        int64_t real;
-        uint64_t base;
-      } u_st_data;
-      u_st_data.base = 0;
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 0))) << (8 * 0);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      u_st_data.base |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      this->st_data = u_st_data.real;
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(int64_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->data, data_length);
      return offset;
     }
 
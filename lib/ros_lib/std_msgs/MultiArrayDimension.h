@@ -12,7 +12,7 @@ namespace std_msgs
   class MultiArrayDimension : public ros::Msg
   {
     public:
-      typedef const char* _label_type;
+      typedef ros::StringView _label_type;
       _label_type label;
       typedef uint32_t _size_type;
       _size_type size;
@@ -29,10 +29,10 @@ namespace std_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_label = strlen(this->label);
+      uint32_t length_label = this->label.size();
       varToArr(outbuffer + offset, length_label);
       offset += 4;
-      memcpy(outbuffer + offset, this->label, length_label);
+      memcpy(outbuffer + offset, this->label.data(), length_label);
       offset += length_label;
       *(outbuffer + offset + 0) = (this->size >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->size >> (8 * 1)) & 0xFF;
@@ -47,17 +47,22 @@ namespace std_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->label.size();
+      offset += sizeof(this->size);
+      offset += sizeof(this->stride);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_label;
       arrToVar(length_label, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_label; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_label-1]=0;
-      this->label = (char *)(inbuffer + offset-1);
+      this->label = ros::StringView((const char *)(inbuffer + offset), length_label, false);
       offset += length_label;
       this->size =  ((uint32_t) (*(inbuffer + offset)));
       this->size |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
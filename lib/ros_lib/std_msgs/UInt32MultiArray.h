@@ -35,13 +35,16 @@ namespace std_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data[i] >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data[i] >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data[i] >> (8 * 3)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->layout.serializedLength();
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -57,14 +60,7 @@ namespace std_msgs
       if(data_lengthT > data_length)
         this->data = (uint32_t*)realloc(this->data, data_lengthT * sizeof(uint32_t));
       data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      this->st_data =  ((uint32_t) (*(inbuffer + offset)));
-      this->st_data |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->st_data |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->st_data |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(uint32_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->data, data_length);
      return offset;
     }
 
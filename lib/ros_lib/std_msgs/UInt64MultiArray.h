@@ -35,17 +35,16 @@ namespace std_msgs
       *(outbuffer + offset + 2) = (this->data_length >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->data_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->data_length);
-      for( uint32_t i = 0; i < data_length; i++){
-      *(outbuffer + offset + 0) = (this->data[i] >> (8 * 0)) & 0xFF;
-      *(outbuffer + offset + 1) = (this->data[i] >> (8 * 1)) & 0xFF;
-      *(outbuffer + offset + 2) = (this->data[i] >> (8 * 2)) & 0xFF;
-      *(outbuffer + offset + 3) = (this->data[i] >> (8 * 3)) & 0xFF;
-      *(outbuffer + offset + 4) = (this->data[i] >> (8 * 4)) & 0xFF;
-      *(outbuffer + offset + 5) = (this->data[i] >> (8 * 5)) & 0xFF;
-      *(outbuffer + offset + 6) = (this->data[i] >> (8 * 6)) & 0xFF;
-      *(outbuffer + offset + 7) = (this->data[i] >> (8 * 7)) & 0xFF;
-      offset += sizeof(this->data[i]);
-      }
+      offset += serializeArray(outbuffer + offset, this->data, data_length);
+      return offset;
+    }
+
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->layout.serializedLength();
+      offset += sizeof(this->data_length);
+      offset += data_length * sizeof(this->data[0]);
       return offset;
     }
 
@@ -61,18 +60,7 @@ namespace std_msgs
       if(data_lengthT > data_length)
         this->data = (uint64_t*)realloc(this->data, data_lengthT * sizeof(uint64_t));
       data_length = data_lengthT;
-      for( uint32_t i = 0; i < data_length; i++){
-      this->st_data =  ((uint64_t) (*(inbuffer + offset)));
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 2))) << (8 * 2);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 3))) << (8 * 3);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 4))) << (8 * 4);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 5))) << (8 * 5);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 6))) << (8 * 6);
-      this->st_data |= ((uint64_t) (*(inbuffer + offset + 7))) << (8 * 7);
-      offset += sizeof(this->st_data);
-        memcpy( &(this->data[i]), &(this->st_data), sizeof(uint64_t));
-      }
+      offset += deserializeArray(inbuffer + offset, this->data, data_length);
      return offset;
     }
 
@@ -34,6 +34,17 @@ static const char SETBOOL[] = "std_srvs/SetBool";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 1;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -58,7 +69,7 @@ static const char SETBOOL[] = "std_srvs/SetBool";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _message_type;
+      typedef ros::StringView _message_type;
       _message_type message;
 
     SetBoolResponse():
@@ -77,14 +88,22 @@ static const char SETBOOL[] = "std_srvs/SetBool";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_message = strlen(this->message);
+      uint32_t length_message = this->message.size();
       varToArr(outbuffer + offset, length_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->message, length_message);
+      memcpy(outbuffer + offset, this->message.data(), length_message);
       offset += length_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -99,11 +118,7 @@ static const char SETBOOL[] = "std_srvs/SetBool";
       uint32_t length_message;
       arrToVar(length_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message-1]=0;
-      this->message = (char *)(inbuffer + offset-1);
+      this->message = ros::StringView((const char *)(inbuffer + offset), length_message, false);
       offset += length_message;
      return offset;
     }
@@ -24,6 +24,17 @@ static const char TRIGGER[] = "std_srvs/Trigger";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -40,7 +51,7 @@ static const char TRIGGER[] = "std_srvs/Trigger";
     public:
       typedef bool _success_type;
       _success_type success;
-      typedef const char* _message_type;
+      typedef ros::StringView _message_type;
       _message_type message;
 
     TriggerResponse():
@@ -59,14 +70,22 @@ static const char TRIGGER[] = "std_srvs/Trigger";
       u_success.real = this->success;
       *(outbuffer + offset + 0) = (u_success.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->success);
-      uint32_t length_message = strlen(this->message);
+      uint32_t length_message = this->message.size();
       varToArr(outbuffer + offset, length_message);
       offset += 4;
-      memcpy(outbuffer + offset, this->message, length_message);
+      memcpy(outbuffer + offset, this->message.data(), length_message);
       offset += length_message;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->success);
+      offset += 4 + this->message.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -81,11 +100,7 @@ static const char TRIGGER[] = "std_srvs/Trigger";
       uint32_t length_message;
       arrToVar(length_message, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_message; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_message-1]=0;
-      this->message = (char *)(inbuffer + offset-1);
+      this->message = ros::StringView((const char *)(inbuffer + offset), length_message, false);
       offset += length_message;
      return offset;
     }
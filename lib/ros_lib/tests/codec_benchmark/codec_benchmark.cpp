@@ -0,0 +1,454 @@
+/*
+ * rosserial message codec benchmark
+ *
+ * Host program, not an Arduino sketch. It round-trips representative
+ * instances of the message types the remote uses and reports ns per
+ * serialize / deserialize, throughput and heap allocations per call.
+ * Some of them are also decoded with the schema interpreter of
+ * GenericSubscriber, next to the generated deserialize() of the type;
+ * the exit code is 1 if one takes more than 3x as long.
+ * Results are written as JSON. Pass a previous result file to compare.
+ *
+ * Build and run from the repository root (Linux, glibc):
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/ros_lib lib/ros_lib/tests/codec_benchmark/codec_benchmark.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o codec_benchmark
+ *   ./codec_benchmark codec_benchmark.json [baseline.json]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "sensor_msgs/Joy.h"
+#include "sensor_msgs/BatteryState.h"
+#include "sensor_msgs/LaserScan.h"
+#include "sensor_msgs/Image.h"
+#include "geometry_msgs/Twist.h"
+#include "nav_msgs/Odometry.h"
+#include "tf2_msgs/TFMessage.h"
+#include "diagnostic_msgs/DiagnosticArray.h"
+#include "rosserial_msgs/Log.h"
+#include "ros/msg_schema.h"
+
+/* Count heap calls by wrapping the glibc allocator. */
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+
+static bool counting = false;
+static unsigned long allocations = 0;
+
+extern "C" void* malloc(size_t size)
+{
+  if (counting)
+    allocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+  if (counting)
+    allocations++;
+  return __libc_realloc(ptr, size);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static const double MIN_SECONDS = 0.2;   // run every loop at least this long
+
+static unsigned char wire[1 << 20];
+static unsigned char echo[1 << 20];
+
+struct Result
+{
+  const char* name;
+  int bytes;
+  double serialize_ns;
+  double deserialize_ns;
+  double allocs_per_call;
+  bool roundtrip;
+};
+
+static double elapsedNs(Clock::time_point start, Clock::time_point end)
+{
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+template<class M>
+static Result bench(const char* name, M& msg)
+{
+  Result r;
+  r.name = name;
+  r.bytes = msg.serialize(wire);
+
+  /* the receiving message is reused, like a Subscriber's member */
+  M received;
+  received.deserialize(wire);
+  r.roundtrip = received.serialize(echo) == r.bytes && memcmp(wire, echo, r.bytes) == 0;
+
+  long iterations = 1;
+  for (;;)
+  {
+    Clock::time_point t0 = Clock::now();
+    for (long i = 0; i < iterations; i++)
+    {
+      msg.serialize(wire);
+      asm volatile("" ::: "memory");
+    }
+    Clock::time_point t1 = Clock::now();
+    allocations = 0;
+    counting = true;
+    for (long i = 0; i < iterations; i++)
+    {
+      received.deserialize(wire);
+      asm volatile("" ::: "memory");
+    }
+    counting = false;
+    Clock::time_point t2 = Clock::now();
+
+    if (elapsedNs(t0, t1) >= MIN_SECONDS * 1e9 && elapsedNs(t1, t2) >= MIN_SECONDS * 1e9)
+    {
+      r.serialize_ns = elapsedNs(t0, t1) / iterations;
+      r.deserialize_ns = elapsedNs(t1, t2) / iterations;
+      r.allocs_per_call = (double) allocations / iterations;
+      return r;
+    }
+    iterations *= 2;
+  }
+}
+
+/* Message definitions as rosserial_python receives them from the master. */
+#define SEP "================================================================================\n"
+#define HEADER_MSG SEP "MSG: std_msgs/Header\nuint32 seq\ntime stamp\nstring frame_id\n"
+#define VECTOR3_MSG SEP "MSG: geometry_msgs/Vector3\nfloat64 x\nfloat64 y\nfloat64 z\n"
+#define QUATERNION_MSG SEP "MSG: geometry_msgs/Quaternion\nfloat64 x\nfloat64 y\nfloat64 z\nfloat64 w\n"
+
+static const char JOY_DEF[] = "Header header\nfloat32[] axes\nint32[] buttons\n" HEADER_MSG;
+static const char LASERSCAN_DEF[] =
+  "Header header\nfloat32 angle_min\nfloat32 angle_max\nfloat32 angle_increment\nfloat32 time_increment\n"
+  "float32 scan_time\nfloat32 range_min\nfloat32 range_max\nfloat32[] ranges\nfloat32[] intensities\n" HEADER_MSG;
+static const char ODOMETRY_DEF[] =
+  "Header header\nstring child_frame_id\ngeometry_msgs/PoseWithCovariance pose\n"
+  "geometry_msgs/TwistWithCovariance twist\n" HEADER_MSG
+  SEP "MSG: geometry_msgs/PoseWithCovariance\nPose pose\nfloat64[36] covariance\n"
+  SEP "MSG: geometry_msgs/Pose\nPoint position\nQuaternion orientation\n"
+  SEP "MSG: geometry_msgs/Point\nfloat64 x\nfloat64 y\nfloat64 z\n" QUATERNION_MSG
+  SEP "MSG: geometry_msgs/TwistWithCovariance\nTwist twist\nfloat64[36] covariance\n"
+  SEP "MSG: geometry_msgs/Twist\nVector3 linear\nVector3 angular\n" VECTOR3_MSG;
+static const char TFMESSAGE_DEF[] =
+  "geometry_msgs/TransformStamped[] transforms\n"
+  SEP "MSG: geometry_msgs/TransformStamped\nHeader header\nstring child_frame_id\nTransform transform\n" HEADER_MSG
+  SEP "MSG: geometry_msgs/Transform\nVector3 translation\nQuaternion rotation\n" VECTOR3_MSG QUATERNION_MSG;
+
+struct GenericResult
+{
+  const char* name;
+  double decode_ns;      // every field
+  double selected_ns;    // one field, the others are skipped
+  double compiled_ns;
+  int values;
+};
+
+static const double GENERIC_MAX_RATIO = 3.0;   // full generic decode vs deserialize()
+
+/*
+ * Takes every value the way a display of the fields would: numbers as
+ * they are, strings and spans where they are in the frame. A checksum
+ * over them keeps the decoder from being optimized away.
+ */
+struct SumVisitor
+{
+  uint64_t sum;
+  int values;
+
+  void onField(int, uint32_t, const ros::SchemaValue& value)
+  {
+    if (value.span)
+    {
+      sum += value.count ? value.data[0] : 0;
+      values += value.count;
+    }
+    else
+    {
+      sum += value.type == ros::SCHEMA_STRING ? value.length : value.u;
+      values++;
+    }
+  }
+};
+
+static double timeDecode(const ros::MsgSchema& schema, int bytes, const uint8_t* selected, SumVisitor& visitor)
+{
+  long iterations = 1;
+  for (;;)
+  {
+    Clock::time_point t0 = Clock::now();
+    for (long i = 0; i < iterations; i++)
+    {
+      schema.decode(wire, bytes, selected, visitor);
+      asm volatile("" ::: "memory");
+    }
+    Clock::time_point t1 = Clock::now();
+    if (elapsedNs(t0, t1) >= MIN_SECONDS * 1e9)
+      return elapsedNs(t0, t1) / iterations;
+    iterations *= 2;
+  }
+}
+
+template<class M>
+static GenericResult benchGeneric(const char* name, const char* type, const char* definition, const char* field, M& msg)
+{
+  static uint8_t schema_buffer[1024];
+  GenericResult r;
+  r.name = name;
+  r.decode_ns = -1;
+  r.selected_ns = -1;
+  r.values = 0;
+  r.compiled_ns = bench(name, msg).deserialize_ns;
+
+  ros::MsgSchema schema;
+  if (schema.compile(type, definition, schema_buffer, sizeof(schema_buffer)) < 0)
+    return r;
+  int bytes = msg.serialize(wire);
+  SumVisitor visitor = {0, 0};
+  if (!schema.decode(wire, bytes, nullptr, visitor))
+    return r;
+  r.values = visitor.values;
+
+  int id = schema.find(field);
+  if (id < 0)
+    return r;
+  uint8_t selected[(ros::SCHEMA_MAX_OPS + 7) / 8] = {0};
+  selected[id >> 3] |= 1 << (id & 7);
+  r.decode_ns = timeDecode(schema, bytes, nullptr, visitor);
+  r.selected_ns = timeDecode(schema, bytes, selected, visitor);
+  return r;
+}
+
+static double bytesPerSecond(int bytes, double ns)
+{
+  return ns > 0 ? bytes * 1e9 / ns : 0;
+}
+
+/* Read the per-message timings back from a file written by writeJson(). */
+static bool findBaseline(const char* path, const char* name, double* serialize_ns, double* deserialize_ns)
+{
+  FILE* f = fopen(path, "r");
+  if (!f)
+    return false;
+  char line[512];
+  char key[64];
+  snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+  bool found = false;
+  while (!found && fgets(line, sizeof(line), f))
+  {
+    const char* s = strstr(line, "\"serialize_ns\": ");
+    const char* d = strstr(line, "\"deserialize_ns\": ");
+    if (strstr(line, key) && s && d)
+    {
+      *serialize_ns = atof(s + 16);
+      *deserialize_ns = atof(d + 18);
+      found = true;
+    }
+  }
+  fclose(f);
+  return found;
+}
+
+static void writeJson(FILE* f, const Result* results, int count, const GenericResult* generic, int generic_count)
+{
+  fprintf(f, "{\n  \"compiler\": \"%s\",\n  \"results\": [\n", __VERSION__);
+  for (int i = 0; i < count; i++)
+  {
+    const Result& r = results[i];
+    fprintf(f, "    {\"name\": \"%s\", \"bytes\": %d, \"serialize_ns\": %.1f, \"deserialize_ns\": %.1f, "
+               "\"serialize_bytes_per_s\": %.0f, \"deserialize_bytes_per_s\": %.0f, "
+               "\"allocs_per_call\": %.3f, \"roundtrip\": %s}%s\n",
+            r.name, r.bytes, r.serialize_ns, r.deserialize_ns,
+            bytesPerSecond(r.bytes, r.serialize_ns), bytesPerSecond(r.bytes, r.deserialize_ns),
+            r.allocs_per_call, r.roundtrip ? "true" : "false", i + 1 < count ? "," : "");
+  }
+  fprintf(f, "  ],\n  \"generic\": [\n");
+  for (int i = 0; i < generic_count; i++)
+  {
+    const GenericResult& g = generic[i];
+    fprintf(f, "    {\"name\": \"%s\", \"values\": %d, \"decode_ns\": %.1f, \"selected_ns\": %.1f, \"compiled_ns\": %.1f}%s\n",
+            g.name, g.values, g.decode_ns, g.selected_ns, g.compiled_ns, i + 1 < generic_count ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+  static Result results[16];
+  int count = 0;
+
+  static float axes[8];
+  static int32_t buttons[20];
+  for (int i = 0; i < 8; i++)
+    axes[i] = i * 0.125f - 0.5f;
+  for (int i = 0; i < 20; i++)
+    buttons[i] = i & 1;
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = 8;
+  joy.buttons = buttons;
+  joy.buttons_length = 20;
+  results[count++] = bench("Joy", joy);
+
+  static float cells[2] = {3.91f, 3.88f};
+  sensor_msgs::BatteryState battery;
+  battery.header.frame_id = "remote";
+  battery.voltage = 7.79f;
+  battery.percentage = 0.82f;
+  battery.present = true;
+  battery.cell_voltage = cells;
+  battery.cell_voltage_length = 2;
+  battery.location = "remote";
+  battery.serial_number = "0001";
+  results[count++] = bench("BatteryState", battery);
+
+  geometry_msgs::Twist twist;
+  twist.linear.x = 0.4;
+  twist.angular.z = -1.2;
+  results[count++] = bench("Twist", twist);
+
+  nav_msgs::Odometry odom;
+  odom.header.frame_id = "odom";
+  odom.child_frame_id = "base_link";
+  odom.pose.pose.position.x = 1.5;
+  odom.pose.pose.orientation.w = 1;
+  odom.twist.twist.linear.x = 0.3;
+  for (int i = 0; i < 36; i += 7)
+  {
+    odom.pose.covariance[i] = 0.01;
+    odom.twist.covariance[i] = 0.02;
+  }
+  results[count++] = bench("Odometry", odom);
+
+  static float ranges[360];
+  static float intensities[360];
+  for (int i = 0; i < 360; i++)
+  {
+    ranges[i] = 0.5f + (i % 40) * 0.1f;
+    intensities[i] = (float) (i % 7);
+  }
+  sensor_msgs::LaserScan scan;
+  scan.header.frame_id = "laser";
+  scan.angle_min = -3.14159f;
+  scan.angle_max = 3.14159f;
+  scan.angle_increment = 0.01745f;
+  scan.range_max = 12;
+  scan.ranges = ranges;
+  scan.ranges_length = 360;
+  scan.intensities = intensities;
+  scan.intensities_length = 360;
+  results[count++] = bench("LaserScan", scan);
+
+  static uint8_t pixels[160 * 120 * 2];
+  for (size_t i = 0; i < sizeof(pixels); i++)
+    pixels[i] = (uint8_t) (i * 7);
+  sensor_msgs::Image image;
+  image.header.frame_id = "camera";
+  image.height = 120;
+  image.width = 160;
+  image.encoding = "rgb565";
+  image.step = 320;
+  image.data = pixels;
+  image.data_length = sizeof(pixels);
+  results[count++] = bench("Image", image);
+
+  static geometry_msgs::TransformStamped transforms[3];
+  const char* frames[3] = {"base_link", "laser", "camera"};
+  for (int i = 0; i < 3; i++)
+  {
+    transforms[i].header.frame_id = "odom";
+    transforms[i].child_frame_id = frames[i];
+    transforms[i].transform.translation.x = i * 0.1;
+    transforms[i].transform.rotation.w = 1;
+  }
+  tf2_msgs::TFMessage tf;
+  tf.transforms = transforms;
+  tf.transforms_length = 3;
+  results[count++] = bench("TFMessage", tf);
+
+  static diagnostic_msgs::KeyValue values[3];
+  values[0].key = "voltage";
+  values[0].value = "7.79";
+  values[1].key = "rssi";
+  values[1].value = "-61";
+  values[2].key = "uptime";
+  values[2].value = "3600";
+  static diagnostic_msgs::DiagnosticStatus status[2];
+  status[0].name = "remote: battery";
+  status[0].message = "OK";
+  status[0].hardware_id = "remote";
+  status[0].values = values;
+  status[0].values_length = 3;
+  status[1].level = diagnostic_msgs::DiagnosticStatus::WARN;
+  status[1].name = "remote: link";
+  status[1].message = "weak signal";
+  status[1].hardware_id = "remote";
+  status[1].values = values + 1;
+  status[1].values_length = 1;
+  diagnostic_msgs::DiagnosticArray diagnostics;
+  diagnostics.status = status;
+  diagnostics.status_length = 2;
+  results[count++] = bench("DiagnosticArray", diagnostics);
+
+  rosserial_msgs::Log log;
+  log.level = rosserial_msgs::Log::WARN;
+  log.msg = "Message from device dropped: message larger than buffer.";
+  results[count++] = bench("Log", log);
+
+  static GenericResult generic[4];
+  int generic_count = 0;
+  generic[generic_count++] = benchGeneric("Joy", "sensor_msgs/Joy", JOY_DEF, "header.stamp", joy);
+  generic[generic_count++] = benchGeneric("LaserScan", "sensor_msgs/LaserScan", LASERSCAN_DEF, "range_max", scan);
+  generic[generic_count++] = benchGeneric("Odometry", "nav_msgs/Odometry", ODOMETRY_DEF, "twist.twist.linear.x", odom);
+  generic[generic_count++] = benchGeneric("TFMessage", "tf2_msgs/TFMessage", TFMESSAGE_DEF, "transforms.child_frame_id", tf);
+
+  const char* baseline = argc > 2 ? argv[2] : nullptr;
+  bool ok = true;
+  printf("%-16s %7s %12s %12s %10s %10s %7s\n", "message", "bytes", "ser ns", "deser ns", "ser MB/s", "deser MB/s", "allocs");
+  for (int i = 0; i < count; i++)
+  {
+    const Result& r = results[i];
+    printf("%-16s %7d %12.1f %12.1f %10.1f %10.1f %7.3f%s\n", r.name, r.bytes, r.serialize_ns, r.deserialize_ns,
+           bytesPerSecond(r.bytes, r.serialize_ns) / 1e6, bytesPerSecond(r.bytes, r.deserialize_ns) / 1e6,
+           r.allocs_per_call, r.roundtrip ? "" : "  ROUNDTRIP MISMATCH");
+    double base_ser, base_deser;
+    if (baseline && findBaseline(baseline, r.name, &base_ser, &base_deser))
+      printf("%-16s %7s %+11.1f%% %+11.1f%%\n", "", "vs base",
+             (r.serialize_ns / base_ser - 1) * 100, (r.deserialize_ns / base_deser - 1) * 100);
+    ok = ok && r.roundtrip;
+  }
+
+  printf("\n%-16s %7s %12s %12s %12s %7s %7s\n", "generic", "values", "decode ns", "1 field ns", "compiled ns",
+         "ratio", "1 field");
+  for (int i = 0; i < generic_count; i++)
+  {
+    const GenericResult& g = generic[i];
+    bool within = g.decode_ns >= 0 && g.decode_ns <= GENERIC_MAX_RATIO * g.compiled_ns;
+    if (g.decode_ns < 0)
+      printf("%-16s  SCHEMA ERROR\n", g.name);
+    else
+      printf("%-16s %7d %12.1f %12.1f %12.1f %7.2f %7.2f%s\n", g.name, g.values, g.decode_ns, g.selected_ns,
+             g.compiled_ns, g.decode_ns / g.compiled_ns, g.selected_ns / g.compiled_ns, within ? "" : "  OVER BUDGET");
+    ok = ok && within;
+  }
+
+  if (argc > 1)
+  {
+    FILE* f = fopen(argv[1], "w");
+    if (!f)
+    {
+      perror(argv[1]);
+      return 2;
+    }
+    writeJson(f, results, count, generic, generic_count);
+    fclose(f);
+  }
+  return ok ? 0 : 1;
+}
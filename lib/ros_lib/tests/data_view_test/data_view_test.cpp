@@ -0,0 +1,85 @@
+/*
+ * Image, CompressedImage and PointCloud2 data view test
+ *
+ * Host program, not an Arduino sketch. Every type is deserialized in the
+ * default copy mode, switched to the zero copy view, deserialized again,
+ * and switched back. The copy has to be a heap buffer of its own, the
+ * view has to point into the receive buffer, and both have to hold the
+ * sent bytes. Switching frees the copy and never frees the view, which
+ * the address sanitizer checks:
+ *
+ * Build and run from the repository root (Linux):
+ *
+ *   g++ -std=gnu++11 -O1 -g -fsanitize=address -Ilib/ros_lib \
+ *       lib/ros_lib/tests/data_view_test/data_view_test.cpp -o data_view_test
+ *   ./data_view_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sensor_msgs/CompressedImage.h"
+#include "sensor_msgs/Image.h"
+#include "sensor_msgs/PointCloud2.h"
+
+static const int DATA_LENGTH = 100;
+
+static uint8_t buffer[512];
+
+template<class MsgT>
+static bool holdsData(const MsgT& msg)
+{
+  if (msg.data_length != DATA_LENGTH || msg.data == nullptr)
+    return false;
+  for (int i = 0; i < DATA_LENGTH; i++)
+  {
+    if (msg.data[i] != (uint8_t) (i * 7))
+      return false;
+  }
+  return true;
+}
+
+static bool inBuffer(const uint8_t* p)
+{
+  return p >= buffer && p < buffer + sizeof(buffer);
+}
+
+template<class MsgT>
+static bool run(const char* name)
+{
+  static uint8_t data[DATA_LENGTH];
+  for (int i = 0; i < DATA_LENGTH; i++)
+    data[i] = i * 7;
+  MsgT sent;
+  sent.data = data;
+  sent.data_length = DATA_LENGTH;
+  sent.serialize(buffer);
+
+  MsgT msg;
+  msg.deserialize(buffer);
+  bool copy_ok = holdsData(msg) && !inBuffer(msg.data);
+
+  msg.setDataView(true);   // frees the copy
+  bool cleared = msg.data == nullptr && msg.data_length == 0;
+  msg.deserialize(buffer);
+  bool view_ok = holdsData(msg) && inBuffer(msg.data);
+
+  msg.setDataView(false);  // must not free the view
+  msg.deserialize(buffer);
+  bool back_ok = holdsData(msg) && !inBuffer(msg.data);
+  msg.setDataView(false);  // frees the second copy
+
+  bool ok = copy_ok && cleared && view_ok && back_ok;
+  printf("%-16s copy %s, view %s, copy again %s\n", name, copy_ok ? "ok" : "FAILED",
+         cleared && view_ok ? "ok" : "FAILED", back_ok ? "ok" : "FAILED");
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+  ok &= run<sensor_msgs::Image>("Image");
+  ok &= run<sensor_msgs::CompressedImage>("CompressedImage");
+  ok &= run<sensor_msgs::PointCloud2>("PointCloud2");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+/*
+ * rosserial frame parser benchmark
+ *
+ * Host program, not an Arduino sketch. The same input stream is fed to
+ * NodeHandle_ through a hardware class with only the per-byte read() and
+ * through one that also has the bulk read(uint8_t*, size_t), and the
+ * throughput of spinOnce() is reported in bytes/us. Every frame has to
+ * reach the subscriber on both paths, otherwise the exit code is 1.
+ *
+ * Build and run from the repository root:
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/ros_lib lib/ros_lib/tests/parser_benchmark/parser_benchmark.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o parser_benchmark
+ *   ./parser_benchmark
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "ros/node_handle.h"
+#include "sensor_msgs/Joy.h"
+#include "std_msgs/Bool.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const double MIN_SECONDS = 0.2;   // run every stream at least this long
+static const int FRAMES = 20000;
+static const int CHUNK = 1460;           // most a bulk read returns, one TCP segment
+
+static uint8_t stream[8 << 20];
+static int stream_length = 0;
+static int stream_pos = 0;
+
+/*
+ * Input source with only the per-byte read(), like ArduinoHardware. Not
+ * inlined: on the firmware every byte is a call into WiFiClient.
+ */
+struct ByteHardware
+{
+  void init() {}
+  __attribute__((noinline)) int read()
+  {
+    return stream_pos < stream_length ? stream[stream_pos++] : -1;
+  }
+  void write(uint8_t*, int) {}
+  unsigned long time()
+  {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now().time_since_epoch()).count();
+  }
+};
+
+/* Same source with a bulk read, like Ros1WiFiLink */
+struct BulkHardware : ByteHardware
+{
+  using ByteHardware::read;
+  int read(uint8_t* data, size_t length)
+  {
+    int n = stream_length - stream_pos;
+    if (n > (int) length)
+      n = length;
+    if (n > CHUNK)
+      n = CHUNK;
+    memcpy(data, stream + stream_pos, n);
+    stream_pos += n;
+    return n;
+  }
+};
+
+/* Append one rosserial frame to the stream */
+static void appendFrame(int topic, const uint8_t* payload, int length)
+{
+  uint8_t* out = stream + stream_length;
+  out[0] = 0xff;
+  out[1] = ros::PROTOCOL_VER;
+  out[2] = length & 0xff;
+  out[3] = length >> 8;
+  out[4] = 255 - ((out[2] + out[3]) % 256);
+  out[5] = topic & 0xff;
+  out[6] = topic >> 8;
+  memcpy(out + 7, payload, length);
+  int checksum = out[5] + out[6];
+  for (int i = 0; i < length; i++)
+    checksum += payload[i];
+  out[7 + length] = 255 - (checksum % 256);
+  stream_length += length + 8;
+}
+
+template<class MsgT>
+static void buildStream(const MsgT& msg, int noise)
+{
+  static uint8_t payload[512];
+  int length = msg.serialize(payload);
+  stream_length = 0;
+  for (int i = 0; i < FRAMES; i++)
+  {
+    appendFrame(100, payload, length);
+    /* line noise between frames, without sync bytes */
+    for (int j = 0; j < noise; j++)
+      stream[stream_length++] = (uint8_t) (j * 13 + i) % 0xff;
+  }
+}
+
+static int received = 0;
+
+template<class MsgT>
+static void onMessage(const MsgT&)
+{
+  received++;
+}
+
+/* Parse the stream until the throughput is stable, returns bytes/us */
+template<class Hardware, class MsgT>
+static double parse(bool* complete)
+{
+  ros::NodeHandle_<Hardware, 1, 1, 512, 512> nh;
+  ros::Subscriber<MsgT> sub("bench", onMessage<MsgT>);
+  nh.initNode();
+  nh.subscribe(sub);
+  long passes = 1;
+  *complete = true;
+  for (;;)
+  {
+    Clock::time_point t0 = Clock::now();
+    for (long p = 0; p < passes; p++)
+    {
+      stream_pos = 0;
+      received = 0;
+      while (stream_pos < stream_length)
+        nh.spinOnce();
+      nh.spinOnce();
+      *complete = *complete && received == FRAMES;
+    }
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    if (us >= MIN_SECONDS * 1e6)
+      return (double) stream_length * passes / us;
+    passes *= 2;
+  }
+}
+
+template<class MsgT>
+static bool run(const char* name, const MsgT& msg, int noise)
+{
+  buildStream(msg, noise);
+  bool byte_ok, bulk_ok;
+  double byte_rate = parse<ByteHardware, MsgT>(&byte_ok);
+  double bulk_rate = parse<BulkHardware, MsgT>(&bulk_ok);
+  printf("%-12s %4d B/frame  byte path %7.1f bytes/us  bulk path %7.1f bytes/us  %4.2fx  %s\n",
+         name, stream_length / FRAMES, byte_rate, bulk_rate, bulk_rate / byte_rate,
+         byte_ok && bulk_ok ? "ok" : "FRAMES LOST");
+  return byte_ok && bulk_ok;
+}
+
+int main()
+{
+  static float axes[8];
+  static int32_t buttons[20];
+  for (int i = 0; i < 8; i++)
+    axes[i] = i * 0.125f - 0.5f;
+  for (int i = 0; i < 20; i++)
+    buttons[i] = i & 1;
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = 8;
+  joy.buttons = buttons;
+  joy.buttons_length = 20;
+
+  std_msgs::Bool led;
+  led.data = true;
+
+  bool ok = true;
+  ok &= run("Bool", led, 0);
+  ok &= run("Joy", joy, 0);
+  ok &= run("Joy + noise", joy, 64);
+  return ok ? 0 : 1;
+}
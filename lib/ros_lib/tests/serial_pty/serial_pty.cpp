@@ -0,0 +1,200 @@
+/*
+ * rosserial serial link test over a pseudo terminal pair
+ *
+ * Host program, not an Arduino sketch. A NodeHandle_ on ros::SerialLink
+ * opens the slave end of a pty. A stand-in for rosserial_python's
+ * serial_node on the master end sends some console noise and a single
+ * topic request, which the device has to find with probe() and answer
+ * without a retry. Then it answers time sync and measures the age of
+ * every Joy frame it receives.
+ *
+ * A pty has no baud rate, so the ages are software latency only. The
+ * time a frame needs on the wire at the given baud rate is printed next
+ * to it.
+ *
+ * Build and run from the repository root (Linux):
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/ros_lib lib/ros_lib/tests/serial_pty/serial_pty.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o serial_pty
+ *   ./serial_pty [frames] [baud]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "ros/node_handle.h"
+#include "ros/serial_link.h"
+#include "sensor_msgs/Joy.h"
+
+static const uint64_t PUBLISH_US = 2000;       // Joy period
+static const uint64_t TIMEOUT_US = 2000000;    // for the handshake
+
+static uint64_t now()
+{
+  return ros::micros64();
+}
+
+/* Stand-in for the rosserial host on the master end. */
+struct Host
+{
+  int fd;
+  int topics;
+  uint8_t input[4096];
+  int input_len;
+  std::vector<double> ages_ms;
+
+  void sendFrame(uint16_t topic, const uint8_t* payload, int length)
+  {
+    uint8_t frame[64];
+    frame[0] = 0xff;
+    frame[1] = ros::PROTOCOL_VER;
+    frame[2] = length & 0xff;
+    frame[3] = length >> 8;
+    frame[4] = 255 - ((frame[2] + frame[3]) % 256);
+    frame[5] = topic & 0xff;
+    frame[6] = topic >> 8;
+    if (length > 0)
+      memcpy(frame + 7, payload, length);
+    int chk = 0;
+    for (int i = 5; i < length + 7; i++)
+      chk += frame[i];
+    frame[length + 7] = 255 - (chk % 256);
+    if (write(fd, frame, length + 8) != length + 8)
+      perror("write");
+  }
+
+  void frame(uint16_t topic, const uint8_t* payload, int)
+  {
+    if (topic == ros::TopicInfo::ID_PUBLISHER)
+    {
+      topics++;
+    }
+    else if (topic == ros::TopicInfo::ID_TIME)
+    {
+      uint64_t t = now();
+      uint32_t stamp[2] = {(uint32_t)(t / 1000000), (uint32_t)(t % 1000000 * 1000)};
+      sendFrame(ros::TopicInfo::ID_TIME, (const uint8_t*) stamp, 8);
+    }
+    else if (topic >= 100)
+    {
+      sensor_msgs::Joy joy;
+      joy.deserialize((unsigned char*) payload);
+      uint64_t sent = joy.header.stamp.sec * 1000000ULL + joy.header.stamp.nsec / 1000;
+      ages_ms.push_back((now() - sent) / 1000.0);
+    }
+  }
+
+  void pump()
+  {
+    int n = read(fd, input + input_len, sizeof(input) - input_len);
+    if (n > 0)
+      input_len += n;
+    int pos = 0;
+    while (pos + 8 <= input_len)
+    {
+      if (input[pos] != 0xff || input[pos + 1] != ros::PROTOCOL_VER)
+      {
+        pos++;
+        continue;
+      }
+      int length = input[pos + 2] | (input[pos + 3] << 8);
+      if (pos + 8 + length > input_len)
+        break;
+      frame(input[pos + 5] | (input[pos + 6] << 8), input + pos + 7, length);
+      pos += 8 + length;
+    }
+    memmove(input, input + pos, input_len - pos);
+    input_len -= pos;
+  }
+};
+
+int main(int argc, char** argv)
+{
+  int frames = argc > 1 ? atoi(argv[1]) : 1000;
+  uint32_t baud = argc > 2 ? atoi(argv[2]) : 921600;
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0)
+  {
+    perror("pty");
+    return 2;
+  }
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL, 0) | O_NONBLOCK);
+  Host host = {master, 0, {0}, 0, {}};
+
+  ros::NodeHandle_<ros::SerialLink, 5, 5, 256, 256, 512, 512> nh;
+  if (!nh.getHardware()->begin(ptsname(master), baud))
+  {
+    perror(ptsname(master));
+    return 2;
+  }
+  nh.initNode();
+  nh.setTxBatching(true);
+  float axes[8] = {0};
+  int32_t buttons[20] = {0};
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = 8;
+  joy.buttons = buttons;
+  joy.buttons_length = 20;
+  ros::Publisher pub("joy", &joy);
+  pub.setLatestOnly(true);
+  nh.advertise(pub);
+
+  /* console output of the device before the host opened the port, then one topic request */
+  const char noise[] = "boot: rst:0x1 (POWERON_RESET)\r\n\xff\x01 WIFI: ssid\r\n";
+  if (write(master, noise, sizeof(noise) - 1) < 0)
+    perror("write");
+  host.sendFrame(ros::TopicInfo::ID_PUBLISHER, nullptr, 0);
+
+  uint64_t start = now();
+  bool probed = false;
+  while (!probed && now() - start < TIMEOUT_US)
+  {
+    probed = nh.getHardware()->probe();
+    usleep(100);
+  }
+  while (!nh.connected() && now() - start < TIMEOUT_US)
+  {
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+  double connect_ms = (now() - start) / 1000.0;
+  bool ok = probed && nh.connected() && host.topics == 1;
+  printf("probe %s, negotiated %s in %.1f ms, topics %d\n", probed ? "found host" : "FAILED",
+         nh.connected() ? "ok" : "FAILED", connect_ms, host.topics);
+
+  uint64_t next = now();
+  int sent = 0;
+  while (ok && (sent < frames || now() < next + 100000))
+  {
+    if (sent < frames && now() >= next)
+    {
+      uint64_t t = now();
+      joy.header.stamp.sec = t / 1000000;
+      joy.header.stamp.nsec = t % 1000000 * 1000;
+      axes[0] = sent;
+      pub.publish(&joy);
+      sent++;
+      next += PUBLISH_US;
+    }
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+
+  std::vector<double>& a = host.ages_ms;
+  std::sort(a.begin(), a.end());
+  int bytes = joy.serializedLength() + 8;
+  printf("Joy frames %d/%d, age p50 %.3f ms, p99 %.3f ms, max %.3f ms, wire %.3f ms at %u baud\n",
+         (int) a.size(), frames, a.empty() ? 0 : a[a.size() / 2], a.empty() ? 0 : a[a.size() * 99 / 100],
+         a.empty() ? 0 : a.back(), bytes * 10 * 1000.0 / baud, baud);
+  ok = ok && (int) a.size() == frames;
+  close(master);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+/*
+ * rosserial UDP link loopback test
+ *
+ * Host program, not an Arduino sketch. A NodeHandle_ on ros::UdpLink
+ * talks through a lossy relay to a stand-in for rosserial_server's
+ * udp_socket_node, all on 127.0.0.1. The stand-in requests the topics,
+ * answers time sync and measures the age of every Joy frame it receives.
+ *
+ * The relay drops datagrams at random in both directions. In "udp" mode a
+ * lost frame is just gone. In "tcp" mode it models a TCP stream over the
+ * same loss: a lost segment arrives after a retransmit timeout and every
+ * segment behind it waits, as the receiver delivers in order.
+ *
+ * Build and run from the repository root (Linux):
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/ros_lib lib/ros_lib/tests/udp_loopback/udp_loopback.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o udp_loopback
+ *   ./udp_loopback [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <algorithm>
+#include <vector>
+
+#include "ros/node_handle.h"
+#include "ros/udp_link.h"
+#include "sensor_msgs/Joy.h"
+
+static const uint16_t DEVICE_PORT = 21411;   // device's local port
+static const uint16_t RELAY_UP_PORT = 21412; // device -> relay -> host
+static const uint16_t RELAY_DOWN_PORT = 21413; // host -> relay -> device
+static const uint16_t HOST_PORT = 21414;
+
+static const uint64_t DELAY_US = 1000;       // one way delay of the relay
+static const uint64_t RTO_US = 200000;       // minimum TCP retransmit timeout (Linux, lwIP is higher)
+static const uint64_t PUBLISH_US = 5000;     // Joy period
+static const uint64_t TOPIC_REQUEST_US = 200000;
+
+static uint64_t now()
+{
+  return ros::micros64();
+}
+
+static int openSocket(uint16_t port)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  int on = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(fd, (struct sockaddr*) &addr, sizeof(addr)) < 0)
+  {
+    perror("bind");
+    exit(2);
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+static void sendTo(int fd, uint16_t port, const uint8_t* data, int length)
+{
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sendto(fd, data, length, 0, (struct sockaddr*) &addr, sizeof(addr));
+}
+
+/* One direction of the relay. */
+struct Path
+{
+  struct Datagram
+  {
+    uint64_t due;
+    std::vector<uint8_t> data;
+  };
+
+  int in;
+  uint16_t out_port;
+  double loss;
+  bool stream;
+  uint64_t last_due;
+  std::vector<Datagram> queue;
+
+  void pump(int out_fd)
+  {
+    uint8_t buffer[2048];
+    int n;
+    while ((n = recv(in, buffer, sizeof(buffer), 0)) > 0)
+    {
+      uint64_t due = now() + DELAY_US;
+      if (stream)
+      {
+        for (uint64_t rto = RTO_US; drand48() < loss; rto *= 2)
+          due += rto;
+        due = std::max(due, last_due);    // in order delivery
+        last_due = due;
+      }
+      else if (drand48() < loss)
+      {
+        continue;
+      }
+      Datagram d;
+      d.due = due;
+      d.data.assign(buffer, buffer + n);
+      queue.push_back(d);
+    }
+    uint64_t t = now();
+    size_t kept = 0;
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+      if (queue[i].due <= t)
+        sendTo(out_fd, out_port, queue[i].data.data(), queue[i].data.size());
+      else
+        queue[kept++] = queue[i];
+    }
+    queue.resize(kept);
+  }
+};
+
+/* Stand-in for the rosserial host. */
+struct Host
+{
+  int fd;
+  int topics;             // TopicInfo frames received
+  uint64_t negotiated;    // when the first one arrived
+  uint64_t last_request;
+  std::vector<double> ages_ms;
+
+  void sendFrame(uint16_t topic, const uint8_t* payload, int length)
+  {
+    uint8_t frame[64];
+    frame[0] = 0xff;
+    frame[1] = ros::PROTOCOL_VER;
+    frame[2] = length & 0xff;
+    frame[3] = length >> 8;
+    frame[4] = 255 - ((frame[2] + frame[3]) % 256);
+    frame[5] = topic & 0xff;
+    frame[6] = topic >> 8;
+    memcpy(frame + 7, payload, length);
+    int chk = 0;
+    for (int i = 5; i < length + 7; i++)
+      chk += frame[i];
+    frame[length + 7] = 255 - (chk % 256);
+    sendTo(fd, RELAY_DOWN_PORT, frame, length + 8);
+  }
+
+  void frame(uint16_t topic, const uint8_t* payload, int length)
+  {
+    if (topic == ros::TopicInfo::ID_PUBLISHER)
+    {
+      if (topics++ == 0)
+        negotiated = now();
+    }
+    else if (topic == ros::TopicInfo::ID_TIME)
+    {
+      uint64_t t = now();
+      uint32_t stamp[2] = {(uint32_t)(t / 1000000), (uint32_t)(t % 1000000 * 1000)};
+      sendFrame(ros::TopicInfo::ID_TIME, (const uint8_t*) stamp, 8);
+    }
+    else if (topic >= 100 && length >= 12)
+    {
+      sensor_msgs::Joy joy;
+      joy.deserialize((unsigned char*) payload);
+      uint64_t sent = joy.header.stamp.sec * 1000000ULL + joy.header.stamp.nsec / 1000;
+      ages_ms.push_back((now() - sent) / 1000.0);
+    }
+  }
+
+  void pump()
+  {
+    if (topics == 0 && now() - last_request > TOPIC_REQUEST_US)
+    {
+      sendFrame(ros::TopicInfo::ID_PUBLISHER, nullptr, 0);
+      last_request = now();
+    }
+    uint8_t buffer[2048];
+    int n;
+    while ((n = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+    {
+      int pos = 0;
+      while (pos + 8 <= n && buffer[pos] == 0xff)
+      {
+        int length = buffer[pos + 2] | (buffer[pos + 3] << 8);
+        if (pos + 8 + length > n)
+          break;
+        frame(buffer[pos + 5] | (buffer[pos + 6] << 8), buffer + pos + 7, length);
+        pos += 8 + length;
+      }
+    }
+  }
+};
+
+struct Result
+{
+  double delivered;
+  double p50, p99, max;
+  double connect_ms;
+};
+
+static Result run(double loss, bool stream, int frames)
+{
+  Host host = {openSocket(HOST_PORT), 0, 0, 0, {}};
+  Path up = {openSocket(RELAY_UP_PORT), HOST_PORT, loss, stream, 0, {}};
+  Path down = {openSocket(RELAY_DOWN_PORT), DEVICE_PORT, loss, stream, 0, {}};
+
+  ros::NodeHandle_<ros::UdpLink, 5, 5, 256, 256, 512, 512> nh;
+  nh.getHardware()->begin(htonl(INADDR_LOOPBACK), RELAY_UP_PORT, DEVICE_PORT);
+  nh.initNode();
+  nh.setTxBatching(true);
+  float axes[8] = {0};
+  int32_t buttons[20] = {0};
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = 8;
+  joy.buttons = buttons;
+  joy.buttons_length = 20;
+  ros::Publisher pub("joy", &joy);
+  pub.setLatestOnly(true);
+  nh.advertise(pub);
+
+  uint64_t start = now();
+  uint64_t next = start;
+  int sent = 0;
+  Result r = {0, 0, 0, 0, -1};
+  while (sent < frames || now() < next + 4 * RTO_US)
+  {
+    if (nh.connected() && r.connect_ms < 0)
+      r.connect_ms = (now() - start) / 1000.0;
+    if (nh.connected() && sent < frames && now() >= next)
+    {
+      uint64_t t = now();
+      joy.header.stamp.sec = t / 1000000;
+      joy.header.stamp.nsec = t % 1000000 * 1000;
+      axes[0] = sent;
+      pub.publish(&joy);
+      sent++;
+      next += PUBLISH_US;
+    }
+    else if (!nh.connected())
+    {
+      next = now();
+    }
+    nh.spinOnce();
+    up.pump(down.in);
+    down.pump(up.in);
+    host.pump();
+    usleep(50);
+  }
+
+  std::vector<double>& a = host.ages_ms;
+  std::sort(a.begin(), a.end());
+  r.delivered = 100.0 * a.size() / frames;
+  if (!a.empty())
+  {
+    r.p50 = a[a.size() / 2];
+    r.p99 = a[a.size() * 99 / 100];
+    r.max = a.back();
+  }
+  close(host.fd);
+  close(up.in);
+  close(down.in);
+  return r;
+}
+
+int main(int argc, char** argv)
+{
+  int frames = argc > 1 ? atoi(argv[1]) : 1000;
+  static const double losses[] = {0, 0.01, 0.05};
+  bool ok = true;
+  srand48(1);
+  printf("%-6s %-5s %10s %9s %9s %9s %11s\n", "loss", "link", "delivered", "p50 ms", "p99 ms", "max ms", "connect ms");
+  for (size_t i = 0; i < sizeof(losses) / sizeof(losses[0]); i++)
+  {
+    for (int stream = 0; stream < 2; stream++)
+    {
+      Result r = run(losses[i], stream, frames);
+      printf("%5.0f%% %-5s %9.1f%% %9.2f %9.2f %9.2f %11.1f\n", losses[i] * 100, stream ? "tcp" : "udp",
+             r.delivered, r.p50, r.p99, r.max, r.connect_ms);
+      if (losses[i] == 0)
+        ok = ok && r.delivered == 100 && r.connect_ms >= 0;
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -24,6 +24,17 @@ static const char FRAMEGRAPH[] = "tf/FrameGraph";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -38,7 +49,7 @@ static const char FRAMEGRAPH[] = "tf/FrameGraph";
   class FrameGraphResponse : public ros::Msg
   {
     public:
-      typedef const char* _dot_graph_type;
+      typedef ros::StringView _dot_graph_type;
       _dot_graph_type dot_graph;
 
     FrameGraphResponse():
@@ -49,25 +60,28 @@ static const char FRAMEGRAPH[] = "tf/FrameGraph";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_dot_graph = strlen(this->dot_graph);
+      uint32_t length_dot_graph = this->dot_graph.size();
       varToArr(outbuffer + offset, length_dot_graph);
       offset += 4;
-      memcpy(outbuffer + offset, this->dot_graph, length_dot_graph);
+      memcpy(outbuffer + offset, this->dot_graph.data(), length_dot_graph);
       offset += length_dot_graph;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->dot_graph.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_dot_graph;
       arrToVar(length_dot_graph, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_dot_graph; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_dot_graph-1]=0;
-      this->dot_graph = (char *)(inbuffer + offset-1);
+      this->dot_graph = ros::StringView((const char *)(inbuffer + offset), length_dot_graph, false);
       offset += length_dot_graph;
      return offset;
     }
@@ -24,6 +24,17 @@ static const char FRAMEGRAPH[] = "tf2_msgs/FrameGraph";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -38,7 +49,7 @@ static const char FRAMEGRAPH[] = "tf2_msgs/FrameGraph";
   class FrameGraphResponse : public ros::Msg
   {
     public:
-      typedef const char* _frame_yaml_type;
+      typedef ros::StringView _frame_yaml_type;
       _frame_yaml_type frame_yaml;
 
     FrameGraphResponse():
@@ -49,25 +60,28 @@ static const char FRAMEGRAPH[] = "tf2_msgs/FrameGraph";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_frame_yaml = strlen(this->frame_yaml);
+      uint32_t length_frame_yaml = this->frame_yaml.size();
       varToArr(outbuffer + offset, length_frame_yaml);
       offset += 4;
-      memcpy(outbuffer + offset, this->frame_yaml, length_frame_yaml);
+      memcpy(outbuffer + offset, this->frame_yaml.data(), length_frame_yaml);
       offset += length_frame_yaml;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->frame_yaml.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_frame_yaml;
       arrToVar(length_frame_yaml, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_frame_yaml; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_frame_yaml-1]=0;
-      this->frame_yaml = (char *)(inbuffer + offset-1);
+      this->frame_yaml = ros::StringView((const char *)(inbuffer + offset), length_frame_yaml, false);
       offset += length_frame_yaml;
      return offset;
     }
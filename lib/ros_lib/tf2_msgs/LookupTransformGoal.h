@@ -14,9 +14,9 @@ namespace tf2_msgs
   class LookupTransformGoal : public ros::Msg
   {
     public:
-      typedef const char* _target_frame_type;
+      typedef ros::StringView _target_frame_type;
       _target_frame_type target_frame;
-      typedef const char* _source_frame_type;
+      typedef ros::StringView _source_frame_type;
       _source_frame_type source_frame;
       typedef ros::Time _source_time_type;
       _source_time_type source_time;
@@ -24,7 +24,7 @@ namespace tf2_msgs
       _timeout_type timeout;
       typedef ros::Time _target_time_type;
       _target_time_type target_time;
-      typedef const char* _fixed_frame_type;
+      typedef ros::StringView _fixed_frame_type;
       _fixed_frame_type fixed_frame;
       typedef bool _advanced_type;
       _advanced_type advanced;
@@ -43,15 +43,15 @@ namespace tf2_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_target_frame = strlen(this->target_frame);
+      uint32_t length_target_frame = this->target_frame.size();
       varToArr(outbuffer + offset, length_target_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->target_frame, length_target_frame);
+      memcpy(outbuffer + offset, this->target_frame.data(), length_target_frame);
       offset += length_target_frame;
-      uint32_t length_source_frame = strlen(this->source_frame);
+      uint32_t length_source_frame = this->source_frame.size();
       varToArr(outbuffer + offset, length_source_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->source_frame, length_source_frame);
+      memcpy(outbuffer + offset, this->source_frame.data(), length_source_frame);
       offset += length_source_frame;
       *(outbuffer + offset + 0) = (this->source_time.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->source_time.sec >> (8 * 1)) & 0xFF;
@@ -83,10 +83,10 @@ namespace tf2_msgs
       *(outbuffer + offset + 2) = (this->target_time.nsec >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->target_time.nsec >> (8 * 3)) & 0xFF;
       offset += sizeof(this->target_time.nsec);
-      uint32_t length_fixed_frame = strlen(this->fixed_frame);
+      uint32_t length_fixed_frame = this->fixed_frame.size();
       varToArr(outbuffer + offset, length_fixed_frame);
       offset += 4;
-      memcpy(outbuffer + offset, this->fixed_frame, length_fixed_frame);
+      memcpy(outbuffer + offset, this->fixed_frame.data(), length_fixed_frame);
       offset += length_fixed_frame;
       union {
         bool real;
@@ -98,26 +98,34 @@ namespace tf2_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->target_frame.size();
+      offset += 4 + this->source_frame.size();
+      offset += sizeof(this->source_time.sec);
+      offset += sizeof(this->source_time.nsec);
+      offset += sizeof(this->timeout.sec);
+      offset += sizeof(this->timeout.nsec);
+      offset += sizeof(this->target_time.sec);
+      offset += sizeof(this->target_time.nsec);
+      offset += 4 + this->fixed_frame.size();
+      offset += sizeof(this->advanced);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_target_frame;
       arrToVar(length_target_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_target_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_target_frame-1]=0;
-      this->target_frame = (char *)(inbuffer + offset-1);
+      this->target_frame = ros::StringView((const char *)(inbuffer + offset), length_target_frame, false);
       offset += length_target_frame;
       uint32_t length_source_frame;
       arrToVar(length_source_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_source_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_source_frame-1]=0;
-      this->source_frame = (char *)(inbuffer + offset-1);
+      this->source_frame = ros::StringView((const char *)(inbuffer + offset), length_source_frame, false);
       offset += length_source_frame;
       this->source_time.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->source_time.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -152,11 +160,7 @@ namespace tf2_msgs
       uint32_t length_fixed_frame;
       arrToVar(length_fixed_frame, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_fixed_frame; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_fixed_frame-1]=0;
-      this->fixed_frame = (char *)(inbuffer + offset-1);
+      this->fixed_frame = ros::StringView((const char *)(inbuffer + offset), length_fixed_frame, false);
       offset += length_fixed_frame;
       union {
         bool real;
@@ -14,7 +14,7 @@ namespace tf2_msgs
     public:
       typedef uint8_t _error_type;
       _error_type error;
-      typedef const char* _error_string_type;
+      typedef ros::StringView _error_string_type;
       _error_string_type error_string;
       enum { NO_ERROR =  0 };
       enum { LOOKUP_ERROR =  1 };
@@ -35,14 +35,22 @@ namespace tf2_msgs
       int offset = 0;
       *(outbuffer + offset + 0) = (this->error >> (8 * 0)) & 0xFF;
       offset += sizeof(this->error);
-      uint32_t length_error_string = strlen(this->error_string);
+      uint32_t length_error_string = this->error_string.size();
       varToArr(outbuffer + offset, length_error_string);
       offset += 4;
-      memcpy(outbuffer + offset, this->error_string, length_error_string);
+      memcpy(outbuffer + offset, this->error_string.data(), length_error_string);
       offset += length_error_string;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->error);
+      offset += 4 + this->error_string.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -51,11 +59,7 @@ namespace tf2_msgs
       uint32_t length_error_string;
       arrToVar(length_error_string, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_error_string; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_error_string-1]=0;
-      this->error_string = (char *)(inbuffer + offset-1);
+      this->error_string = ros::StringView((const char *)(inbuffer + offset), length_error_string, false);
       offset += length_error_string;
      return offset;
     }
@@ -13,7 +13,7 @@ static const char DEMUXADD[] = "topic_tools/DemuxAdd";
   class DemuxAddRequest : public ros::Msg
   {
     public:
-      typedef const char* _topic_type;
+      typedef ros::StringView _topic_type;
       _topic_type topic;
 
     DemuxAddRequest():
@@ -24,25 +24,28 @@ static const char DEMUXADD[] = "topic_tools/DemuxAdd";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
+      uint32_t length_topic = this->topic.size();
       varToArr(outbuffer + offset, length_topic);
       offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
+      memcpy(outbuffer + offset, this->topic.data(), length_topic);
       offset += length_topic;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->topic.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_topic;
       arrToVar(length_topic, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
+      this->topic = ros::StringView((const char *)(inbuffer + offset), length_topic, false);
       offset += length_topic;
      return offset;
     }
@@ -66,6 +69,17 @@ static const char DEMUXADD[] = "topic_tools/DemuxAdd";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
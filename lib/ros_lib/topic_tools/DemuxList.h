@@ -24,6 +24,17 @@ static const char DEMUXLIST[] = "topic_tools/DemuxList";
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 0;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -39,7 +50,7 @@ static const char DEMUXLIST[] = "topic_tools/DemuxList";
   {
     public:
       uint32_t topics_length;
-      typedef char* _topics_type;
+      typedef ros::StringView _topics_type;
       _topics_type st_topics;
       _topics_type * topics;
 
@@ -57,15 +68,25 @@ static const char DEMUXLIST[] = "topic_tools/DemuxList";
       *(outbuffer + offset + 3) = (this->topics_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->topics_length);
       for( uint32_t i = 0; i < topics_length; i++){
-      uint32_t length_topicsi = strlen(this->topics[i]);
+      uint32_t length_topicsi = this->topics[i].size();
       varToArr(outbuffer + offset, length_topicsi);
       offset += 4;
-      memcpy(outbuffer + offset, this->topics[i], length_topicsi);
+      memcpy(outbuffer + offset, this->topics[i].data(), length_topicsi);
       offset += length_topicsi;
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->topics_length);
+      for( uint32_t i = 0; i < topics_length; i++){
+      offset += 4 + this->topics[i].size();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -75,19 +96,15 @@ static const char DEMUXLIST[] = "topic_tools/DemuxList";
       topics_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->topics_length);
       if(topics_lengthT > topics_length)
-        this->topics = (char**)realloc(this->topics, topics_lengthT * sizeof(char*));
+        this->topics = (ros::StringView*)realloc(this->topics, topics_lengthT * sizeof(ros::StringView));
       topics_length = topics_lengthT;
       for( uint32_t i = 0; i < topics_length; i++){
       uint32_t length_st_topics;
       arrToVar(length_st_topics, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_topics; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_topics-1]=0;
-      this->st_topics = (char *)(inbuffer + offset-1);
+      this->st_topics = ros::StringView((const char *)(inbuffer + offset), length_st_topics, false);
       offset += length_st_topics;
-        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(char*));
+        memcpy( &(this->topics[i]), &(this->st_topics), sizeof(ros::StringView));
       }
      return offset;
     }
@@ -13,7 +13,7 @@ static const char MUXSELECT[] = "topic_tools/MuxSelect";
   class MuxSelectRequest : public ros::Msg
   {
     public:
-      typedef const char* _topic_type;
+      typedef ros::StringView _topic_type;
       _topic_type topic;
 
     MuxSelectRequest():
@@ -24,25 +24,28 @@ static const char MUXSELECT[] = "topic_tools/MuxSelect";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_topic = strlen(this->topic);
+      uint32_t length_topic = this->topic.size();
       varToArr(outbuffer + offset, length_topic);
       offset += 4;
-      memcpy(outbuffer + offset, this->topic, length_topic);
+      memcpy(outbuffer + offset, this->topic.data(), length_topic);
       offset += length_topic;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->topic.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_topic;
       arrToVar(length_topic, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_topic-1]=0;
-      this->topic = (char *)(inbuffer + offset-1);
+      this->topic = ros::StringView((const char *)(inbuffer + offset), length_topic, false);
       offset += length_topic;
      return offset;
     }
@@ -55,7 +58,7 @@ static const char MUXSELECT[] = "topic_tools/MuxSelect";
   class MuxSelectResponse : public ros::Msg
   {
     public:
-      typedef const char* _prev_topic_type;
+      typedef ros::StringView _prev_topic_type;
       _prev_topic_type prev_topic;
 
     MuxSelectResponse():
@@ -66,25 +69,28 @@ static const char MUXSELECT[] = "topic_tools/MuxSelect";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_prev_topic = strlen(this->prev_topic);
+      uint32_t length_prev_topic = this->prev_topic.size();
       varToArr(outbuffer + offset, length_prev_topic);
       offset += 4;
-      memcpy(outbuffer + offset, this->prev_topic, length_prev_topic);
+      memcpy(outbuffer + offset, this->prev_topic.data(), length_prev_topic);
       offset += length_prev_topic;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->prev_topic.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_prev_topic;
       arrToVar(length_prev_topic, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_prev_topic; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_prev_topic-1]=0;
-      this->prev_topic = (char *)(inbuffer + offset-1);
+      this->prev_topic = ros::StringView((const char *)(inbuffer + offset), length_prev_topic, false);
       offset += length_prev_topic;
      return offset;
     }
@@ -14,19 +14,19 @@ namespace trajectory_msgs
   {
     public:
       uint32_t positions_length;
-      typedef float _positions_type;
+      typedef ros::float64_t _positions_type;
       _positions_type st_positions;
       _positions_type * positions;
       uint32_t velocities_length;
-      typedef float _velocities_type;
+      typedef ros::float64_t _velocities_type;
       _velocities_type st_velocities;
       _velocities_type * velocities;
       uint32_t accelerations_length;
-      typedef float _accelerations_type;
+      typedef ros::float64_t _accelerations_type;
       _accelerations_type st_accelerations;
       _accelerations_type * accelerations;
       uint32_t effort_length;
-      typedef float _effort_type;
+      typedef ros::float64_t _effort_type;
       _effort_type st_effort;
       _effort_type * effort;
       typedef ros::Duration _time_from_start_type;
@@ -50,7 +50,7 @@ namespace trajectory_msgs
       *(outbuffer + offset + 3) = (this->positions_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->positions_length);
       for( uint32_t i = 0; i < positions_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->positions[i]);
+      offset += serializeFloat64(outbuffer + offset, this->positions[i]);
       }
       *(outbuffer + offset + 0) = (this->velocities_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->velocities_length >> (8 * 1)) & 0xFF;
@@ -58,7 +58,7 @@ namespace trajectory_msgs
       *(outbuffer + offset + 3) = (this->velocities_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->velocities_length);
       for( uint32_t i = 0; i < velocities_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->velocities[i]);
+      offset += serializeFloat64(outbuffer + offset, this->velocities[i]);
       }
       *(outbuffer + offset + 0) = (this->accelerations_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->accelerations_length >> (8 * 1)) & 0xFF;
@@ -66,7 +66,7 @@ namespace trajectory_msgs
       *(outbuffer + offset + 3) = (this->accelerations_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->accelerations_length);
       for( uint32_t i = 0; i < accelerations_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->accelerations[i]);
+      offset += serializeFloat64(outbuffer + offset, this->accelerations[i]);
       }
       *(outbuffer + offset + 0) = (this->effort_length >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->effort_length >> (8 * 1)) & 0xFF;
@@ -74,7 +74,7 @@ namespace trajectory_msgs
       *(outbuffer + offset + 3) = (this->effort_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->effort_length);
       for( uint32_t i = 0; i < effort_length; i++){
-      offset += serializeAvrFloat64(outbuffer + offset, this->effort[i]);
+      offset += serializeFloat64(outbuffer + offset, this->effort[i]);
       }
       *(outbuffer + offset + 0) = (this->time_from_start.sec >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->time_from_start.sec >> (8 * 1)) & 0xFF;
@@ -89,6 +89,22 @@ namespace trajectory_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->positions_length);
+      offset += positions_length * 8;
+      offset += sizeof(this->velocities_length);
+      offset += velocities_length * 8;
+      offset += sizeof(this->accelerations_length);
+      offset += accelerations_length * 8;
+      offset += sizeof(this->effort_length);
+      offset += effort_length * 8;
+      offset += sizeof(this->time_from_start.sec);
+      offset += sizeof(this->time_from_start.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,11 +114,11 @@ namespace trajectory_msgs
       positions_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->positions_length);
       if(positions_lengthT > positions_length)
-        this->positions = (float*)realloc(this->positions, positions_lengthT * sizeof(float));
+        this->positions = (ros::float64_t*)realloc(this->positions, positions_lengthT * sizeof(ros::float64_t));
       positions_length = positions_lengthT;
       for( uint32_t i = 0; i < positions_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_positions));
-        memcpy( &(this->positions[i]), &(this->st_positions), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_positions));
+        memcpy( &(this->positions[i]), &(this->st_positions), sizeof(ros::float64_t));
       }
       uint32_t velocities_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -110,11 +126,11 @@ namespace trajectory_msgs
       velocities_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->velocities_length);
       if(velocities_lengthT > velocities_length)
-        this->velocities = (float*)realloc(this->velocities, velocities_lengthT * sizeof(float));
+        this->velocities = (ros::float64_t*)realloc(this->velocities, velocities_lengthT * sizeof(ros::float64_t));
       velocities_length = velocities_lengthT;
       for( uint32_t i = 0; i < velocities_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_velocities));
-        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_velocities));
+        memcpy( &(this->velocities[i]), &(this->st_velocities), sizeof(ros::float64_t));
       }
       uint32_t accelerations_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -122,11 +138,11 @@ namespace trajectory_msgs
       accelerations_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->accelerations_length);
       if(accelerations_lengthT > accelerations_length)
-        this->accelerations = (float*)realloc(this->accelerations, accelerations_lengthT * sizeof(float));
+        this->accelerations = (ros::float64_t*)realloc(this->accelerations, accelerations_lengthT * sizeof(ros::float64_t));
       accelerations_length = accelerations_lengthT;
       for( uint32_t i = 0; i < accelerations_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_accelerations));
-        memcpy( &(this->accelerations[i]), &(this->st_accelerations), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_accelerations));
+        memcpy( &(this->accelerations[i]), &(this->st_accelerations), sizeof(ros::float64_t));
       }
       uint32_t effort_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -134,11 +150,11 @@ namespace trajectory_msgs
       effort_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->effort_length);
       if(effort_lengthT > effort_length)
-        this->effort = (float*)realloc(this->effort, effort_lengthT * sizeof(float));
+        this->effort = (ros::float64_t*)realloc(this->effort, effort_lengthT * sizeof(ros::float64_t));
       effort_length = effort_lengthT;
       for( uint32_t i = 0; i < effort_length; i++){
-      offset += deserializeAvrFloat64(inbuffer + offset, &(this->st_effort));
-        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(float));
+      offset += deserializeFloat64(inbuffer + offset, &(this->st_effort));
+        memcpy( &(this->effort[i]), &(this->st_effort), sizeof(ros::float64_t));
       }
       this->time_from_start.sec =  ((uint32_t) (*(inbuffer + offset)));
       this->time_from_start.sec |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1);
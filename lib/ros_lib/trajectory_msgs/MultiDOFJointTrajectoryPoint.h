@@ -78,6 +78,20 @@ namespace trajectory_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->transforms_length);
+      offset += transforms_length * geometry_msgs::Transform::maxSerializedLength();
+      offset += sizeof(this->velocities_length);
+      offset += velocities_length * geometry_msgs::Twist::maxSerializedLength();
+      offset += sizeof(this->accelerations_length);
+      offset += accelerations_length * geometry_msgs::Twist::maxSerializedLength();
+      offset += sizeof(this->time_from_start.sec);
+      offset += sizeof(this->time_from_start.nsec);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
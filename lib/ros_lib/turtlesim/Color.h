@@ -38,6 +38,17 @@ namespace turtlesim
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      return maxSerializedLength();
+    }
+
+    /* layout is fixed, every instance serializes to this many bytes */
+    static constexpr int maxSerializedLength()
+    {
+      return 3;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
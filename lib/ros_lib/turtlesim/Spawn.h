@@ -19,7 +19,7 @@ static const char SPAWN[] = "turtlesim/Spawn";
       _y_type y;
       typedef float _theta_type;
       _theta_type theta;
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
 
     SpawnRequest():
@@ -63,14 +63,24 @@ static const char SPAWN[] = "turtlesim/Spawn";
       *(outbuffer + offset + 2) = (u_theta.base >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (u_theta.base >> (8 * 3)) & 0xFF;
       offset += sizeof(this->theta);
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->x);
+      offset += sizeof(this->y);
+      offset += sizeof(this->theta);
+      offset += 4 + this->name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -110,11 +120,7 @@ static const char SPAWN[] = "turtlesim/Spawn";
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
      return offset;
     }
@@ -127,7 +133,7 @@ static const char SPAWN[] = "turtlesim/Spawn";
   class SpawnResponse : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
 
     SpawnResponse():
@@ -138,25 +144,28 @@ static const char SPAWN[] = "turtlesim/Spawn";
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
      return offset;
     }
@@ -18,7 +18,7 @@ namespace visualization_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _ns_type;
+      typedef ros::StringView _ns_type;
       _ns_type ns;
       typedef int32_t _id_type;
       _id_type id;
@@ -75,10 +75,10 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_ns = strlen(this->ns);
+      uint32_t length_ns = this->ns.size();
       varToArr(outbuffer + offset, length_ns);
       offset += 4;
-      memcpy(outbuffer + offset, this->ns, length_ns);
+      memcpy(outbuffer + offset, this->ns.data(), length_ns);
       offset += length_ns;
       union {
         int32_t real;
@@ -154,6 +154,28 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->ns.size();
+      offset += sizeof(this->id);
+      offset += sizeof(this->type);
+      offset += sizeof(this->action);
+      offset += this->position.serializedLength();
+      offset += sizeof(this->scale);
+      offset += this->outline_color.serializedLength();
+      offset += sizeof(this->filled);
+      offset += this->fill_color.serializedLength();
+      offset += sizeof(this->lifetime.sec);
+      offset += sizeof(this->lifetime.nsec);
+      offset += sizeof(this->points_length);
+      offset += points_length * geometry_msgs::Point::maxSerializedLength();
+      offset += sizeof(this->outline_colors_length);
+      offset += outline_colors_length * std_msgs::ColorRGBA::maxSerializedLength();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -161,11 +183,7 @@ namespace visualization_msgs
       uint32_t length_ns;
       arrToVar(length_ns, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_ns; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_ns-1]=0;
-      this->ns = (char *)(inbuffer + offset-1);
+      this->ns = ros::StringView((const char *)(inbuffer + offset), length_ns, false);
       offset += length_ns;
       union {
         int32_t real;
@@ -20,9 +20,9 @@ namespace visualization_msgs
       _header_type header;
       typedef geometry_msgs::Pose _pose_type;
       _pose_type pose;
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
-      typedef const char* _description_type;
+      typedef ros::StringView _description_type;
       _description_type description;
       typedef float _scale_type;
       _scale_type scale;
@@ -34,6 +34,7 @@ namespace visualization_msgs
       typedef visualization_msgs::InteractiveMarkerControl _controls_type;
       _controls_type st_controls;
       _controls_type * controls;
+      uint32_t controls_capacity;
 
     InteractiveMarker():
       header(),
@@ -42,7 +43,7 @@ namespace visualization_msgs
       description(""),
       scale(0),
       menu_entries_length(0), st_menu_entries(), menu_entries(nullptr),
-      controls_length(0), st_controls(), controls(nullptr)
+      controls_length(0), st_controls(), controls(nullptr), controls_capacity(0)
     {
     }
 
@@ -51,15 +52,15 @@ namespace visualization_msgs
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
       offset += this->pose.serialize(outbuffer + offset);
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
-      uint32_t length_description = strlen(this->description);
+      uint32_t length_description = this->description.size();
       varToArr(outbuffer + offset, length_description);
       offset += 4;
-      memcpy(outbuffer + offset, this->description, length_description);
+      memcpy(outbuffer + offset, this->description.data(), length_description);
       offset += length_description;
       union {
         float real;
@@ -90,6 +91,25 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += this->pose.serializedLength();
+      offset += 4 + this->name.size();
+      offset += 4 + this->description.size();
+      offset += sizeof(this->scale);
+      offset += sizeof(this->menu_entries_length);
+      for( uint32_t i = 0; i < menu_entries_length; i++){
+      offset += this->menu_entries[i].serializedLength();
+      }
+      offset += sizeof(this->controls_length);
+      for( uint32_t i = 0; i < controls_length; i++){
+      offset += this->controls[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,20 +118,12 @@ namespace visualization_msgs
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       uint32_t length_description;
       arrToVar(length_description, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_description; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_description-1]=0;
-      this->description = (char *)(inbuffer + offset-1);
+      this->description = ros::StringView((const char *)(inbuffer + offset), length_description, false);
       offset += length_description;
       union {
         float real;
@@ -141,12 +153,10 @@ namespace visualization_msgs
       controls_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       controls_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->controls_length);
-      if(controls_lengthT > controls_length)
-        this->controls = (visualization_msgs::InteractiveMarkerControl*)realloc(this->controls, controls_lengthT * sizeof(visualization_msgs::InteractiveMarkerControl));
+      this->controls = ros::reserveMsgs(this->controls, this->controls_capacity, controls_lengthT);
       controls_length = controls_lengthT;
       for( uint32_t i = 0; i < controls_length; i++){
-      offset += this->st_controls.deserialize(inbuffer + offset);
-        memcpy( &(this->controls[i]), &(this->st_controls), sizeof(visualization_msgs::InteractiveMarkerControl));
+      offset += this->controls[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -14,7 +14,7 @@ namespace visualization_msgs
   class InteractiveMarkerControl : public ros::Msg
   {
     public:
-      typedef const char* _name_type;
+      typedef ros::StringView _name_type;
       _name_type name;
       typedef geometry_msgs::Quaternion _orientation_type;
       _orientation_type orientation;
@@ -28,9 +28,10 @@ namespace visualization_msgs
       typedef visualization_msgs::Marker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
+      uint32_t markers_capacity;
       typedef bool _independent_marker_orientation_type;
       _independent_marker_orientation_type independent_marker_orientation;
-      typedef const char* _description_type;
+      typedef ros::StringView _description_type;
       _description_type description;
       enum { INHERIT =  0 };
       enum { FIXED =  1 };
@@ -52,7 +53,7 @@ namespace visualization_msgs
       orientation_mode(0),
       interaction_mode(0),
       always_visible(0),
-      markers_length(0), st_markers(), markers(nullptr),
+      markers_length(0), st_markers(), markers(nullptr), markers_capacity(0),
       independent_marker_orientation(0),
       description("")
     {
@@ -61,10 +62,10 @@ namespace visualization_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_name = strlen(this->name);
+      uint32_t length_name = this->name.size();
       varToArr(outbuffer + offset, length_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->name, length_name);
+      memcpy(outbuffer + offset, this->name.data(), length_name);
       offset += length_name;
       offset += this->orientation.serialize(outbuffer + offset);
       *(outbuffer + offset + 0) = (this->orientation_mode >> (8 * 0)) & 0xFF;
@@ -93,25 +94,38 @@ namespace visualization_msgs
       u_independent_marker_orientation.real = this->independent_marker_orientation;
       *(outbuffer + offset + 0) = (u_independent_marker_orientation.base >> (8 * 0)) & 0xFF;
       offset += sizeof(this->independent_marker_orientation);
-      uint32_t length_description = strlen(this->description);
+      uint32_t length_description = this->description.size();
       varToArr(outbuffer + offset, length_description);
       offset += 4;
-      memcpy(outbuffer + offset, this->description, length_description);
+      memcpy(outbuffer + offset, this->description.data(), length_description);
       offset += length_description;
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->name.size();
+      offset += this->orientation.serializedLength();
+      offset += sizeof(this->orientation_mode);
+      offset += sizeof(this->interaction_mode);
+      offset += sizeof(this->always_visible);
+      offset += sizeof(this->markers_length);
+      for( uint32_t i = 0; i < markers_length; i++){
+      offset += this->markers[i].serializedLength();
+      }
+      offset += sizeof(this->independent_marker_orientation);
+      offset += 4 + this->description.size();
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_name;
       arrToVar(length_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_name-1]=0;
-      this->name = (char *)(inbuffer + offset-1);
+      this->name = ros::StringView((const char *)(inbuffer + offset), length_name, false);
       offset += length_name;
       offset += this->orientation.deserialize(inbuffer + offset);
       this->orientation_mode =  ((uint8_t) (*(inbuffer + offset)));
@@ -131,12 +145,10 @@ namespace visualization_msgs
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::Marker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::Marker));
+      this->markers = ros::reserveMsgs(this->markers, this->markers_capacity, markers_lengthT);
       markers_length = markers_lengthT;
       for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::Marker));
+      offset += this->markers[i].deserialize(inbuffer + offset);
       }
       union {
         bool real;
@@ -149,11 +161,7 @@ namespace visualization_msgs
       uint32_t length_description;
       arrToVar(length_description, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_description; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_description-1]=0;
-      this->description = (char *)(inbuffer + offset-1);
+      this->description = ros::StringView((const char *)(inbuffer + offset), length_description, false);
       offset += length_description;
      return offset;
     }
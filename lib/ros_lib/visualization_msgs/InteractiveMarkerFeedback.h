@@ -17,11 +17,11 @@ namespace visualization_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _client_id_type;
+      typedef ros::StringView _client_id_type;
       _client_id_type client_id;
-      typedef const char* _marker_name_type;
+      typedef ros::StringView _marker_name_type;
       _marker_name_type marker_name;
-      typedef const char* _control_name_type;
+      typedef ros::StringView _control_name_type;
       _control_name_type control_name;
       typedef uint8_t _event_type_type;
       _event_type_type event_type;
@@ -57,20 +57,20 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_client_id = strlen(this->client_id);
+      uint32_t length_client_id = this->client_id.size();
       varToArr(outbuffer + offset, length_client_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->client_id, length_client_id);
+      memcpy(outbuffer + offset, this->client_id.data(), length_client_id);
       offset += length_client_id;
-      uint32_t length_marker_name = strlen(this->marker_name);
+      uint32_t length_marker_name = this->marker_name.size();
       varToArr(outbuffer + offset, length_marker_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->marker_name, length_marker_name);
+      memcpy(outbuffer + offset, this->marker_name.data(), length_marker_name);
       offset += length_marker_name;
-      uint32_t length_control_name = strlen(this->control_name);
+      uint32_t length_control_name = this->control_name.size();
       varToArr(outbuffer + offset, length_control_name);
       offset += 4;
-      memcpy(outbuffer + offset, this->control_name, length_control_name);
+      memcpy(outbuffer + offset, this->control_name.data(), length_control_name);
       offset += length_control_name;
       *(outbuffer + offset + 0) = (this->event_type >> (8 * 0)) & 0xFF;
       offset += sizeof(this->event_type);
@@ -91,6 +91,21 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->client_id.size();
+      offset += 4 + this->marker_name.size();
+      offset += 4 + this->control_name.size();
+      offset += sizeof(this->event_type);
+      offset += this->pose.serializedLength();
+      offset += sizeof(this->menu_entry_id);
+      offset += this->mouse_point.serializedLength();
+      offset += sizeof(this->mouse_point_valid);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -98,29 +113,17 @@ namespace visualization_msgs
       uint32_t length_client_id;
       arrToVar(length_client_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_client_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_client_id-1]=0;
-      this->client_id = (char *)(inbuffer + offset-1);
+      this->client_id = ros::StringView((const char *)(inbuffer + offset), length_client_id, false);
       offset += length_client_id;
       uint32_t length_marker_name;
       arrToVar(length_marker_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_marker_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_marker_name-1]=0;
-      this->marker_name = (char *)(inbuffer + offset-1);
+      this->marker_name = ros::StringView((const char *)(inbuffer + offset), length_marker_name, false);
       offset += length_marker_name;
       uint32_t length_control_name;
       arrToVar(length_control_name, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_control_name; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_control_name-1]=0;
-      this->control_name = (char *)(inbuffer + offset-1);
+      this->control_name = ros::StringView((const char *)(inbuffer + offset), length_control_name, false);
       offset += length_control_name;
       this->event_type =  ((uint8_t) (*(inbuffer + offset)));
       offset += sizeof(this->event_type);
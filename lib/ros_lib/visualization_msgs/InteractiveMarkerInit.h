@@ -13,7 +13,7 @@ namespace visualization_msgs
   class InteractiveMarkerInit : public ros::Msg
   {
     public:
-      typedef const char* _server_id_type;
+      typedef ros::StringView _server_id_type;
       _server_id_type server_id;
       typedef uint64_t _seq_num_type;
       _seq_num_type seq_num;
@@ -21,21 +21,22 @@ namespace visualization_msgs
       typedef visualization_msgs::InteractiveMarker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
+      uint32_t markers_capacity;
 
     InteractiveMarkerInit():
       server_id(""),
       seq_num(0),
-      markers_length(0), st_markers(), markers(nullptr)
+      markers_length(0), st_markers(), markers(nullptr), markers_capacity(0)
     {
     }
 
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_server_id = strlen(this->server_id);
+      uint32_t length_server_id = this->server_id.size();
       varToArr(outbuffer + offset, length_server_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->server_id, length_server_id);
+      memcpy(outbuffer + offset, this->server_id.data(), length_server_id);
       offset += length_server_id;
       *(outbuffer + offset + 0) = (this->seq_num >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->seq_num >> (8 * 1)) & 0xFF;
@@ -57,17 +58,25 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->server_id.size();
+      offset += sizeof(this->seq_num);
+      offset += sizeof(this->markers_length);
+      for( uint32_t i = 0; i < markers_length; i++){
+      offset += this->markers[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_server_id;
       arrToVar(length_server_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_server_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_server_id-1]=0;
-      this->server_id = (char *)(inbuffer + offset-1);
+      this->server_id = ros::StringView((const char *)(inbuffer + offset), length_server_id, false);
       offset += length_server_id;
       this->seq_num =  ((uint64_t) (*(inbuffer + offset)));
       this->seq_num |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -83,12 +92,10 @@ namespace visualization_msgs
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::InteractiveMarker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::InteractiveMarker));
+      this->markers = ros::reserveMsgs(this->markers, this->markers_capacity, markers_lengthT);
       markers_length = markers_lengthT;
       for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::InteractiveMarker));
+      offset += this->markers[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -14,7 +14,7 @@ namespace visualization_msgs
   class InteractiveMarkerUpdate : public ros::Msg
   {
     public:
-      typedef const char* _server_id_type;
+      typedef ros::StringView _server_id_type;
       _server_id_type server_id;
       typedef uint64_t _seq_num_type;
       _seq_num_type seq_num;
@@ -24,12 +24,13 @@ namespace visualization_msgs
       typedef visualization_msgs::InteractiveMarker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
+      uint32_t markers_capacity;
       uint32_t poses_length;
       typedef visualization_msgs::InteractiveMarkerPose _poses_type;
       _poses_type st_poses;
       _poses_type * poses;
       uint32_t erases_length;
-      typedef char* _erases_type;
+      typedef ros::StringView _erases_type;
       _erases_type st_erases;
       _erases_type * erases;
       enum { KEEP_ALIVE =  0 };
@@ -39,7 +40,7 @@ namespace visualization_msgs
       server_id(""),
       seq_num(0),
       type(0),
-      markers_length(0), st_markers(), markers(nullptr),
+      markers_length(0), st_markers(), markers(nullptr), markers_capacity(0),
       poses_length(0), st_poses(), poses(nullptr),
       erases_length(0), st_erases(), erases(nullptr)
     {
@@ -48,10 +49,10 @@ namespace visualization_msgs
     virtual int serialize(unsigned char *outbuffer) const override
     {
       int offset = 0;
-      uint32_t length_server_id = strlen(this->server_id);
+      uint32_t length_server_id = this->server_id.size();
       varToArr(outbuffer + offset, length_server_id);
       offset += 4;
-      memcpy(outbuffer + offset, this->server_id, length_server_id);
+      memcpy(outbuffer + offset, this->server_id.data(), length_server_id);
       offset += length_server_id;
       *(outbuffer + offset + 0) = (this->seq_num >> (8 * 0)) & 0xFF;
       *(outbuffer + offset + 1) = (this->seq_num >> (8 * 1)) & 0xFF;
@@ -86,26 +87,43 @@ namespace visualization_msgs
       *(outbuffer + offset + 3) = (this->erases_length >> (8 * 3)) & 0xFF;
       offset += sizeof(this->erases_length);
       for( uint32_t i = 0; i < erases_length; i++){
-      uint32_t length_erasesi = strlen(this->erases[i]);
+      uint32_t length_erasesi = this->erases[i].size();
       varToArr(outbuffer + offset, length_erasesi);
       offset += 4;
-      memcpy(outbuffer + offset, this->erases[i], length_erasesi);
+      memcpy(outbuffer + offset, this->erases[i].data(), length_erasesi);
       offset += length_erasesi;
       }
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += 4 + this->server_id.size();
+      offset += sizeof(this->seq_num);
+      offset += sizeof(this->type);
+      offset += sizeof(this->markers_length);
+      for( uint32_t i = 0; i < markers_length; i++){
+      offset += this->markers[i].serializedLength();
+      }
+      offset += sizeof(this->poses_length);
+      for( uint32_t i = 0; i < poses_length; i++){
+      offset += this->poses[i].serializedLength();
+      }
+      offset += sizeof(this->erases_length);
+      for( uint32_t i = 0; i < erases_length; i++){
+      offset += 4 + this->erases[i].size();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
       uint32_t length_server_id;
       arrToVar(length_server_id, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_server_id; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_server_id-1]=0;
-      this->server_id = (char *)(inbuffer + offset-1);
+      this->server_id = ros::StringView((const char *)(inbuffer + offset), length_server_id, false);
       offset += length_server_id;
       this->seq_num =  ((uint64_t) (*(inbuffer + offset)));
       this->seq_num |= ((uint64_t) (*(inbuffer + offset + 1))) << (8 * 1);
@@ -123,12 +141,10 @@ namespace visualization_msgs
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::InteractiveMarker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::InteractiveMarker));
+      this->markers = ros::reserveMsgs(this->markers, this->markers_capacity, markers_lengthT);
       markers_length = markers_lengthT;
       for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::InteractiveMarker));
+      offset += this->markers[i].deserialize(inbuffer + offset);
       }
       uint32_t poses_lengthT = ((uint32_t) (*(inbuffer + offset))); 
       poses_lengthT |= ((uint32_t) (*(inbuffer + offset + 1))) << (8 * 1); 
@@ -148,19 +164,15 @@ namespace visualization_msgs
       erases_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->erases_length);
       if(erases_lengthT > erases_length)
-        this->erases = (char**)realloc(this->erases, erases_lengthT * sizeof(char*));
+        this->erases = (ros::StringView*)realloc(this->erases, erases_lengthT * sizeof(ros::StringView));
       erases_length = erases_lengthT;
       for( uint32_t i = 0; i < erases_length; i++){
       uint32_t length_st_erases;
       arrToVar(length_st_erases, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_st_erases; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_st_erases-1]=0;
-      this->st_erases = (char *)(inbuffer + offset-1);
+      this->st_erases = ros::StringView((const char *)(inbuffer + offset), length_st_erases, false);
       offset += length_st_erases;
-        memcpy( &(this->erases[i]), &(this->st_erases), sizeof(char*));
+        memcpy( &(this->erases[i]), &(this->st_erases), sizeof(ros::StringView));
       }
      return offset;
     }
@@ -20,7 +20,7 @@ namespace visualization_msgs
     public:
       typedef std_msgs::Header _header_type;
       _header_type header;
-      typedef const char* _ns_type;
+      typedef ros::StringView _ns_type;
       _ns_type ns;
       typedef int32_t _id_type;
       _id_type id;
@@ -46,9 +46,9 @@ namespace visualization_msgs
       typedef std_msgs::ColorRGBA _colors_type;
       _colors_type st_colors;
       _colors_type * colors;
-      typedef const char* _text_type;
+      typedef ros::StringView _text_type;
       _text_type text;
-      typedef const char* _mesh_resource_type;
+      typedef ros::StringView _mesh_resource_type;
       _mesh_resource_type mesh_resource;
       typedef bool _mesh_use_embedded_materials_type;
       _mesh_use_embedded_materials_type mesh_use_embedded_materials;
@@ -92,10 +92,10 @@ namespace visualization_msgs
     {
       int offset = 0;
       offset += this->header.serialize(outbuffer + offset);
-      uint32_t length_ns = strlen(this->ns);
+      uint32_t length_ns = this->ns.size();
       varToArr(outbuffer + offset, length_ns);
       offset += 4;
-      memcpy(outbuffer + offset, this->ns, length_ns);
+      memcpy(outbuffer + offset, this->ns.data(), length_ns);
       offset += length_ns;
       union {
         int32_t real;
@@ -163,15 +163,15 @@ namespace visualization_msgs
       for( uint32_t i = 0; i < colors_length; i++){
       offset += this->colors[i].serialize(outbuffer + offset);
       }
-      uint32_t length_text = strlen(this->text);
+      uint32_t length_text = this->text.size();
       varToArr(outbuffer + offset, length_text);
       offset += 4;
-      memcpy(outbuffer + offset, this->text, length_text);
+      memcpy(outbuffer + offset, this->text.data(), length_text);
       offset += length_text;
-      uint32_t length_mesh_resource = strlen(this->mesh_resource);
+      uint32_t length_mesh_resource = this->mesh_resource.size();
       varToArr(outbuffer + offset, length_mesh_resource);
       offset += 4;
-      memcpy(outbuffer + offset, this->mesh_resource, length_mesh_resource);
+      memcpy(outbuffer + offset, this->mesh_resource.data(), length_mesh_resource);
       offset += length_mesh_resource;
       union {
         bool real;
@@ -183,6 +183,30 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += this->header.serializedLength();
+      offset += 4 + this->ns.size();
+      offset += sizeof(this->id);
+      offset += sizeof(this->type);
+      offset += sizeof(this->action);
+      offset += this->pose.serializedLength();
+      offset += this->scale.serializedLength();
+      offset += this->color.serializedLength();
+      offset += sizeof(this->lifetime.sec);
+      offset += sizeof(this->lifetime.nsec);
+      offset += sizeof(this->frame_locked);
+      offset += sizeof(this->points_length);
+      offset += points_length * geometry_msgs::Point::maxSerializedLength();
+      offset += sizeof(this->colors_length);
+      offset += colors_length * std_msgs::ColorRGBA::maxSerializedLength();
+      offset += 4 + this->text.size();
+      offset += 4 + this->mesh_resource.size();
+      offset += sizeof(this->mesh_use_embedded_materials);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -190,11 +214,7 @@ namespace visualization_msgs
       uint32_t length_ns;
       arrToVar(length_ns, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_ns; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_ns-1]=0;
-      this->ns = (char *)(inbuffer + offset-1);
+      this->ns = ros::StringView((const char *)(inbuffer + offset), length_ns, false);
       offset += length_ns;
       union {
         int32_t real;
@@ -277,20 +297,12 @@ namespace visualization_msgs
       uint32_t length_text;
       arrToVar(length_text, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_text; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_text-1]=0;
-      this->text = (char *)(inbuffer + offset-1);
+      this->text = ros::StringView((const char *)(inbuffer + offset), length_text, false);
       offset += length_text;
       uint32_t length_mesh_resource;
       arrToVar(length_mesh_resource, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_mesh_resource; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_mesh_resource-1]=0;
-      this->mesh_resource = (char *)(inbuffer + offset-1);
+      this->mesh_resource = ros::StringView((const char *)(inbuffer + offset), length_mesh_resource, false);
       offset += length_mesh_resource;
       union {
         bool real;
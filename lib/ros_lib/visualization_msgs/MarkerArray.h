@@ -17,9 +17,10 @@ namespace visualization_msgs
       typedef visualization_msgs::Marker _markers_type;
       _markers_type st_markers;
       _markers_type * markers;
+      uint32_t markers_capacity;
 
     MarkerArray():
-      markers_length(0), st_markers(), markers(nullptr)
+      markers_length(0), st_markers(), markers(nullptr), markers_capacity(0)
     {
     }
 
@@ -37,6 +38,16 @@ namespace visualization_msgs
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->markers_length);
+      for( uint32_t i = 0; i < markers_length; i++){
+      offset += this->markers[i].serializedLength();
+      }
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -45,12 +56,10 @@ namespace visualization_msgs
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 2))) << (8 * 2); 
       markers_lengthT |= ((uint32_t) (*(inbuffer + offset + 3))) << (8 * 3); 
       offset += sizeof(this->markers_length);
-      if(markers_lengthT > markers_length)
-        this->markers = (visualization_msgs::Marker*)realloc(this->markers, markers_lengthT * sizeof(visualization_msgs::Marker));
+      this->markers = ros::reserveMsgs(this->markers, this->markers_capacity, markers_lengthT);
       markers_length = markers_lengthT;
       for( uint32_t i = 0; i < markers_length; i++){
-      offset += this->st_markers.deserialize(inbuffer + offset);
-        memcpy( &(this->markers[i]), &(this->st_markers), sizeof(visualization_msgs::Marker));
+      offset += this->markers[i].deserialize(inbuffer + offset);
       }
      return offset;
     }
@@ -16,9 +16,9 @@ namespace visualization_msgs
       _id_type id;
       typedef uint32_t _parent_id_type;
       _parent_id_type parent_id;
-      typedef const char* _title_type;
+      typedef ros::StringView _title_type;
       _title_type title;
-      typedef const char* _command_type;
+      typedef ros::StringView _command_type;
       _command_type command;
       typedef uint8_t _command_type_type;
       _command_type_type command_type;
@@ -48,21 +48,32 @@ namespace visualization_msgs
       *(outbuffer + offset + 2) = (this->parent_id >> (8 * 2)) & 0xFF;
       *(outbuffer + offset + 3) = (this->parent_id >> (8 * 3)) & 0xFF;
       offset += sizeof(this->parent_id);
-      uint32_t length_title = strlen(this->title);
+      uint32_t length_title = this->title.size();
       varToArr(outbuffer + offset, length_title);
       offset += 4;
-      memcpy(outbuffer + offset, this->title, length_title);
+      memcpy(outbuffer + offset, this->title.data(), length_title);
       offset += length_title;
-      uint32_t length_command = strlen(this->command);
+      uint32_t length_command = this->command.size();
       varToArr(outbuffer + offset, length_command);
       offset += 4;
-      memcpy(outbuffer + offset, this->command, length_command);
+      memcpy(outbuffer + offset, this->command.data(), length_command);
       offset += length_command;
       *(outbuffer + offset + 0) = (this->command_type >> (8 * 0)) & 0xFF;
       offset += sizeof(this->command_type);
       return offset;
     }
 
+    virtual int serializedLength() const override
+    {
+      int offset = 0;
+      offset += sizeof(this->id);
+      offset += sizeof(this->parent_id);
+      offset += 4 + this->title.size();
+      offset += 4 + this->command.size();
+      offset += sizeof(this->command_type);
+      return offset;
+    }
+
     virtual int deserialize(unsigned char *inbuffer) override
     {
       int offset = 0;
@@ -79,20 +90,12 @@ namespace visualization_msgs
       uint32_t length_title;
       arrToVar(length_title, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_title; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_title-1]=0;
-      this->title = (char *)(inbuffer + offset-1);
+      this->title = ros::StringView((const char *)(inbuffer + offset), length_title, false);
       offset += length_title;
       uint32_t length_command;
       arrToVar(length_command, (inbuffer + offset));
       offset += 4;
-      for(unsigned int k= offset; k< offset+length_command; ++k){
-          inbuffer[k-1]=inbuffer[k];
-      }
-      inbuffer[offset+length_command-1]=0;
-      this->command = (char *)(inbuffer + offset-1);
+      this->command = ros::StringView((const char *)(inbuffer + offset), length_command, false);
       offset += length_command;
       this->command_type =  ((uint8_t) (*(inbuffer + offset)));
       offset += sizeof(this->command_type);
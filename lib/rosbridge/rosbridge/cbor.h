@@ -0,0 +1,162 @@
+/*======================================================================*\
+ * Minimal rosbridge client: CBOR encoding
+\*======================================================================*/
+
+#ifndef ROSBRIDGE_CBOR_H_
+#define ROSBRIDGE_CBOR_H_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace rosbridge
+{
+
+/*
+ * Writes CBOR (RFC 8949) into a caller supplied buffer. Maps and arrays
+ * have a definite length, so the caller says up front how many entries
+ * follow. end*() only exist to keep the interface the same as JsonWriter.
+ * Floats are always written as single precision.
+ *
+ * Writing past the end sets the error flag instead of overflowing.
+ */
+class CborWriter
+{
+public:
+  CborWriter(uint8_t* buffer, int size) :
+    buffer_(buffer),
+    size_(size) {}
+
+  void beginMap(uint32_t pairs)
+  {
+    head(MAJOR_MAP, pairs);
+  }
+
+  void endMap() {}
+
+  void beginArray(uint32_t count)
+  {
+    head(MAJOR_ARRAY, count);
+  }
+
+  void endArray() {}
+
+  void key(const char* name)
+  {
+    text(name);
+  }
+
+  void text(const char* value)
+  {
+    uint32_t length = strlen(value);
+    head(MAJOR_TEXT, length);
+    put(value, length);
+  }
+
+  void integer(int32_t value)
+  {
+    if (value >= 0)
+      head(MAJOR_UNSIGNED, value);
+    else
+      head(MAJOR_NEGATIVE, -1 - value);
+  }
+
+  void number(float value)
+  {
+    uint32_t bits;
+    memcpy(&bits, &value, 4);
+    uint8_t data[5] = {0xfa, (uint8_t)(bits >> 24), (uint8_t)(bits >> 16), (uint8_t)(bits >> 8), (uint8_t) bits};
+    put(data, 5);
+  }
+
+  void boolean(bool value)
+  {
+    uint8_t data = value ? 0xf5 : 0xf4;
+    put(&data, 1);
+  }
+
+  void numbers(const float* values, uint32_t count)
+  {
+    beginArray(count);
+    for (uint32_t i = 0; i < count; i++)
+      number(values[i]);
+  }
+
+  void integers(const int32_t* values, uint32_t count)
+  {
+    beginArray(count);
+    for (uint32_t i = 0; i < count; i++)
+      integer(values[i]);
+  }
+
+  int length() const
+  {
+    return pos_;
+  }
+
+  bool error() const
+  {
+    return error_;
+  }
+
+protected:
+  static const uint8_t MAJOR_UNSIGNED = 0;
+  static const uint8_t MAJOR_NEGATIVE = 1;
+  static const uint8_t MAJOR_TEXT = 3;
+  static const uint8_t MAJOR_ARRAY = 4;
+  static const uint8_t MAJOR_MAP = 5;
+
+  /* Major type and argument in the shortest form */
+  void head(uint8_t major, uint32_t value)
+  {
+    uint8_t data[5];
+    int length;
+    if (value < 24)
+    {
+      data[0] = (major << 5) | value;
+      length = 1;
+    }
+    else if (value <= 0xff)
+    {
+      data[0] = (major << 5) | 24;
+      data[1] = value;
+      length = 2;
+    }
+    else if (value <= 0xffff)
+    {
+      data[0] = (major << 5) | 25;
+      data[1] = value >> 8;
+      data[2] = value;
+      length = 3;
+    }
+    else
+    {
+      data[0] = (major << 5) | 26;
+      data[1] = value >> 24;
+      data[2] = value >> 16;
+      data[3] = value >> 8;
+      data[4] = value;
+      length = 5;
+    }
+    put(data, length);
+  }
+
+  void put(const void* data, int length)
+  {
+    if (error_ || pos_ + length > size_)
+    {
+      error_ = true;
+      return;
+    }
+    memcpy(buffer_ + pos_, data, length);
+    pos_ += length;
+  }
+
+  uint8_t* buffer_;
+  int size_;
+  int pos_ = 0;
+  bool error_ = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*======================================================================*\
+ * Minimal rosbridge client: JSON encoding
+\*======================================================================*/
+
+#ifndef ROSBRIDGE_JSON_H_
+#define ROSBRIDGE_JSON_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+namespace rosbridge
+{
+
+/*
+ * Same interface as CborWriter, for rosbridge servers that only take JSON
+ * text. The entry counts are not needed and ignored. Strings are written
+ * as they are, without escaping, so they must not contain quotes or
+ * backslashes. NaN is written the way Python's json module reads it.
+ *
+ * Writing past the end sets the error flag instead of overflowing.
+ */
+class JsonWriter
+{
+public:
+  JsonWriter(uint8_t* buffer, int size) :
+    buffer_(buffer),
+    size_(size) {}
+
+  void beginMap(uint32_t)
+  {
+    open('{');
+  }
+
+  void endMap()
+  {
+    close('}');
+  }
+
+  void beginArray(uint32_t)
+  {
+    open('[');
+  }
+
+  void endArray()
+  {
+    close(']');
+  }
+
+  void key(const char* name)
+  {
+    text(name);
+    put(":", 1);
+    after_key_ = true;
+  }
+
+  void text(const char* value)
+  {
+    separate();
+    put("\"", 1);
+    put(value, strlen(value));
+    put("\"", 1);
+  }
+
+  void integer(int32_t value)
+  {
+    separate();
+    char data[12];
+    put(data, snprintf(data, sizeof(data), "%d", (int) value));
+  }
+
+  void number(float value)
+  {
+    separate();
+    if (isnan(value))
+    {
+      put("NaN", 3);
+      return;
+    }
+    char data[16];
+    put(data, snprintf(data, sizeof(data), "%.7g", value));
+  }
+
+  void boolean(bool value)
+  {
+    separate();
+    put(value ? "true" : "false", value ? 4 : 5);
+  }
+
+  void numbers(const float* values, uint32_t count)
+  {
+    beginArray(count);
+    for (uint32_t i = 0; i < count; i++)
+      number(values[i]);
+    endArray();
+  }
+
+  void integers(const int32_t* values, uint32_t count)
+  {
+    beginArray(count);
+    for (uint32_t i = 0; i < count; i++)
+      integer(values[i]);
+    endArray();
+  }
+
+  int length() const
+  {
+    return pos_;
+  }
+
+  bool error() const
+  {
+    return error_;
+  }
+
+protected:
+  /* Comma before every value of a map or array but the first */
+  void separate()
+  {
+    if (after_key_)
+      after_key_ = false;
+    else if (!first_)
+      put(",", 1);
+    first_ = false;
+  }
+
+  void open(char bracket)
+  {
+    separate();
+    put(&bracket, 1);
+    first_ = true;
+  }
+
+  void close(char bracket)
+  {
+    put(&bracket, 1);
+    first_ = false;
+  }
+
+  void put(const char* data, int length)
+  {
+    if (error_ || length < 0 || pos_ + length > size_)
+    {
+      error_ = true;
+      return;
+    }
+    memcpy(buffer_ + pos_, data, length);
+    pos_ += length;
+  }
+
+  uint8_t* buffer_;
+  int size_;
+  int pos_ = 0;
+  bool first_ = true;
+  bool after_key_ = false;
+  bool error_ = false;
+};
+
+}
+
+#endif
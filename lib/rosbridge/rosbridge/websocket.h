@@ -0,0 +1,427 @@
+/*======================================================================*\
+ * Minimal rosbridge client: WebSocket transport
+\*======================================================================*/
+
+#ifndef ROSBRIDGE_WEBSOCKET_H_
+#define ROSBRIDGE_WEBSOCKET_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(ESP32)
+  #include <lwip/sockets.h>
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace rosbridge
+{
+
+/*
+ * WebSocket client (RFC 6455) for the messages to a rosbridge server.
+ * Never blocks:
+ *
+ * - begin() starts the TCP connect, run() completes it, sends the upgrade
+ *   request and waits for the 101 answer. The Sec-WebSocket-Accept
+ *   header is not verified.
+ * - A message is encoded straight into the transmit buffer between
+ *   prepare() and send(), behind room for the frame header, and masked
+ *   in place. What the socket does not take is sent by run() before
+ *   anything else. Until then prepare() returns nullptr.
+ * - Received data frames that fit into the receive buffer in one piece
+ *   go to the onMessage() callback, all others are dropped. Pings are
+ *   answered, and ping() checks that the server is still there.
+ *   lastHeard() is the time the server last sent anything.
+ *
+ * Time is passed in as milliseconds.
+ */
+template<int TX_SIZE = 512, int RX_SIZE = 256>
+class WebSocketClient
+{
+public:
+  enum State { CLOSED, CONNECTING, HANDSHAKE, OPEN };
+
+  static const uint8_t OPCODE_TEXT = 0x1;
+  static const uint8_t OPCODE_BINARY = 0x2;
+  static const uint8_t OPCODE_CLOSE = 0x8;
+  static const uint8_t OPCODE_PING = 0x9;
+  static const uint8_t OPCODE_PONG = 0xa;
+  static const int HEADER_ROOM = 8;     // 16 bit length and mask key, enough for TX_SIZE
+
+  /* Payload of a received data frame, valid only during the call */
+  typedef void (*MessageCallback)(const uint8_t* data, int length, uint8_t opcode, void* arg);
+
+  ~WebSocketClient()
+  {
+    end();
+  }
+
+  /*
+   * Start connecting to ip (network byte order) and port. host and path
+   * go into the upgrade request and must stay valid until it is sent.
+   * seed makes the mask keys and the handshake key unpredictable.
+   */
+  bool begin(uint32_t ip, uint16_t port, const char* host, const char* path, uint32_t seed, uint32_t now)
+  {
+    end();
+    fd_ = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd_ < 0)
+      return false;
+    fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL, 0) | O_NONBLOCK);
+    int on = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));  // Every message is a write of its own
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = ip;
+    if (connect(fd_, (struct sockaddr*) &addr, sizeof(addr)) < 0 && errno != EINPROGRESS)
+    {
+      end();
+      return false;
+    }
+    host_ = host;
+    path_ = path;
+    random_ = seed ? seed : 1;
+    state_ = CONNECTING;
+    heard_ = now;
+    return true;
+  }
+
+  void end()
+  {
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+    state_ = CLOSED;
+    tx_start_ = tx_end_ = 0;
+    rx_length_ = 0;
+    skip_ = 0;
+    pong_length_ = -1;
+  }
+
+  void onMessage(MessageCallback callback, void* arg)
+  {
+    message_ = callback;
+    message_arg_ = arg;
+  }
+
+  State state() const
+  {
+    return state_;
+  }
+
+  bool isOpen() const
+  {
+    return state_ == OPEN;
+  }
+
+  uint32_t lastHeard() const
+  {
+    return heard_;
+  }
+
+  /* Buffer for the payload of the next message, *size bytes long. nullptr while busy. */
+  uint8_t* prepare(int* size)
+  {
+    if (state_ != OPEN || tx_start_ != tx_end_)
+      return nullptr;
+    *size = TX_SIZE - HEADER_ROOM;
+    return tx_ + HEADER_ROOM;
+  }
+
+  /* Frame and send the message written into prepare()'s buffer. False if the link broke. */
+  bool send(int length, uint8_t opcode)
+  {
+    if (state_ != OPEN || length < 0 || length > TX_SIZE - HEADER_ROOM)
+      return false;
+    int start = frame(tx_ + HEADER_ROOM, length, opcode);
+    tx_start_ = start;
+    tx_end_ = HEADER_ROOM + length;
+    return flush();
+  }
+
+  /* Ask the server for a sign of life */
+  void ping()
+  {
+    if (state_ == OPEN && tx_start_ == tx_end_)
+      control(OPCODE_PING, nullptr, 0);
+  }
+
+  /* Frames the socket did not take yet. Busy if > 0. */
+  int pending() const
+  {
+    return tx_end_ - tx_start_;
+  }
+
+  void run(uint32_t now)
+  {
+    if (state_ == CONNECTING)
+      poll();
+    if (state_ < HANDSHAKE)
+      return;
+    if (tx_start_ != tx_end_ && !flush())
+      return;
+    if (pong_length_ >= 0 && tx_start_ == tx_end_)
+    {
+      control(OPCODE_PONG, pong_, pong_length_);
+      pong_length_ = -1;
+    }
+    while (fd_ >= 0)
+    {
+      int n = recv(fd_, rx_ + rx_length_, RX_SIZE - rx_length_, MSG_DONTWAIT);
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+      {
+        end();
+        return;
+      }
+      if (n < 0)
+        return;
+      heard_ = now;
+      rx_length_ += n;
+      int used = state_ == HANDSHAKE ? handshake() : frames();
+      if (fd_ < 0)
+        return;
+      memmove(rx_, rx_ + used, rx_length_ - used);
+      rx_length_ -= used;
+    }
+  }
+
+protected:
+  /* Connect done? Then send the upgrade request. */
+  void poll()
+  {
+    fd_set wfds;
+    FD_ZERO(&wfds);
+    FD_SET(fd_, &wfds);
+    struct timeval tv = { 0, 0 };
+    int res = select(fd_ + 1, NULL, &wfds, NULL, &tv);
+    if (res == 0)
+      return;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (res < 0 || getsockopt(fd_, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0)
+    {
+      end();
+      return;
+    }
+    uint8_t key[16];
+    for (int i = 0; i < 16; i++)
+      key[i] = next();
+    char encoded[25];
+    base64(key, 16, encoded);
+    int n = snprintf((char*) tx_, TX_SIZE,
+                     "GET %s HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                     "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n", path_, host_, encoded);
+    if (n <= 0 || n >= TX_SIZE)
+    {
+      end();
+      return;
+    }
+    tx_start_ = 0;
+    tx_end_ = n;
+    state_ = HANDSHAKE;
+  }
+
+  /* Waits for the end of the server's answer. Returns the bytes used. */
+  int handshake()
+  {
+    for (int i = 3; i < rx_length_; i++)
+    {
+      if (memcmp(rx_ + i - 3, "\r\n\r\n", 4) != 0)
+        continue;
+      if (memcmp(rx_, "HTTP/1.1 101", 12) != 0)
+      {
+        end();
+        return 0;
+      }
+      state_ = OPEN;
+      return i + 1 + frames(i + 1);
+    }
+    if (rx_length_ == RX_SIZE)
+      end();  // No end in sight
+    return 0;
+  }
+
+  /* Handles the complete frames in the receive buffer. Returns the bytes used. */
+  int frames(int start = 0)
+  {
+    int pos = start;
+    if (skip_ > 0)
+    {
+      uint64_t available = rx_length_ - pos;
+      int n = available < skip_ ? available : skip_;
+      skip_ -= n;
+      pos += n;
+    }
+    while (fd_ >= 0 && rx_length_ - pos >= 2)
+    {
+      uint8_t opcode = rx_[pos] & 0x0f;
+      uint64_t length = rx_[pos + 1] & 0x7f;
+      int header = 2;
+      if (length == 126)
+      {
+        if (rx_length_ - pos < 4)
+          break;
+        length = (rx_[pos + 2] << 8) | rx_[pos + 3];
+        header = 4;
+      }
+      else if (length == 127)
+      {
+        if (rx_length_ - pos < 10)
+          break;
+        length = 0;
+        for (int i = 2; i < 10; i++)
+          length = (length << 8) | rx_[pos + i];
+        header = 10;
+      }
+      if (rx_[pos + 1] & 0x80)
+        header += 4;  // Servers must not mask, but skip the key anyway
+      if (rx_length_ - pos < header)
+        break;
+      // Unfragmented, unmasked and small enough to wait for in the buffer
+      bool deliver = message_ && opcode != 0 && opcode < OPCODE_CLOSE && (rx_[pos] & 0x80) && !(rx_[pos + 1] & 0x80)
+                     && length <= (uint64_t) (RX_SIZE - header);
+      if (opcode < OPCODE_CLOSE && !deliver && (uint64_t) (rx_length_ - pos - header) < length)
+      {
+        // Data is not needed, only skip it
+        skip_ = length - (rx_length_ - pos - header);
+        return rx_length_ - start;
+      }
+      if (opcode >= OPCODE_CLOSE && length > sizeof(pong_))
+      {
+        end();  // Control frames are at most 125 bytes
+        return 0;
+      }
+      if ((uint64_t) (rx_length_ - pos - header) < length)
+        break;
+      if (deliver)
+        message_(rx_ + pos + header, length, opcode, message_arg_);
+      else if (opcode == OPCODE_PING)
+      {
+        memcpy(pong_, rx_ + pos + header, length);
+        pong_length_ = length;
+      }
+      else if (opcode == OPCODE_CLOSE)
+      {
+        control(OPCODE_CLOSE, nullptr, 0);
+        end();
+        return 0;
+      }
+      pos += header + length;
+    }
+    return fd_ >= 0 ? pos - start : 0;
+  }
+
+  /* Header in front of the payload at data, payload masked. Returns the header's offset in tx_. */
+  int frame(uint8_t* data, int length, uint8_t opcode)
+  {
+    uint8_t mask[4];
+    uint32_t key = next();
+    memcpy(mask, &key, 4);
+    for (int i = 0; i < length; i++)
+      data[i] ^= mask[i & 3];
+    uint8_t* p = data - 4;
+    memcpy(p, mask, 4);
+    if (length < 126)
+    {
+      p -= 2;
+      p[1] = 0x80 | length;
+    }
+    else
+    {
+      p -= 4;
+      p[1] = 0x80 | 126;
+      p[2] = length >> 8;
+      p[3] = length;
+    }
+    p[0] = 0x80 | opcode;
+    return p - tx_;
+  }
+
+  /* Small control frame, only sent when nothing else is pending */
+  void control(uint8_t opcode, const uint8_t* payload, int length)
+  {
+    if (length > 0)
+      memcpy(tx_ + HEADER_ROOM, payload, length);
+    tx_start_ = frame(tx_ + HEADER_ROOM, length, opcode);
+    tx_end_ = HEADER_ROOM + length;
+    flush();
+  }
+
+  /* Hand the socket what it takes. False if the link broke. */
+  bool flush()
+  {
+    int n = ::send(fd_, tx_ + tx_start_, tx_end_ - tx_start_, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return true;
+      end();
+      return false;
+    }
+    tx_start_ += n;
+    if (tx_start_ == tx_end_)
+      tx_start_ = tx_end_ = 0;
+    return true;
+  }
+
+  /* xorshift32 for mask keys */
+  uint32_t next()
+  {
+    random_ ^= random_ << 13;
+    random_ ^= random_ >> 17;
+    random_ ^= random_ << 5;
+    return random_;
+  }
+
+  static void base64(const uint8_t* data, int length, char* out)
+  {
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    int o = 0;
+    for (int i = 0; i < length; i += 3)
+    {
+      uint32_t v = data[i] << 16;
+      if (i + 1 < length)
+        v |= data[i + 1] << 8;
+      if (i + 2 < length)
+        v |= data[i + 2];
+      out[o++] = ALPHABET[(v >> 18) & 0x3f];
+      out[o++] = ALPHABET[(v >> 12) & 0x3f];
+      out[o++] = i + 1 < length ? ALPHABET[(v >> 6) & 0x3f] : '=';
+      out[o++] = i + 2 < length ? ALPHABET[v & 0x3f] : '=';
+    }
+    out[o] = 0;
+  }
+
+  int fd_ = -1;
+  State state_ = CLOSED;
+  const char* host_ = "";
+  const char* path_ = "/";
+  uint32_t random_ = 1;
+  uint32_t heard_ = 0;
+  uint8_t tx_[TX_SIZE];
+  int tx_start_ = 0;
+  int tx_end_ = 0;
+  uint8_t rx_[RX_SIZE];
+  int rx_length_ = 0;
+  uint64_t skip_ = 0;       // Rest of a data frame that did not fit
+  uint8_t pong_[125];
+  int pong_length_ = -1;    // Ping to answer, -1 = none
+  MessageCallback message_ = nullptr;
+  void* message_arg_ = nullptr;
+};
+
+}
+
+#endif
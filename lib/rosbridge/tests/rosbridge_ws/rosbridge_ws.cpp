@@ -0,0 +1,731 @@
+/*
+ * rosbridge WebSocket client test against a stand-in server, compared with rosserial
+ *
+ * Host program, not an Arduino sketch. No rosbridge_server is needed: a
+ * stand-in on TCP loopback does the WebSocket upgrade, unmasks the
+ * client's frames and decodes them. CBOR and JSON are both parsed into
+ * path = value lists, which have to be the same for both encodings.
+ *
+ * 1. Joy as CBOR binary frames, then as JSON text frames: bytes on the
+ *    wire, CPU time to encode and send, latency until the server decoded
+ *    it, and heap allocations while publishing (must be 0).
+ * 2. The same Joy through rosserial over TCP loopback, a NodeHandle_ and
+ *    a stand-in rosserial host, for comparison.
+ * 3. The server stops reading until the socket is full. Every frame that
+ *    was accepted arrives intact once it reads again.
+ * 4. Pings both ways, a server data frame for the message callback, one
+ *    larger than the receive buffer, and a close from the server.
+ * 5. Encoding alone in a tight loop: CBOR, JSON and rosserial's serialize().
+ *
+ * Build and run from the repository root (Linux):
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/rosbridge -Ilib/ros_lib lib/rosbridge/tests/rosbridge_ws/rosbridge_ws.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o rosbridge_ws
+ *   ./rosbridge_ws [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <algorithm>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "rosbridge/cbor.h"
+#include "rosbridge/json.h"
+#include "rosbridge/websocket.h"
+#include "ros/node_handle.h"
+#include "sensor_msgs/Joy.h"
+
+static const int AXES = 8;
+static const int BUTTONS = 20;
+static const uint16_t BRIDGE_PORT = 19090;
+static const uint16_t ROSSERIAL_PORT = 19411;
+static const uint64_t PUBLISH_US = 2000;
+
+static int allocations = 0;
+
+void* operator new(size_t size)
+{
+  allocations++;
+  void* p = malloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+static uint64_t monotonicUs()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000ULL + t.tv_nsec / 1000;
+}
+
+static double cpuNs()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+struct Stats
+{
+  std::vector<double> v;
+  void add(double x)
+  {
+    v.push_back(x);
+  }
+  double pct(int p)
+  {
+    if (v.empty())
+      return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, v.size() * p / 100)];
+  }
+};
+
+/* rosbridge publish of a ROS1 sensor_msgs/Joy, the way the firmware writes it */
+template<class Writer>
+static int encodeJoy(uint8_t* buffer, int size, uint32_t seq, const float* axes, const int32_t* buttons)
+{
+  Writer w(buffer, size);
+  w.beginMap(3);
+  w.key("op");
+  w.text("publish");
+  w.key("topic");
+  w.text("/remote_joy");
+  w.key("msg");
+  w.beginMap(3);
+  w.key("header");
+  w.beginMap(3);
+  w.key("seq");
+  w.integer(seq);
+  w.key("stamp");
+  w.beginMap(2);
+  w.key("secs");
+  w.integer(1700000000);
+  w.key("nsecs");
+  w.integer(seq * 1000);
+  w.endMap();
+  w.key("frame_id");
+  w.text("remote");
+  w.endMap();
+  w.key("axes");
+  w.numbers(axes, AXES);
+  w.key("buttons");
+  w.integers(buttons, BUTTONS);
+  w.endMap();
+  w.endMap();
+  return w.error() ? -1 : w.length();
+}
+
+typedef std::map<std::string, std::string> Fields;
+
+static std::string number(double value)
+{
+  char text[32];
+  snprintf(text, sizeof(text), "%.7g", value);
+  return text;
+}
+
+/* Any CBOR item into path = value entries */
+static bool parseCbor(const uint8_t*& p, const uint8_t* end, const std::string& path, Fields& out)
+{
+  if (p >= end)
+    return false;
+  uint8_t major = *p >> 5;
+  uint8_t info = *p++ & 0x1f;
+  uint64_t arg = info;
+  int extra = info == 24 ? 1 : info == 25 ? 2 : info == 26 ? 4 : info == 27 ? 8 : 0;
+  if (info > 27 || p + extra > end)
+    return false;
+  if (extra)
+  {
+    arg = 0;
+    for (int i = 0; i < extra; i++)
+      arg = (arg << 8) | *p++;
+  }
+  switch (major)
+  {
+  case 0:
+    out[path] = std::to_string(arg);
+    return true;
+  case 1:
+    out[path] = std::to_string(-1 - (int64_t) arg);
+    return true;
+  case 3:
+    if (p + arg > end)
+      return false;
+    out[path] = "\"" + std::string((const char*) p, arg) + "\"";
+    p += arg;
+    return true;
+  case 4:
+    for (uint64_t i = 0; i < arg; i++)
+      if (!parseCbor(p, end, path + "." + std::to_string(i), out))
+        return false;
+    return true;
+  case 5:
+    for (uint64_t i = 0; i < arg; i++)
+    {
+      Fields key;
+      if (!parseCbor(p, end, "", key) || key[""].size() < 2 || key[""][0] != '"')
+        return false;
+      std::string name = key[""].substr(1, key[""].size() - 2);
+      if (!parseCbor(p, end, path.empty() ? name : path + "." + name, out))
+        return false;
+    }
+    return true;
+  case 7:
+    if (info == 20 || info == 21)
+    {
+      out[path] = info == 21 ? "true" : "false";
+      return true;
+    }
+    if (info == 26)
+    {
+      uint32_t bits = arg;
+      float value;
+      memcpy(&value, &bits, 4);
+      out[path] = number(value);
+      return true;
+    }
+    return false;
+  }
+  return false;
+}
+
+/* The JSON the writer produces (no escapes) into the same entries */
+static bool parseJson(const char*& p, const char* end, const std::string& path, Fields& out)
+{
+  if (p >= end)
+    return false;
+  if (*p == '{' || *p == '[')
+  {
+    char close = *p == '{' ? '}' : ']';
+    p++;
+    for (int i = 0; p < end && *p != close; i++)
+    {
+      if (i > 0 && *p++ != ',')
+        return false;
+      std::string name = std::to_string(i);
+      if (close == '}')
+      {
+        Fields key;
+        if (!parseJson(p, end, "", key) || p >= end || *p++ != ':')
+          return false;
+        name = key[""].substr(1, key[""].size() - 2);
+      }
+      if (!parseJson(p, end, path.empty() ? name : path + "." + name, out))
+        return false;
+    }
+    return p++ < end;
+  }
+  if (*p == '"')
+  {
+    const char* q = (const char*) memchr(p + 1, '"', end - p - 1);
+    if (q == nullptr)
+      return false;
+    out[path] = std::string(p, q + 1);
+    p = q + 1;
+    return true;
+  }
+  const char* q = p;
+  while (q < end && *q != ',' && *q != '}' && *q != ']')
+    q++;
+  std::string token(p, q);
+  p = q;
+  if (token == "true" || token == "false")
+    out[path] = token;
+  else if (token.find_first_of(".eEN") != std::string::npos)
+    out[path] = number(strtof(token.c_str(), nullptr));
+  else
+    out[path] = token;
+  return !token.empty();
+}
+
+/* Stand-in rosbridge server: upgrade, then unmask and decode every frame */
+struct Server
+{
+  int listener = -1;
+  int fd = -1;
+  bool upgraded = false;
+  bool reading = true;
+  std::vector<uint8_t> in;
+  std::vector<uint64_t> received_us;
+  std::vector<Fields> messages;
+  int frame_bytes = 0;
+  int bad = 0;
+  int pings = 0;
+  int pongs = 0;
+
+  void listen(uint16_t port)
+  {
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listener, (struct sockaddr*) &addr, sizeof(addr)) < 0 || ::listen(listener, 1) < 0)
+      perror("listen");
+    fcntl(listener, F_SETFL, O_NONBLOCK);
+  }
+
+  void send(uint8_t opcode, const void* payload, int length)
+  {
+    std::vector<uint8_t> frame = {(uint8_t)(0x80 | opcode)};
+    if (length < 126)
+    {
+      frame.push_back(length);
+    }
+    else
+    {
+      frame.push_back(126);
+      frame.push_back(length >> 8);
+      frame.push_back(length);
+    }
+    frame.insert(frame.end(), (const uint8_t*) payload, (const uint8_t*) payload + length);
+    ::send(fd, frame.data(), frame.size(), MSG_NOSIGNAL);
+  }
+
+  void pump()
+  {
+    if (fd < 0)
+    {
+      fd = accept(listener, nullptr, nullptr);
+      if (fd >= 0)
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+      return;
+    }
+    if (!reading)
+      return;
+    uint8_t data[65536];
+    int n;
+    while ((n = recv(fd, data, sizeof(data), 0)) > 0)
+      in.insert(in.end(), data, data + n);
+    if (!upgraded)
+    {
+      std::string request(in.begin(), in.end());
+      size_t end = request.find("\r\n\r\n");
+      if (end == std::string::npos)
+        return;
+      if (request.find("GET /") != 0 || request.find("Upgrade: websocket") == std::string::npos ||
+          request.find("Sec-WebSocket-Key: ") == std::string::npos)
+        bad++;
+      const char* answer = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                           "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n\r\n";
+      ::send(fd, answer, strlen(answer), MSG_NOSIGNAL);
+      in.erase(in.begin(), in.begin() + end + 4);
+      upgraded = true;
+    }
+    size_t pos = 0;
+    while (in.size() - pos >= 6)
+    {
+      const uint8_t* f = in.data() + pos;
+      uint8_t opcode = f[0] & 0x0f;
+      size_t length = f[1] & 0x7f;
+      size_t header = 2;
+      if (length == 126)
+      {
+        length = (f[2] << 8) | f[3];
+        header = 4;
+      }
+      if (!(f[1] & 0x80) || !(f[0] & 0x80) || length == 127)
+        bad++;  // Clients must mask, and never need 64 bit lengths here
+      if (in.size() - pos < header + 4 + length)
+        break;
+      std::vector<uint8_t> payload(f + header + 4, f + header + 4 + length);
+      for (size_t i = 0; i < length; i++)
+        payload[i] ^= f[header + i % 4];
+      if (opcode == 0x1 || opcode == 0x2)
+      {
+        Fields fields;
+        bool ok;
+        if (opcode == 0x2)
+        {
+          const uint8_t* p = payload.data();
+          ok = parseCbor(p, p + length, "", fields) && p == payload.data() + length;
+        }
+        else
+        {
+          const char* p = (const char*) payload.data();
+          ok = parseJson(p, p + length, "", fields) && p == (const char*) payload.data() + length;
+        }
+        bad += !ok;
+        received_us.push_back(monotonicUs());
+        messages.push_back(fields);
+        frame_bytes = header + 4 + length;
+      }
+      else if (opcode == 0x9)
+      {
+        pings++;
+        send(0xa, payload.data(), length);
+      }
+      else if (opcode == 0xa)
+      {
+        pongs++;
+      }
+      pos += header + 4 + length;
+    }
+    in.erase(in.begin(), in.begin() + pos);
+  }
+};
+
+/* rosserial over a TCP socket for the comparison */
+struct TcpHardware
+{
+  int fd = -1;
+  void init() {}
+  int read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(uint8_t* data, size_t length)
+  {
+    return recv(fd, data, length, MSG_DONTWAIT);
+  }
+  void write(uint8_t* data, int length)
+  {
+    if (send(fd, data, length, MSG_NOSIGNAL) != length)
+      perror("send");
+  }
+  unsigned long time()
+  {
+    return monotonicUs() / 1000;
+  }
+};
+
+struct RosserialHost
+{
+  int fd = -1;
+  uint8_t in[8192];
+  int len = 0;
+  std::vector<uint64_t> received_us;
+  int bytes = 0;
+
+  void sendFrame(uint16_t topic, const uint8_t* payload, int length)
+  {
+    uint8_t frame[64] = {0xff, ros::PROTOCOL_VER, (uint8_t) length, (uint8_t)(length >> 8)};
+    frame[4] = 255 - ((frame[2] + frame[3]) % 256);
+    frame[5] = topic;
+    frame[6] = topic >> 8;
+    if (length > 0)
+      memcpy(frame + 7, payload, length);
+    int chk = 0;
+    for (int i = 5; i < length + 7; i++)
+      chk += frame[i];
+    frame[length + 7] = 255 - chk % 256;
+    send(fd, frame, length + 8, MSG_NOSIGNAL);
+  }
+
+  void pump()
+  {
+    int n = recv(fd, in + len, sizeof(in) - len, MSG_DONTWAIT);
+    if (n > 0)
+      len += n;
+    int pos = 0;
+    while (pos + 8 <= len)
+    {
+      if (in[pos] != 0xff || in[pos + 1] != ros::PROTOCOL_VER)
+      {
+        pos++;
+        continue;
+      }
+      int length = in[pos + 2] | (in[pos + 3] << 8);
+      if (pos + 8 + length > len)
+        break;
+      uint16_t topic = in[pos + 5] | (in[pos + 6] << 8);
+      if (topic == ros::TopicInfo::ID_TIME)
+      {
+        uint64_t t = monotonicUs();
+        uint32_t stamp[2] = {(uint32_t)(t / 1000000), (uint32_t)(t % 1000000 * 1000)};
+        sendFrame(ros::TopicInfo::ID_TIME, (const uint8_t*) stamp, 8);
+      }
+      else if (topic >= 100)
+      {
+        received_us.push_back(monotonicUs());
+        bytes = length + 8;
+      }
+      pos += 8 + length;
+    }
+    memmove(in, in + pos, len - pos);
+    len -= pos;
+  }
+};
+
+typedef rosbridge::WebSocketClient<512, 256> Client;
+
+/* Server data frames the client passed on */
+static void onServerMessage(const uint8_t* data, int length, uint8_t opcode, void* arg)
+{
+  std::vector<std::string>* received = (std::vector<std::string>*) arg;
+  received->push_back(std::to_string(opcode) + " " + std::string((const char*) data, length));
+}
+
+static bool connectClient(Client& client, Server& server)
+{
+  client.begin(htonl(INADDR_LOOPBACK), BRIDGE_PORT, "localhost", "/", 12345, monotonicUs() / 1000);
+  uint64_t start = monotonicUs();
+  while (!client.isOpen() && client.state() != Client::CLOSED && monotonicUs() - start < 2000000)
+  {
+    client.run(monotonicUs() / 1000);
+    server.pump();
+    usleep(100);
+  }
+  return client.isOpen();
+}
+
+/* Publish frames Joy messages at a fixed rate, one encoding */
+template<class Writer>
+static bool publishJoy(const char* name, uint8_t opcode, Client& client, Server& server, int frames,
+                       Fields* reference)
+{
+  float axes[AXES] = {0, 0.5f, -1.0f, 0.123456f, 1e-7f, 0, 0, 1};
+  int32_t buttons[BUTTONS] = {1, 0, -5, 300000};
+  size_t first = server.messages.size();
+  Stats cpu_ns;
+  std::vector<uint64_t> published_us;
+  int busy = 0;
+  int allocated = 0;
+  uint64_t next = monotonicUs();
+  for (int sent = 0; sent < frames || monotonicUs() < next + 100000;)
+  {
+    if (sent < frames && monotonicUs() >= next)
+    {
+      published_us.push_back(monotonicUs());
+      int before = allocations;
+      double t0 = cpuNs();
+      int size;
+      uint8_t* buffer = client.prepare(&size);
+      int length = buffer ? encodeJoy<Writer>(buffer, size, sent, axes, buttons) : -1;
+      if (length > 0)
+        client.send(length, opcode);
+      else
+        busy++;
+      double t1 = cpuNs();
+      allocated += allocations - before;
+      cpu_ns.add(t1 - t0);
+      sent++;
+      next += PUBLISH_US;
+    }
+    client.run(monotonicUs() / 1000);
+    server.pump();
+    usleep(50);
+  }
+  int received = server.messages.size() - first;
+  bool same = received > 0;
+  for (size_t i = first; same && i < server.messages.size(); i++)
+  {
+    Fields& m = server.messages[i];
+    same = m["op"] == "\"publish\"" && m["msg.axes.1"] == "0.5" && m["msg.buttons.3"] == "300000" &&
+           m["msg.header.seq"] == std::to_string(i - first);
+    m.erase("msg.header.seq");
+    m.erase("msg.header.stamp.nsecs");
+    if (reference->empty())
+      *reference = m;
+    same = same && m == *reference;
+  }
+  Stats latency_us;
+  for (int i = 0; i < received && i < (int) published_us.size(); i++)
+    latency_us.add(server.received_us[first + i] - published_us[i]);
+  bool ok = received == frames && busy == 0 && same && server.bad == 0 && allocated == 0;
+  printf("%-9s Joy %d/%d %s, %d bytes per frame, encode+send CPU p50 %.1f us, latency p50 %.3f ms p99 %.3f ms, "
+         "%d heap allocations\n",
+         name, received, frames, ok ? "ok" : "FAILED", server.frame_bytes, cpu_ns.pct(50) / 1000,
+         latency_us.pct(50) / 1000, latency_us.pct(99) / 1000, allocated);
+  return ok;
+}
+
+int main(int argc, char** argv)
+{
+  int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  bool ok = true;
+
+  /* 1. CBOR and JSON */
+  Server server;
+  server.listen(BRIDGE_PORT);
+  static Client client;
+  if (!connectClient(client, server))
+  {
+    printf("WebSocket upgrade FAILED\n");
+    return 1;
+  }
+  Fields reference;
+  ok = publishJoy<rosbridge::CborWriter>("CBOR", Client::OPCODE_BINARY, client, server, frames, &reference) && ok;
+  ok = publishJoy<rosbridge::JsonWriter>("JSON", Client::OPCODE_TEXT, client, server, frames, &reference) && ok;
+
+  /* 2. the same over rosserial TCP */
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  int on = 1;
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(ROSSERIAL_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(listener, (struct sockaddr*) &addr, sizeof(addr)) < 0 || listen(listener, 1) < 0)
+  {
+    perror("listen");
+    return 2;
+  }
+  static ros::NodeHandle_<TcpHardware, 5, 5, 256, 256, 512, 512> nh;
+  nh.getHardware()->fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (connect(nh.getHardware()->fd, (struct sockaddr*) &addr, sizeof(addr)) < 0)
+  {
+    perror("connect");
+    return 2;
+  }
+  setsockopt(nh.getHardware()->fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  RosserialHost host;
+  host.fd = accept(listener, nullptr, nullptr);
+  float axes[AXES] = {0, 0.5f, -1.0f, 0.123456f, 1e-7f, 0, 0, 1};
+  int32_t buttons[BUTTONS] = {1, 0, -5, 300000};
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = AXES;
+  joy.buttons = buttons;
+  joy.buttons_length = BUTTONS;
+  ros::Publisher pub("remote_joy", &joy);
+  nh.initNode();
+  nh.advertise(pub);
+  host.sendFrame(ros::TopicInfo::ID_PUBLISHER, nullptr, 0);
+  uint64_t start = monotonicUs();
+  while (!nh.connected() && monotonicUs() - start < 5000000)
+  {
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+  Stats rosserial_cpu_ns;
+  std::vector<uint64_t> published_us;
+  int allocated = 0;
+  uint64_t next = monotonicUs();
+  for (int sent = 0; sent < frames || monotonicUs() < next + 100000;)
+  {
+    if (sent < frames && monotonicUs() >= next)
+    {
+      published_us.push_back(monotonicUs());
+      int before = allocations;
+      double t0 = cpuNs();
+      joy.header.seq = sent;
+      pub.publish(&joy);
+      double t1 = cpuNs();
+      allocated += allocations - before;
+      rosserial_cpu_ns.add(t1 - t0);
+      sent++;
+      next += PUBLISH_US;
+    }
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+  Stats rosserial_us;
+  for (size_t i = 0; i < host.received_us.size() && i < published_us.size(); i++)
+    rosserial_us.add(host.received_us[i] - published_us[i]);
+  bool rosserial_ok = (int) host.received_us.size() == frames;
+  printf("rosserial Joy %d/%d %s, %d bytes per frame, encode+send CPU p50 %.1f us, latency p50 %.3f ms p99 %.3f ms, "
+         "%d heap allocations\n",
+         (int) host.received_us.size(), frames, rosserial_ok ? "ok" : "FAILED", host.bytes, rosserial_cpu_ns.pct(50) / 1000,
+         rosserial_us.pct(50) / 1000, rosserial_us.pct(99) / 1000, allocated);
+  ok = ok && rosserial_ok;
+
+  /* 3. server stops reading: frames are refused while the socket is full, never cut */
+  server.reading = false;
+  size_t first = server.messages.size();
+  int accepted = 0;
+  int refused = 0;
+  uint8_t sample[512];
+  start = monotonicUs();
+  while (monotonicUs() - start < 300000)
+  {
+    int size;
+    uint8_t* buffer = client.prepare(&size);
+    int length = buffer ? encodeJoy<rosbridge::CborWriter>(buffer, size, accepted, axes, buttons) : -1;
+    if (length > 0 && client.send(length, Client::OPCODE_BINARY))
+      accepted++;
+    else
+      refused++;
+    client.run(monotonicUs() / 1000);
+  }
+  server.reading = true;
+  start = monotonicUs();
+  while ((server.messages.size() - first < (size_t) accepted || client.pending() > 0) && monotonicUs() - start < 5000000)
+  {
+    client.run(monotonicUs() / 1000);
+    server.pump();
+  }
+  bool intact = server.messages.size() - first == (size_t) accepted && server.bad == 0 && refused > 0;
+  for (size_t i = first; intact && i < server.messages.size(); i++)
+    intact = server.messages[i]["msg.header.seq"] == std::to_string(i - first);
+  printf("backpressure: %d accepted, %d refused while the server did not read, all accepted ones intact: %s\n", accepted,
+         refused, intact ? "ok" : "FAILED");
+  ok = ok && intact;
+
+  /* 4. pings, server data frames, close */
+  std::vector<std::string> received;
+  client.onMessage(onServerMessage, &received);
+  client.ping();
+  server.send(0x9, "hi", 2);
+  std::string answer(200, 'a');
+  server.send(0x1, answer.data(), answer.size());
+  std::string status(1000, 'x');
+  server.send(0x1, status.data(), status.size());
+  server.send(0x9, "again", 5);
+  start = monotonicUs();
+  while ((server.pings < 1 || server.pongs < 2) && monotonicUs() - start < 1000000)
+  {
+    client.run(monotonicUs() / 1000);
+    server.pump();
+    usleep(100);
+  }
+  bool control_ok = server.pings == 1 && server.pongs == 2 && client.isOpen() && received.size() == 1
+                    && received[0] == "1 " + answer;
+  server.send(0x8, nullptr, 0);
+  start = monotonicUs();
+  while (client.state() != Client::CLOSED && monotonicUs() - start < 1000000)
+  {
+    client.run(monotonicUs() / 1000);
+    usleep(100);
+  }
+  control_ok = control_ok && client.state() == Client::CLOSED;
+  printf("control: ping answered, 200 byte data frame passed on, 2 pongs after a dropped 1000 byte one, closed by the server: %s\n",
+         control_ok ? "ok" : "FAILED");
+  ok = ok && control_ok;
+
+  /* 5. encoding alone */
+  const int rounds = 100000;
+  int length = 0;
+  double t0 = cpuNs();
+  for (int i = 0; i < rounds; i++)
+    length += encodeJoy<rosbridge::CborWriter>(sample, sizeof(sample), i, axes, buttons);
+  double cbor_ns = (cpuNs() - t0) / rounds;
+  t0 = cpuNs();
+  for (int i = 0; i < rounds; i++)
+    length += encodeJoy<rosbridge::JsonWriter>(sample, sizeof(sample), i, axes, buttons);
+  double json_ns = (cpuNs() - t0) / rounds;
+  t0 = cpuNs();
+  for (int i = 0; i < rounds; i++)
+  {
+    joy.header.seq = i;
+    length += joy.serialize(sample);
+  }
+  double rosserial_ns = (cpuNs() - t0) / rounds;
+  printf("encode only: CBOR %.0f ns, JSON %.0f ns, rosserial serialize %.0f ns per Joy (%d)\n", cbor_ns, json_ns,
+         rosserial_ns, length > 0);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,588 @@
+/*
+ * XRCE-DDS client test against a stand-in agent, compared with rosserial
+ *
+ * Host program, not an Arduino sketch. No Micro XRCE-DDS Agent is needed:
+ * a stand-in implements the agent side of what the client uses on UDP
+ * loopback. That is CREATE_CLIENT, CREATE from XML with STATUS replies on
+ * its reliable stream, HEARTBEAT / ACKNACK in both directions, TIMESTAMP
+ * and best-effort WRITE_DATA. It decodes every Joy sample from CDR.
+ *
+ * 1. The session is created and the entities are set up while the agent
+ *    drops 30% of the reliable messages in both directions.
+ * 2. Joy is published best-effort, serialized straight from the input
+ *    arrays. Latency is measured from publish to decode on the shared
+ *    monotonic clock. The stamp error shows how well the clock is synced.
+ * 3. Samples on the reliable stream arrive complete and in order with 30%
+ *    loss again.
+ * 4. The same Joy goes through rosserial over TCP loopback, a NodeHandle_
+ *    and a stand-in rosserial host, for comparison.
+ *
+ * Build and run from the repository root (Linux):
+ *
+ *   g++ -std=gnu++11 -O2 -Ilib/xrce -Ilib/ros_lib lib/xrce/tests/xrce_agent/xrce_agent.cpp \
+ *       lib/ros_lib/time.cpp lib/ros_lib/duration.cpp -o xrce_agent
+ *   ./xrce_agent [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "xrce/session.h"
+#include "xrce/udp_transport.h"
+#include "ros/node_handle.h"
+#include "sensor_msgs/Joy.h"
+
+static const int AXES = 8;
+static const int BUTTONS = 20;
+static const uint16_t AGENT_PORT = 18888;
+static const uint16_t ROSSERIAL_PORT = 18411;
+static const uint64_t PUBLISH_US = 2000;
+
+static uint64_t monotonicUs()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000ULL + t.tv_nsec / 1000;
+}
+
+static int64_t realtimeNs()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_REALTIME, &t);
+  return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+/* sensor_msgs/msg/Joy straight from the input arrays, like the firmware does */
+static int serializeJoy(uint8_t* buffer, int size, int64_t stamp_ns, const float* axes, const int32_t* buttons)
+{
+  xrce::CdrWriter w(buffer, size);
+  w.writeInt32(stamp_ns / 1000000000);
+  w.write32(stamp_ns % 1000000000);
+  w.writeString("remote");
+  w.writeSequence(axes, AXES);
+  w.writeSequence(buttons, BUTTONS);
+  return w.error() ? -1 : w.length();
+}
+
+struct Stats
+{
+  std::vector<double> v;
+  void add(double x)
+  {
+    v.push_back(x);
+  }
+  double pct(int p)
+  {
+    if (v.empty())
+      return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, v.size() * p / 100)];
+  }
+};
+
+/* Agent side of the protocol subset the client uses */
+struct Agent
+{
+  int fd;
+  struct sockaddr_in client;
+  bool has_client = false;
+  int loss_pct = 0;
+  uint16_t reliable_in = 0;       // next expected from the client
+  uint16_t reliable_out = 0;
+  uint16_t out_first = 0;
+  std::vector<std::vector<uint8_t>> history;
+  int best_effort_last = -1;
+  uint64_t heartbeat_ts = 0;
+  int entities = 0;
+  int errors = 0;
+  int dropped = 0;
+  int samples = 0;
+  int bad_samples = 0;
+  int other_samples = 0;
+  std::vector<uint64_t> received_us;
+  std::vector<int64_t> stamp_ns;
+
+  bool lose()
+  {
+    if (rand() % 100 >= loss_pct)
+      return false;
+    dropped++;
+    return true;
+  }
+
+  void send(const uint8_t* data, int length)
+  {
+    sendto(fd, data, length, 0, (struct sockaddr*) &client, sizeof(client));
+  }
+
+  void control(uint8_t id, const uint8_t* payload, int length)
+  {
+    uint8_t m[64] = {xrce::SESSION_ID, 0, 0, 0, id, xrce::FLAG_LITTLE_ENDIAN, (uint8_t) length, 0};
+    memcpy(m + 8, payload, length);
+    send(m, 8 + length);
+  }
+
+  void reliable(uint8_t id, const uint8_t* payload, int length)
+  {
+    std::vector<uint8_t> m = {xrce::SESSION_ID, xrce::STREAM_RELIABLE, (uint8_t) reliable_out, (uint8_t)(reliable_out >> 8),
+                              id, xrce::FLAG_LITTLE_ENDIAN, (uint8_t) length, 0};
+    m.insert(m.end(), payload, payload + length);
+    history.push_back(m);
+    reliable_out++;
+    if (!lose())
+      send(m.data(), m.size());
+  }
+
+  void create(const uint8_t* p, int length)
+  {
+    uint8_t kind = p[4];
+    uint16_t object = (p[2] << 8) | p[3];
+    uint32_t xml_length;
+    memcpy(&xml_length, p + 8, 4);
+    std::string xml((const char*) p + 12, xml_length - 1);
+    bool ok = (object & 0x0f) == kind && p[5] == xrce::REPRESENTATION_AS_XML_STRING && xml.find("<dds>") == 0 &&
+              (int)(12 + xml_length) <= length;
+    ok = ok && (kind == xrce::OBJK_PARTICIPANT || (p[12 + xml_length] << 8 | p[13 + xml_length]) != 0);
+    entities += ok;
+    errors += !ok;
+    uint8_t status[6] = {p[0], p[1], p[2], p[3], (uint8_t)(ok ? xrce::STATUS_OK : 0x85), 0};
+    reliable(xrce::SUBMSG_STATUS, status, 6);
+  }
+
+  void writeData(const uint8_t* p, int length)
+  {
+    // Joy of data writer 1, anything else is only counted
+    if (length < 4 || p[2] != 0x00 || p[3] != (1 << 4 | xrce::OBJK_DATAWRITER))
+    {
+      other_samples++;
+      return;
+    }
+    const uint8_t* s = p + 4;
+    length -= 4;
+    int32_t sec = 0;
+    uint32_t nsec = 0, name_length = 0, axes_count = 0, buttons_count = 0;
+    float axis1 = 0;
+    int32_t button0 = 0;
+    int pos = 0;
+    bool ok = length >= 12;
+    if (ok)
+    {
+      memcpy(&sec, s, 4);
+      memcpy(&nsec, s + 4, 4);
+      memcpy(&name_length, s + 8, 4);
+      pos = (12 + name_length + 3) & ~3;
+      ok = name_length == 7 && pos + 4 + AXES * 4 + 4 + BUTTONS * 4 == length && !strcmp((const char*) s + 12, "remote");
+    }
+    if (ok)
+    {
+      memcpy(&axes_count, s + pos, 4);
+      memcpy(&axis1, s + pos + 8, 4);
+      pos += 4 + AXES * 4;
+      memcpy(&buttons_count, s + pos, 4);
+      memcpy(&button0, s + pos + 4, 4);
+      ok = axes_count == AXES && buttons_count == BUTTONS && axis1 == 0.5f && button0 == 1;
+    }
+    samples++;
+    bad_samples += !ok;
+    received_us.push_back(monotonicUs());
+    stamp_ns.push_back(sec * 1000000000LL + nsec);
+  }
+
+  void receive(const uint8_t* m, int length)
+  {
+    uint8_t stream = m[1];
+    uint16_t seq = m[2] | (m[3] << 8);
+    if (stream == xrce::STREAM_RELIABLE)
+    {
+      if (lose() || seq != reliable_in)
+        return;
+      reliable_in++;
+    }
+    if (stream == xrce::STREAM_BEST_EFFORT)
+    {
+      if ((int) seq <= best_effort_last)
+        return;
+      best_effort_last = seq;
+    }
+    int64_t received_ns = realtimeNs();
+    for (int pos = 4; pos + 4 <= length;)
+    {
+      uint8_t id = m[pos];
+      int size = m[pos + 2] | (m[pos + 3] << 8);
+      const uint8_t* p = m + pos + 4;
+      if (id == xrce::SUBMSG_CREATE_CLIENT)
+      {
+        if (memcmp(p, "XRCE", 4) != 0 || p[12] != xrce::SESSION_ID)
+          return;
+        reliable_in = 0;
+        reliable_out = 0;
+        out_first = 0;
+        history.clear();
+        best_effort_last = -1;
+        uint8_t status[11] = {xrce::STATUS_OK, 0, 'X', 'R', 'C', 'E', 1, 0, 0x0f, 0x0f, 0};
+        control(xrce::SUBMSG_STATUS_AGENT, status, 11);
+      }
+      else if (id == xrce::SUBMSG_CREATE)
+      {
+        create(p, size);
+      }
+      else if (id == xrce::SUBMSG_WRITE_DATA)
+      {
+        writeData(p, size);
+      }
+      else if (id == xrce::SUBMSG_HEARTBEAT)
+      {
+        uint16_t last = p[2] | (p[3] << 8);
+        uint16_t missing = 0;
+        for (int i = 0; i < 16 && (int16_t)(last - (uint16_t)(reliable_in + i)) >= 0; i++)
+          missing |= 1 << i;
+        uint8_t acknack[5] = {(uint8_t) reliable_in, (uint8_t)(reliable_in >> 8), (uint8_t)(missing >> 8),
+                              (uint8_t) missing, xrce::STREAM_RELIABLE};
+        control(xrce::SUBMSG_ACKNACK, acknack, 5);
+      }
+      else if (id == xrce::SUBMSG_ACKNACK)
+      {
+        uint16_t first = p[0] | (p[1] << 8);
+        uint16_t missing = (p[2] << 8) | p[3];
+        while (out_first != first && !history.empty())
+        {
+          history.erase(history.begin());
+          out_first++;
+        }
+        for (int i = 0; i < 16 && i < (int) history.size(); i++)
+          if ((missing & (1 << i)) && !lose())
+            send(history[i].data(), history[i].size());
+      }
+      else if (id == xrce::SUBMSG_TIMESTAMP)
+      {
+        int64_t tx = realtimeNs();
+        uint32_t reply[6] = {(uint32_t)(tx / 1000000000), (uint32_t)(tx % 1000000000),
+                             (uint32_t)(received_ns / 1000000000), (uint32_t)(received_ns % 1000000000)};
+        memcpy(reply + 4, p, 8);
+        control(xrce::SUBMSG_TIMESTAMP_REPLY, (uint8_t*) reply, 24);
+      }
+      pos = (pos + 4 + size + 3) & ~3;
+    }
+  }
+
+  void pump(uint64_t now)
+  {
+    uint8_t m[1024];
+    socklen_t len = sizeof(client);
+    int n;
+    while ((n = recvfrom(fd, m, sizeof(m), MSG_DONTWAIT, (struct sockaddr*) &client, &len)) > 0)
+    {
+      has_client = true;
+      receive(m, n);
+    }
+    // Repeat the first unacknowledged STATUS until the client confirms it
+    if (!history.empty() && now - heartbeat_ts > 20000)
+    {
+      uint16_t last = reliable_out - 1;
+      uint8_t heartbeat[5] = {(uint8_t) out_first, (uint8_t)(out_first >> 8), (uint8_t) last, (uint8_t)(last >> 8),
+                              xrce::STREAM_RELIABLE};
+      control(xrce::SUBMSG_HEARTBEAT, heartbeat, 5);
+      heartbeat_ts = now;
+    }
+  }
+};
+
+/* rosserial over a TCP socket for the comparison */
+struct TcpHardware
+{
+  int fd = -1;
+  void init() {}
+  int read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(uint8_t* data, size_t length)
+  {
+    return recv(fd, data, length, MSG_DONTWAIT);
+  }
+  void write(uint8_t* data, int length)
+  {
+    if (send(fd, data, length, MSG_NOSIGNAL) != length)
+      perror("send");
+  }
+  unsigned long time()
+  {
+    return monotonicUs() / 1000;
+  }
+};
+
+struct RosserialHost
+{
+  int fd = -1;
+  uint8_t in[8192];
+  int len = 0;
+  bool topics = false;
+  std::vector<uint64_t> received_us;
+  int bytes = 0;
+
+  void sendFrame(uint16_t topic, const uint8_t* payload, int length)
+  {
+    uint8_t frame[64] = {0xff, ros::PROTOCOL_VER, (uint8_t) length, (uint8_t)(length >> 8)};
+    frame[4] = 255 - ((frame[2] + frame[3]) % 256);
+    frame[5] = topic;
+    frame[6] = topic >> 8;
+    if (length > 0)
+      memcpy(frame + 7, payload, length);
+    int chk = 0;
+    for (int i = 5; i < length + 7; i++)
+      chk += frame[i];
+    frame[length + 7] = 255 - chk % 256;
+    send(fd, frame, length + 8, MSG_NOSIGNAL);
+  }
+
+  void pump()
+  {
+    int n = recv(fd, in + len, sizeof(in) - len, MSG_DONTWAIT);
+    if (n > 0)
+      len += n;
+    int pos = 0;
+    while (pos + 8 <= len)
+    {
+      if (in[pos] != 0xff || in[pos + 1] != ros::PROTOCOL_VER)
+      {
+        pos++;
+        continue;
+      }
+      int length = in[pos + 2] | (in[pos + 3] << 8);
+      if (pos + 8 + length > len)
+        break;
+      uint16_t topic = in[pos + 5] | (in[pos + 6] << 8);
+      if (topic == ros::TopicInfo::ID_PUBLISHER)
+      {
+        topics = true;
+      }
+      else if (topic == ros::TopicInfo::ID_TIME)
+      {
+        uint64_t t = monotonicUs();
+        uint32_t stamp[2] = {(uint32_t)(t / 1000000), (uint32_t)(t % 1000000 * 1000)};
+        sendFrame(ros::TopicInfo::ID_TIME, (const uint8_t*) stamp, 8);
+      }
+      else if (topic >= 100)
+      {
+        received_us.push_back(monotonicUs());
+        bytes = length + 8;
+      }
+      pos += 8 + length;
+    }
+    memmove(in, in + pos, len - pos);
+    len -= pos;
+  }
+};
+
+int main(int argc, char** argv)
+{
+  int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  srand(1);
+  float axes[AXES] = {0, 0.5f};
+  int32_t buttons[BUTTONS] = {1};
+  bool ok = true;
+
+  Agent agent;
+  agent.fd = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(AGENT_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(agent.fd, (struct sockaddr*) &addr, sizeof(addr)) < 0)
+  {
+    perror("bind");
+    return 2;
+  }
+
+  /* 1. session and entities with 30% loss on the reliable streams */
+  static xrce::UdpTransport transport;
+  static xrce::Session<xrce::UdpTransport, 512, 2> session(transport, 0x52454d31);
+  transport.begin(htonl(INADDR_LOOPBACK), AGENT_PORT);
+  agent.loss_pct = 30;
+  uint64_t start = monotonicUs();
+  session.begin(start);
+  const char* xml[4] = {
+    "<dds><participant><rtps><name>ros_remote</name></rtps></participant></dds>",
+    "<dds><topic><name>rt/remote_joy</name><dataType>sensor_msgs::msg::dds_::Joy_</dataType></topic></dds>",
+    "<dds><publisher/></dds>",
+    "<dds><data_writer><topic><kind>NO_KEY</kind><name>rt/remote_joy</name><dataType>sensor_msgs::msg::dds_::Joy_"
+    "</dataType></topic><qos><reliability><kind>BEST_EFFORT</kind></reliability></qos></data_writer></dds>"
+  };
+  int created = 0;
+  int last_request = -1;
+  double connect_ms = 0;
+  while (monotonicUs() - start < 5000000 && !(created == 4 && session.replied(last_request) && session.unacked() == 0))
+  {
+    uint64_t now = monotonicUs();
+    agent.pump(now);
+    session.run(now);
+    if (session.connected() && connect_ms == 0)
+      connect_ms = (now - start) / 1000.0;
+    if (session.connected() && created < 4)
+    {
+      int r = created == 0 ? session.createParticipant(1, 0, xml[0]) :
+              created == 1 ? session.createTopic(1, 1, xml[1]) :
+              created == 2 ? session.createPublisher(1, 1, xml[2]) :
+              session.createDataWriter(1, 1, xml[3]);
+      if (r > 0)
+      {
+        last_request = r;
+        created++;
+      }
+    }
+    usleep(200);
+  }
+  double setup_ms = (monotonicUs() - start) / 1000.0;
+  bool setup_ok = agent.entities == 4 && agent.errors == 0 && session.replied(last_request) && session.failed() == 0;
+  printf("XRCE session %.2f ms, 4 entities over the reliable stream in %.1f ms with 30%% loss (%d lost) %s\n",
+         connect_ms, setup_ms, agent.dropped, setup_ok ? "ok" : "FAILED");
+  ok = ok && setup_ok;
+
+  /* 2. best-effort Joy */
+  agent.loss_pct = 0;
+  while (!session.timeSynced() && monotonicUs() - start < 6000000)
+  {
+    agent.pump(monotonicUs());
+    session.run(monotonicUs());
+    usleep(200);
+  }
+  Stats publish_ns;
+  std::vector<uint64_t> published_us;
+  std::vector<int64_t> published_ns;
+  int wire = 0;
+  uint64_t next = monotonicUs();
+  for (int sent = 0; sent < frames || monotonicUs() < next + 100000;)
+  {
+    uint64_t now = monotonicUs();
+    if (sent < frames && now >= next)
+    {
+      struct timespec t0, t1;
+      published_ns.push_back(realtimeNs());
+      published_us.push_back(monotonicUs());
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      int size;
+      uint8_t* sample = session.prepareWrite(1, &size);
+      int length = serializeJoy(sample, size, session.agentTimeNs(monotonicUs()), axes, buttons);
+      session.commitWrite(length);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      publish_ns.add((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec));
+      wire = xrce::SAMPLE_OFFSET + length;
+      sent++;
+      next += PUBLISH_US;
+    }
+    agent.pump(now);
+    session.run(now);
+    usleep(50);
+  }
+  bool joy_ok = agent.samples == frames && agent.bad_samples == 0;
+  Stats xrce_us, stamp_error_us;
+  for (int i = 0; joy_ok && i < frames; i++)
+  {
+    xrce_us.add(agent.received_us[i] - published_us[i]);
+    stamp_error_us.add(fabs(agent.stamp_ns[i] - published_ns[i]) / 1000.0);
+  }
+  printf("XRCE      Joy %d/%d %s, %d bytes per datagram, publish p50 %.1f us, latency p50 %.3f ms p99 %.3f ms, "
+         "stamp error p50 %.0f us (sync rtt %u us)\n",
+         agent.samples, frames, joy_ok ? "ok" : "FAILED", wire, publish_ns.pct(50) / 1000, xrce_us.pct(50) / 1000,
+         xrce_us.pct(99) / 1000, stamp_error_us.pct(50), session.syncRtt());
+  ok = ok && joy_ok;
+
+  /* 3. reliable samples with 30% loss */
+  agent.loss_pct = 30;
+  agent.dropped = 0;
+  int before = agent.samples;
+  uint8_t sample[256];
+  int length = serializeJoy(sample, sizeof(sample), 0, axes, buttons);
+  start = monotonicUs();
+  for (int sent = 0; (sent < 50 || session.unacked() > 0) && monotonicUs() - start < 5000000;)
+  {
+    if (sent < 50 && session.writeReliable(1, sample, length))
+      sent++;
+    agent.pump(monotonicUs());
+    session.run(monotonicUs());
+    usleep(200);
+  }
+  bool reliable_ok = agent.samples - before == 50 && agent.bad_samples == 0;
+  printf("XRCE      50 reliable samples in %.1f ms with 30%% loss (%d lost) %s\n", (monotonicUs() - start) / 1000.0,
+         agent.dropped, reliable_ok ? "ok" : "FAILED");
+  ok = ok && reliable_ok;
+
+  /* 4. the same over rosserial TCP */
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  int on = 1;
+  setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  addr.sin_port = htons(ROSSERIAL_PORT);
+  if (bind(listener, (struct sockaddr*) &addr, sizeof(addr)) < 0 || listen(listener, 1) < 0)
+  {
+    perror("listen");
+    return 2;
+  }
+  ros::NodeHandle_<TcpHardware, 5, 5, 256, 256, 512, 512> nh;
+  nh.getHardware()->fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (connect(nh.getHardware()->fd, (struct sockaddr*) &addr, sizeof(addr)) < 0)
+  {
+    perror("connect");
+    return 2;
+  }
+  setsockopt(nh.getHardware()->fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  RosserialHost host;
+  host.fd = accept(listener, nullptr, nullptr);
+  nh.initNode();
+  nh.setTxBatching(true);
+  sensor_msgs::Joy joy;
+  joy.header.frame_id = "remote";
+  joy.axes = axes;
+  joy.axes_length = AXES;
+  joy.buttons = buttons;
+  joy.buttons_length = BUTTONS;
+  ros::Publisher pub("remote_joy", &joy);
+  nh.advertise(pub);
+  host.sendFrame(ros::TopicInfo::ID_PUBLISHER, nullptr, 0);
+  while (!nh.connected() && monotonicUs() - start < 10000000)
+  {
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+  Stats rosserial_ns;
+  published_us.clear();
+  next = monotonicUs();
+  for (int sent = 0; sent < frames || monotonicUs() < next + 100000;)
+  {
+    if (sent < frames && monotonicUs() >= next)
+    {
+      struct timespec t0, t1;
+      published_us.push_back(monotonicUs());
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      joy.header.stamp = nh.now();
+      pub.publish(&joy);
+      nh.spinOnce();
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      rosserial_ns.add((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec));
+      sent++;
+      next += PUBLISH_US;
+    }
+    nh.spinOnce();
+    host.pump();
+    usleep(50);
+  }
+  bool rosserial_ok = (int) host.received_us.size() == frames;
+  Stats rosserial_us;
+  for (int i = 0; rosserial_ok && i < frames; i++)
+    rosserial_us.add(host.received_us[i] - published_us[i]);
+  printf("rosserial Joy %d/%d %s, %d bytes per frame, publish p50 %.1f us, latency p50 %.3f ms p99 %.3f ms\n",
+         (int) host.received_us.size(), frames, rosserial_ok ? "ok" : "FAILED", host.bytes, rosserial_ns.pct(50) / 1000,
+         rosserial_us.pct(50) / 1000, rosserial_us.pct(99) / 1000);
+  ok = ok && rosserial_ok;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+/*======================================================================*\
+ * Minimal DDS-XRCE client: CDR serialization
+\*======================================================================*/
+
+#ifndef XRCE_CDR_H_
+#define XRCE_CDR_H_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace xrce
+{
+
+/*
+ * Writes little endian CDR into a caller supplied buffer. Alignment is
+ * relative to the start of the buffer, which is how the agent sees a
+ * sample. Fixed size arrays are copied as they are in memory, so the
+ * target has to be little endian like the ESP32.
+ *
+ * Writing past the end sets the error flag instead of overflowing.
+ */
+class CdrWriter
+{
+public:
+  CdrWriter(uint8_t* buffer, int size) :
+    buffer_(buffer),
+    size_(size) {}
+
+  void write8(uint8_t value)
+  {
+    put(&value, 1, 1);
+  }
+
+  void write16(uint16_t value)
+  {
+    put(&value, 2, 2);
+  }
+
+  void write32(uint32_t value)
+  {
+    put(&value, 4, 4);
+  }
+
+  void writeInt32(int32_t value)
+  {
+    put(&value, 4, 4);
+  }
+
+  void writeFloat(float value)
+  {
+    put(&value, 4, 4);
+  }
+
+  /* Raw bytes without alignment, e.g. object ids. */
+  void writeBytes(const void* data, int length)
+  {
+    put(data, length, 1);
+  }
+
+  /* Length including the terminating NUL, then the characters and the NUL. */
+  void writeString(const char* text)
+  {
+    uint32_t length = strlen(text) + 1;
+    write32(length);
+    put(text, length, 1);
+  }
+
+  /* Sequence of 4 byte elements: count, then the elements. */
+  template<typename T>
+  void writeSequence(const T* data, uint32_t count)
+  {
+    static_assert(sizeof(T) == 4, "4 byte elements only");
+    write32(count);
+    put(data, count * 4, 4);
+  }
+
+  void align(int alignment)
+  {
+    int pad = (alignment - pos_ % alignment) % alignment;
+    if (pos_ + pad > size_)
+    {
+      error_ = true;
+      return;
+    }
+    memset(buffer_ + pos_, 0, pad);
+    pos_ += pad;
+  }
+
+  int length() const
+  {
+    return pos_;
+  }
+
+  bool error() const
+  {
+    return error_;
+  }
+
+protected:
+  void put(const void* data, int length, int alignment)
+  {
+    align(alignment);
+    if (error_ || pos_ + length > size_)
+    {
+      error_ = true;
+      return;
+    }
+    memcpy(buffer_ + pos_, data, length);
+    pos_ += length;
+  }
+
+  uint8_t* buffer_;
+  int size_;
+  int pos_ = 0;
+  bool error_ = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,525 @@
+/*======================================================================*\
+ * Minimal DDS-XRCE client: session
+\*======================================================================*/
+
+#ifndef XRCE_SESSION_H_
+#define XRCE_SESSION_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "xrce/cdr.h"
+
+namespace xrce
+{
+
+// Submessage ids, DDS-XRCE 1.0 section 8.3.5
+const uint8_t SUBMSG_CREATE_CLIENT   = 0;
+const uint8_t SUBMSG_CREATE          = 1;
+const uint8_t SUBMSG_STATUS_AGENT    = 4;
+const uint8_t SUBMSG_STATUS          = 5;
+const uint8_t SUBMSG_WRITE_DATA      = 7;
+const uint8_t SUBMSG_ACKNACK         = 10;
+const uint8_t SUBMSG_HEARTBEAT       = 11;
+const uint8_t SUBMSG_TIMESTAMP       = 14;
+const uint8_t SUBMSG_TIMESTAMP_REPLY = 15;
+
+const uint8_t FLAG_LITTLE_ENDIAN = 0x01;
+const uint8_t FLAG_REPLACE       = 0x04;   // CREATE: replace an object left from an earlier session
+
+const uint8_t OBJK_PARTICIPANT = 0x01;
+const uint8_t OBJK_TOPIC       = 0x02;
+const uint8_t OBJK_PUBLISHER   = 0x03;
+const uint8_t OBJK_DATAWRITER  = 0x05;
+const uint8_t REPRESENTATION_AS_XML_STRING = 0x02;
+
+const uint8_t SESSION_ID         = 0x81;   // no client key in the message header
+const uint8_t SESSION_ID_NONE    = 0x80;   // CREATE_CLIENT
+const uint8_t STREAM_NONE        = 0x00;
+const uint8_t STREAM_BEST_EFFORT = 0x01;
+const uint8_t STREAM_RELIABLE    = 0x80;
+
+const uint8_t STATUS_OK         = 0x00;
+const uint8_t STATUS_OK_MATCHED = 0x01;
+
+const int HEADER_SIZE    = 4;              // message header without client key
+const int SUBHEADER_SIZE = 4;
+const int SAMPLE_OFFSET  = HEADER_SIZE + SUBHEADER_SIZE + 4;  // after WRITE_DATA's object request
+
+const uint32_t CREATE_CLIENT_US = 100000;  // CREATE_CLIENT repeat until the agent answers
+const uint32_t HEARTBEAT_US     = 20000;   // while reliable messages are unacknowledged
+const uint32_t PING_US          = 100000;  // TIMESTAMP, keeps the link alive and the clocks synced
+
+/*
+ * Client side of a DDS-XRCE session with one best-effort and one reliable
+ * output stream, for a Micro XRCE-DDS Agent:
+ *
+ * - begin() creates the client on the agent, repeated until it answers.
+ * - Entities are created from XML on the reliable stream. The agent
+ *   answers every request with a STATUS in order.
+ * - Samples are serialized straight into the outgoing message between
+ *   prepareWrite() and commitWrite() and sent best-effort, or copied with
+ *   writeReliable().
+ * - run() receives, acknowledges, repeats reliable messages the agent
+ *   reports missing, and pings with TIMESTAMP. The replies keep the link
+ *   alive and sync the agent's clock.
+ *
+ * Reliable messages are held in HISTORY slots of MTU bytes until acked.
+ * Nothing blocks. Time is passed in as a monotonic microsecond count.
+ */
+template<class Transport, int MTU = 512, int HISTORY = 4>
+class Session
+{
+public:
+  Session(Transport& transport, uint32_t client_key) :
+    transport_(transport),
+    key_(client_key) {}
+
+  /* Key the agent tells clients apart by. Takes effect with begin(). */
+  void setClientKey(uint32_t client_key)
+  {
+    key_ = client_key;
+  }
+
+  /* Start a new session. Drops everything that was not sent yet. */
+  void begin(uint64_t now)
+  {
+    connected_ = false;
+    synced_ = false;
+    best_effort_seq_ = 0;
+    reliable_first_ = 0;
+    reliable_next_ = 0;
+    reliable_in_ = 0;
+    request_ = 0;
+    replied_ = 0;
+    failed_ = 0;
+    heard_ = now;
+    sendCreateClient(now);
+  }
+
+  bool connected() const
+  {
+    return connected_;
+  }
+
+  /* Time of the last message from the agent */
+  uint64_t lastHeard() const
+  {
+    return heard_;
+  }
+
+  /*
+   * Create an entity on the agent. id is the object number without the
+   * kind, parent the number of the participant or publisher it belongs
+   * to. Returns the request id, or -1 if the reliable window is full or
+   * the XML does not fit.
+   */
+  int createParticipant(uint16_t id, int16_t domain, const char* xml)
+  {
+    return create(OBJK_PARTICIPANT, id, 0, domain, xml);
+  }
+
+  int createTopic(uint16_t id, uint16_t participant, const char* xml)
+  {
+    return create(OBJK_TOPIC, id, objectId(participant, OBJK_PARTICIPANT), 0, xml);
+  }
+
+  int createPublisher(uint16_t id, uint16_t participant, const char* xml)
+  {
+    return create(OBJK_PUBLISHER, id, objectId(participant, OBJK_PARTICIPANT), 0, xml);
+  }
+
+  int createDataWriter(uint16_t id, uint16_t publisher, const char* xml)
+  {
+    return create(OBJK_DATAWRITER, id, objectId(publisher, OBJK_PUBLISHER), 0, xml);
+  }
+
+  /* Has the agent answered this request and all before it? */
+  bool replied(int request) const
+  {
+    return request > 0 && (int16_t)(replied_ - request) >= 0;
+  }
+
+  /* Requests the agent rejected */
+  uint32_t failed() const
+  {
+    return failed_;
+  }
+
+  /*
+   * Buffer for a sample of data writer id, *size bytes long. Serialize
+   * into it, then send it with commitWrite().
+   */
+  uint8_t* prepareWrite(uint16_t datawriter, int* size)
+  {
+    header(out_, SESSION_ID, STREAM_BEST_EFFORT, best_effort_seq_);
+    writeRequest(out_ + HEADER_SIZE + SUBHEADER_SIZE, datawriter);
+    *size = MTU - SAMPLE_OFFSET;
+    return out_ + SAMPLE_OFFSET;
+  }
+
+  /* Send the sample prepared with prepareWrite() */
+  bool commitWrite(int length)
+  {
+    if (!connected_ || length < 0 || length > MTU - SAMPLE_OFFSET)
+      return false;
+    subheader(out_ + HEADER_SIZE, SUBMSG_WRITE_DATA, FLAG_LITTLE_ENDIAN, 4 + length);
+    best_effort_seq_++;
+    return transport_.send(out_, SAMPLE_OFFSET + length);
+  }
+
+  /* Send a sample on the reliable stream, e.g. configuration. */
+  bool writeReliable(uint16_t datawriter, const uint8_t* sample, int length)
+  {
+    if (length > MTU - SAMPLE_OFFSET)
+      return false;
+    uint8_t* message = reserveReliable();
+    if (message == nullptr)
+      return false;
+    writeRequest(message + HEADER_SIZE + SUBHEADER_SIZE, datawriter);
+    subheader(message + HEADER_SIZE, SUBMSG_WRITE_DATA, FLAG_LITTLE_ENDIAN, 4 + length);
+    memcpy(message + SAMPLE_OFFSET, sample, length);
+    return commitReliable(SAMPLE_OFFSET + length);
+  }
+
+  /* Reliable messages not acknowledged yet */
+  int unacked() const
+  {
+    return (uint16_t)(reliable_next_ - reliable_first_);
+  }
+
+  bool timeSynced() const
+  {
+    return synced_;
+  }
+
+  /* The agent's clock, in ns since the epoch, for a local time */
+  int64_t agentTimeNs(uint64_t now) const
+  {
+    return (int64_t) now * 1000 + offset_ns_;
+  }
+
+  /* Round trip of the last accepted time sync */
+  uint32_t syncRtt() const
+  {
+    return sync_rtt_;
+  }
+
+  void run(uint64_t now)
+  {
+    int n;
+    while ((n = transport_.receive(in_, MTU)) > 0)
+    {
+      heard_ = now;
+      receive(in_, n, now);
+    }
+    if (!connected_)
+    {
+      if (now - create_client_ts_ >= CREATE_CLIENT_US)
+        sendCreateClient(now);
+      return;
+    }
+    if (unacked() > 0 && now - heartbeat_ts_ >= HEARTBEAT_US)
+      sendHeartbeat(now);
+    if (now - ping_ts_ >= PING_US)
+      sendTimestamp(now);
+  }
+
+protected:
+  static uint16_t objectId(uint16_t id, uint8_t kind)
+  {
+    return (uint16_t)((id << 4) | kind);
+  }
+
+  static int header(uint8_t* data, uint8_t session, uint8_t stream, uint16_t seq)
+  {
+    data[0] = session;
+    data[1] = stream;
+    data[2] = seq & 0xff;
+    data[3] = seq >> 8;
+    return HEADER_SIZE;
+  }
+
+  static void subheader(uint8_t* data, uint8_t id, uint8_t flags, uint16_t length)
+  {
+    data[0] = id;
+    data[1] = flags;
+    data[2] = length & 0xff;
+    data[3] = length >> 8;
+  }
+
+  static uint16_t get16(const uint8_t* data)
+  {
+    return data[0] | (data[1] << 8);
+  }
+
+  static uint32_t get32(const uint8_t* data)
+  {
+    return get16(data) | ((uint32_t) get16(data + 2) << 16);
+  }
+
+  /* BaseObjectRequest: request id and object id, both big endian */
+  uint16_t writeRequest(uint8_t* data, uint16_t datawriter)
+  {
+    uint16_t request = ++request_;
+    uint16_t object = objectId(datawriter, OBJK_DATAWRITER);
+    data[0] = request >> 8;
+    data[1] = request & 0xff;
+    data[2] = object >> 8;
+    data[3] = object & 0xff;
+    return request;
+  }
+
+  int create(uint8_t kind, uint16_t id, uint16_t parent, int16_t domain, const char* xml)
+  {
+    uint8_t* message = reserveReliable();
+    if (message == nullptr)
+      return -1;
+    uint8_t* payload = message + HEADER_SIZE + SUBHEADER_SIZE;
+    CdrWriter w(payload, MTU - HEADER_SIZE - SUBHEADER_SIZE);
+    uint16_t request = ++request_;
+    uint16_t object = objectId(id, kind);
+    uint8_t ids[4] = {(uint8_t)(request >> 8), (uint8_t) request, (uint8_t)(object >> 8), (uint8_t) object};
+    w.writeBytes(ids, 4);
+    w.write8(kind);
+    w.write8(REPRESENTATION_AS_XML_STRING);
+    w.writeString(xml);
+    if (kind == OBJK_PARTICIPANT)
+    {
+      w.write16(domain);
+    }
+    else
+    {
+      uint8_t parent_id[2] = {(uint8_t)(parent >> 8), (uint8_t) parent};
+      w.writeBytes(parent_id, 2);
+    }
+    if (w.error())
+    {
+      request_--;
+      return -1;
+    }
+    subheader(message + HEADER_SIZE, SUBMSG_CREATE, FLAG_LITTLE_ENDIAN | FLAG_REPLACE, w.length());
+    commitReliable(HEADER_SIZE + SUBHEADER_SIZE + w.length());
+    return request;
+  }
+
+  /* Slot for the next reliable message, nullptr if the window is full */
+  uint8_t* reserveReliable()
+  {
+    if (!connected_ || unacked() >= HISTORY)
+      return nullptr;
+    Slot& slot = history_[reliable_next_ % HISTORY];
+    header(slot.data, SESSION_ID, STREAM_RELIABLE, reliable_next_);
+    return slot.data;
+  }
+
+  bool commitReliable(int length)
+  {
+    Slot& slot = history_[reliable_next_ % HISTORY];
+    slot.length = length;
+    reliable_next_++;
+    return transport_.send(slot.data, length);
+  }
+
+  void sendCreateClient(uint64_t now)
+  {
+    uint8_t message[HEADER_SIZE + SUBHEADER_SIZE + 16];
+    header(message, SESSION_ID_NONE, STREAM_NONE, 0);
+    CdrWriter w(message + HEADER_SIZE + SUBHEADER_SIZE, 16);
+    const uint8_t cookie_version_vendor[8] = {'X', 'R', 'C', 'E', 1, 0, 0x0f, 0x0f};
+    w.writeBytes(cookie_version_vendor, 8);
+    uint8_t key[4] = {(uint8_t)(key_ >> 24), (uint8_t)(key_ >> 16), (uint8_t)(key_ >> 8), (uint8_t) key_};
+    w.writeBytes(key, 4);
+    w.write8(SESSION_ID);
+    w.write8(0);                        // no properties
+    w.write16(MTU);
+    subheader(message + HEADER_SIZE, SUBMSG_CREATE_CLIENT, FLAG_LITTLE_ENDIAN, w.length());
+    transport_.send(message, HEADER_SIZE + SUBHEADER_SIZE + w.length());
+    create_client_ts_ = now;
+  }
+
+  void sendHeartbeat(uint64_t now)
+  {
+    uint8_t message[HEADER_SIZE + SUBHEADER_SIZE + 5];
+    header(message, SESSION_ID, STREAM_NONE, 0);
+    subheader(message + HEADER_SIZE, SUBMSG_HEARTBEAT, FLAG_LITTLE_ENDIAN, 5);
+    uint8_t* p = message + HEADER_SIZE + SUBHEADER_SIZE;
+    uint16_t last = reliable_next_ - 1;
+    p[0] = reliable_first_ & 0xff;
+    p[1] = reliable_first_ >> 8;
+    p[2] = last & 0xff;
+    p[3] = last >> 8;
+    p[4] = STREAM_RELIABLE;
+    transport_.send(message, sizeof(message));
+    heartbeat_ts_ = now;
+  }
+
+  /* Tell the agent what arrived on its reliable stream. Bit i of the
+   * bitmap asks for reliable_in_ + i again, up to its last message. */
+  void sendAcknack(uint16_t last)
+  {
+    uint16_t missing = 0;
+    for (int i = 0; i < 16 && (int16_t)(last - (uint16_t)(reliable_in_ + i)) >= 0; i++)
+      missing |= 1 << i;
+    uint8_t message[HEADER_SIZE + SUBHEADER_SIZE + 5];
+    header(message, SESSION_ID, STREAM_NONE, 0);
+    subheader(message + HEADER_SIZE, SUBMSG_ACKNACK, FLAG_LITTLE_ENDIAN, 5);
+    uint8_t* p = message + HEADER_SIZE + SUBHEADER_SIZE;
+    p[0] = reliable_in_ & 0xff;
+    p[1] = reliable_in_ >> 8;
+    p[2] = missing >> 8;
+    p[3] = missing & 0xff;
+    p[4] = STREAM_RELIABLE;
+    transport_.send(message, sizeof(message));
+  }
+
+  void sendTimestamp(uint64_t now)
+  {
+    uint8_t message[HEADER_SIZE + SUBHEADER_SIZE + 8];
+    header(message, SESSION_ID, STREAM_NONE, 0);
+    subheader(message + HEADER_SIZE, SUBMSG_TIMESTAMP, FLAG_LITTLE_ENDIAN, 8);
+    CdrWriter w(message + HEADER_SIZE + SUBHEADER_SIZE, 8);
+    w.writeInt32(now / 1000000);
+    w.write32(now % 1000000 * 1000);
+    transport_.send(message, sizeof(message));
+    ping_ts_ = now;
+  }
+
+  void receive(const uint8_t* data, int length, uint64_t now)
+  {
+    if (length < HEADER_SIZE || (data[0] != SESSION_ID && data[0] != SESSION_ID_NONE))
+      return;
+    uint8_t stream = data[1];
+    uint16_t seq = get16(data + 2);
+    if (stream == STREAM_RELIABLE)
+    {
+      // Only in order. Repeats are dropped, a gap is asked for again up to this message.
+      bool next = seq == reliable_in_;
+      if (next)
+        reliable_in_++;
+      sendAcknack((int16_t)(seq - reliable_in_) >= 0 ? seq : (uint16_t)(reliable_in_ - 1));
+      if (!next)
+        return;
+    }
+    int pos = HEADER_SIZE;
+    while (pos + SUBHEADER_SIZE <= length)
+    {
+      uint8_t id = data[pos];
+      int size = get16(data + pos + 2);
+      pos += SUBHEADER_SIZE;
+      if (pos + size > length)
+        return;
+      submessage(id, data + pos, size, now);
+      pos = (pos + size + 3) & ~3;
+    }
+  }
+
+  void submessage(uint8_t id, const uint8_t* p, int size, uint64_t now)
+  {
+    switch (id)
+    {
+      case SUBMSG_STATUS_AGENT:
+        if (size >= 1 && p[0] == STATUS_OK && !connected_)
+        {
+          connected_ = true;
+          sendTimestamp(now);
+        }
+        break;
+      case SUBMSG_STATUS:
+        if (size >= 6)
+        {
+          replied_ = (p[0] << 8) | p[1];
+          if (p[4] != STATUS_OK && p[4] != STATUS_OK_MATCHED)
+            failed_++;
+        }
+        break;
+      case SUBMSG_ACKNACK:
+        if (size >= 5 && p[4] == STREAM_RELIABLE)
+          acknack(get16(p), (p[2] << 8) | p[3], now);
+        break;
+      case SUBMSG_HEARTBEAT:
+        if (size >= 5 && p[4] == STREAM_RELIABLE)
+        {
+          // The agent gave up on what is before first
+          uint16_t first = get16(p);
+          if ((int16_t)(first - reliable_in_) > 0)
+            reliable_in_ = first;
+          sendAcknack(get16(p + 2));
+        }
+        break;
+      case SUBMSG_TIMESTAMP_REPLY:
+        if (size >= 24)
+          timestampReply(p, now);
+        break;
+    }
+  }
+
+  void acknack(uint16_t first, uint16_t missing, uint64_t now)
+  {
+    while (unacked() > 0 && (int16_t)(first - reliable_first_) > 0)
+      reliable_first_++;
+    for (int i = 0; i < 16; i++)
+    {
+      uint16_t seq = first + i;
+      if ((missing & (1 << i)) && (uint16_t)(seq - reliable_first_) < (uint16_t) unacked())
+      {
+        Slot& slot = history_[seq % HISTORY];
+        transport_.send(slot.data, slot.length);
+      }
+    }
+    heartbeat_ts_ = now;
+  }
+
+  /* Offset to the agent's clock from transmit, receive and originate time */
+  void timestampReply(const uint8_t* p, uint64_t now)
+  {
+    int64_t agent_tx = (int32_t) get32(p) * 1000000000LL + get32(p + 4);
+    int64_t agent_rx = (int32_t) get32(p + 8) * 1000000000LL + get32(p + 12);
+    int64_t sent = (int32_t) get32(p + 16) * 1000000000LL + get32(p + 20);
+    int64_t received = (int64_t) now * 1000;
+    int64_t rtt = (received - sent) - (agent_tx - agent_rx);
+    if (rtt < 0)
+      return;
+    // A slow reply has an unknown asymmetry, keep the better estimate
+    uint32_t rtt_us = rtt / 1000;
+    if (synced_ && rtt_us > 2 * min_rtt_ + 1000)
+      return;
+    if (!synced_ || rtt_us < min_rtt_)
+      min_rtt_ = rtt_us;
+    offset_ns_ = ((agent_rx - sent) + (agent_tx - received)) / 2;
+    sync_rtt_ = rtt_us;
+    synced_ = true;
+  }
+
+  struct Slot
+  {
+    uint8_t data[MTU];
+    int length;
+  };
+
+  Transport& transport_;
+  uint32_t key_;
+  bool connected_ = false;
+  uint8_t out_[MTU];
+  uint8_t in_[MTU];
+  Slot history_[HISTORY];
+  uint16_t best_effort_seq_ = 0;
+  uint16_t reliable_first_ = 0;   // oldest unacknowledged
+  uint16_t reliable_next_ = 0;
+  uint16_t reliable_in_ = 0;      // next expected from the agent
+  uint16_t request_ = 0;
+  uint16_t replied_ = 0;
+  uint32_t failed_ = 0;
+  uint64_t heard_ = 0;
+  uint64_t create_client_ts_ = 0;
+  uint64_t heartbeat_ts_ = 0;
+  uint64_t ping_ts_ = 0;
+  bool synced_ = false;
+  int64_t offset_ns_ = 0;
+  uint32_t sync_rtt_ = 0;
+  uint32_t min_rtt_ = 0;
+};
+
+}
+
+#endif
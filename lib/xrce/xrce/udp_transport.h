@@ -0,0 +1,92 @@
+/*======================================================================*\
+ * Minimal DDS-XRCE client: UDP transport
+\*======================================================================*/
+
+#ifndef XRCE_UDP_TRANSPORT_H_
+#define XRCE_UDP_TRANSPORT_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(ESP32)
+  #include <lwip/sockets.h>
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+namespace xrce
+{
+
+/*
+ * One XRCE message per datagram to the agent, the way the Micro XRCE-DDS
+ * Agent's udp4 transport expects it. Never blocks.
+ */
+class UdpTransport
+{
+public:
+  ~UdpTransport()
+  {
+    end();
+  }
+
+  /* Open the socket. agent_ip is in network byte order. */
+  bool begin(uint32_t agent_ip, uint16_t agent_port)
+  {
+    end();
+    fd_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd_ < 0)
+      return false;
+    fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL, 0) | O_NONBLOCK);
+    memset(&agent_, 0, sizeof(agent_));
+    agent_.sin_family = AF_INET;
+    agent_.sin_port = htons(agent_port);
+    agent_.sin_addr.s_addr = agent_ip;
+    return true;
+  }
+
+  void end()
+  {
+    if (fd_ >= 0)
+      close(fd_);
+    fd_ = -1;
+  }
+
+  bool isOpen() const
+  {
+    return fd_ >= 0;
+  }
+
+  bool send(const uint8_t* data, int length)
+  {
+    return fd_ >= 0 && sendto(fd_, data, length, 0, (struct sockaddr*) &agent_, sizeof(agent_)) == length;
+  }
+
+  /* Next datagram from the agent. <= 0 = nothing there */
+  int receive(uint8_t* data, int size)
+  {
+    if (fd_ < 0)
+      return -1;
+    while (true)
+    {
+      struct sockaddr_in from;
+      socklen_t from_len = sizeof(from);
+      int n = recvfrom(fd_, data, size, 0, (struct sockaddr*) &from, &from_len);
+      if (n <= 0)
+        return n;
+      if (from.sin_addr.s_addr == agent_.sin_addr.s_addr && from.sin_port == agent_.sin_port)
+        return n;
+    }
+  }
+
+protected:
+  int fd_ = -1;
+  struct sockaddr_in agent_;
+};
+
+}
+
+#endif
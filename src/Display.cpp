@@ -383,7 +383,32 @@ void mainScreen() {
     lv_obj_center(label);
 }
 
+// Red banner on top of all screens. Set from other tasks, shown by guiRun().
+static const char* volatile displayAlarm_ = nullptr;
+static const char* displayAlarmShown_ = nullptr;
+static lv_obj_t* displayAlarmLabel_ = nullptr;
+
+// Show an alarm text, nullptr removes it. Safe to call from any task.
+void displaySetAlarm(const char* text) {
+   displayAlarm_ = text;
+}
+
 void guiRun() {
+   const char* alarm = displayAlarm_;
+   if (alarm != displayAlarmShown_) {
+      displayAlarmShown_ = alarm;
+      if (alarm) {
+         if (!displayAlarmLabel_) {
+            displayAlarmLabel_ = lv_label_create(lv_layer_top());
+            lv_obj_set_style_text_color(displayAlarmLabel_, lv_palette_main(LV_PALETTE_RED), 0);
+            lv_obj_align(displayAlarmLabel_, LV_ALIGN_TOP_MID, 0, 4);
+         }
+         lv_label_set_text(displayAlarmLabel_, alarm);
+         lv_obj_clear_flag(displayAlarmLabel_, LV_OBJ_FLAG_HIDDEN);
+      } else if (displayAlarmLabel_) {
+         lv_obj_add_flag(displayAlarmLabel_, LV_OBJ_FLAG_HIDDEN);
+      }
+   }
    lv_timer_handler();
 }
 
@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include <lwip/dns.h>
+
+#include "Config.h"
+#include "HostLookup.h"
+
+enum HostLookupState { LOOKUP_FREE, LOOKUP_PENDING, LOOKUP_DONE, LOOKUP_FAILED };
+
+struct HostLookupSlot {
+    char host[HOST_LOOKUP_NAME_SIZE];
+    volatile uint8_t state;
+    volatile uint32_t ip;
+};
+
+static HostLookupSlot hostLookupSlots_[HOST_LOOKUP_SLOTS];
+
+// Runs in the lwIP thread. A pending slot is never reused, so arg is still this lookup's slot.
+static void hostLookupFound_(const char* name, const ip_addr_t* addr, void* arg) {
+    HostLookupSlot* slot = (HostLookupSlot*) arg;
+    if (addr) {
+        slot->ip = ip_2_ip4(addr)->addr;
+        slot->state = LOOKUP_DONE;
+    } else {
+        slot->state = LOOKUP_FAILED;
+    }
+}
+
+// Hands out a finished lookup and frees its slot
+static int hostLookupTake_(HostLookupSlot& slot, IPAddress& ip) {
+    int res = slot.state == LOOKUP_DONE ? 1 : -1;
+    if (res > 0) { ip = IPAddress((uint32_t) slot.ip); }
+    slot.state = LOOKUP_FREE;
+    return res;
+}
+
+int hostLookup(const char* host, IPAddress& ip) {
+    if (ip.fromString(host)) { return 1; }
+    if (strlen(host) >= HOST_LOOKUP_NAME_SIZE) { return -1; }
+    HostLookupSlot* slot = nullptr;
+    for (uint8_t i = 0; i < HOST_LOOKUP_SLOTS; i++) {
+        HostLookupSlot& s = hostLookupSlots_[i];
+        if (s.state != LOOKUP_FREE && strcmp(s.host, host) == 0) {
+            if (s.state == LOOKUP_PENDING) { return 0; }
+            return hostLookupTake_(s, ip);
+        }
+        // A free slot, else one whose result was never picked up
+        if (s.state != LOOKUP_PENDING && (!slot || s.state == LOOKUP_FREE)) { slot = &s; }
+    }
+    if (!slot) { return -1; }
+    strcpy(slot->host, host);
+    slot->state = LOOKUP_PENDING;
+    ip_addr_t addr;
+    err_t err = dns_gethostbyname(slot->host, &addr, hostLookupFound_, slot);
+    if (err == ERR_INPROGRESS) { return 0; }
+    if (err == ERR_OK) {
+        slot->ip = ip_2_ip4(&addr)->addr;
+        slot->state = LOOKUP_DONE;
+    } else {
+        slot->state = LOOKUP_FAILED;
+    }
+    return hostLookupTake_(*slot, ip);
+}
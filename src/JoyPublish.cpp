@@ -0,0 +1,93 @@
+#include <Arduino.h>
+
+#include "Config.h"
+#include "VUEF.h"
+#include "JoyPublish.h"
+#include "LatencyTrace.h"
+
+#ifndef JOY_MIN_MS
+#define JOY_MIN_MS 10
+#endif
+#ifndef JOY_HEARTBEAT_MS
+#define JOY_HEARTBEAT_MS 500
+#endif
+#ifndef JOY_AXIS_DELTA
+#define JOY_AXIS_DELTA 10
+#endif
+
+RegGroup configGroupJoy(FST("Joy"));
+
+ConfigUInt16 configJoyMinMs(FST("Joy Min Interval"), JOY_MIN_MS, FST("Minimum time between Joy messages in ms"), 0, &configGroupJoy);
+ConfigUInt16 configJoyHeartbeatMs(FST("Joy Heartbeat"), JOY_HEARTBEAT_MS, FST("Joy is republished after this many ms without changes"), 0, &configGroupJoy);
+ConfigUInt16 configJoyAxisDelta(FST("Joy Axis Delta"), JOY_AXIS_DELTA, FST("Axis change in 1/1000 that triggers a Joy message"), 0, &configGroupJoy);
+
+float joyPublishAxes[JOY_AXIS_SIZE] = {0};
+int32_t joyPublishButtons[JOY_BUTTON_SIZE] = {0};
+
+// Last inputs sent. Changes are detected against these, a failsafe does not touch them.
+static float joyLastAxes_[JOY_AXIS_SIZE] = {0};
+static int32_t joyLastButtons_[JOY_BUTTON_SIZE] = {0};
+static uint32_t joyLastTs_ = 0;
+static uint32_t joyDueTs_ = 0;       // Published then even without a change
+static int32_t joyHiddenTurns_ = 0;
+
+// True if a button, switch or encoder changed or an axis moved far enough since the last Joy message.
+// sampleUs is set to the time the triggering input was sampled.
+static bool joyChanged_(const int32_t* buttons, uint32_t* sampleUs) {
+    if (memcmp(buttons, joyLastButtons_, sizeof(joyLastButtons_)) != 0) {
+        *sampleUs = joyButtonsSampleUs;
+        return true;
+    }
+    float delta = configJoyAxisDelta.get() * 0.001;
+    *sampleUs = joyAxesSampleUs;
+    for (int i = 0; i < JOY_AXIS_SIZE; i++) {
+        if (fabsf(joyAxes[i] - joyLastAxes_[i]) > delta) { return true; }
+        // Always report an axis coming back to rest, even if the step is below delta
+        if (joyAxes[i] == 0.0 && joyLastAxes_[i] != 0.0) { return true; }
+    }
+    return false;
+}
+
+JoyPublishReason joyPublishPoll(uint32_t now, bool failsafe) {
+    if (failsafe) {
+        joyPublishZero();
+        return JOY_PUBLISH_FAILSAFE;
+    }
+    if ((now - joyLastTs_) < configJoyMinMs.get()) { return JOY_PUBLISH_NONE; }
+    int32_t buttons[JOY_BUTTON_SIZE];
+    memcpy(buttons, joyButtons, sizeof(buttons));
+    buttons[L_JOY_BUTTON_ENC] -= joyHiddenTurns_;
+    uint32_t sampleUs = 0;
+    bool changed = joyChanged_(buttons, &sampleUs);
+    if (!changed && (int32_t)(now - joyDueTs_) < 0) { return JOY_PUBLISH_NONE; }
+    if (changed) { latencyTraceStart(sampleUs, micros()); }
+    memcpy(joyPublishAxes, joyAxes, sizeof(joyPublishAxes));
+    memcpy(joyPublishButtons, buttons, sizeof(joyPublishButtons));
+    return changed ? JOY_PUBLISH_CHANGED : JOY_PUBLISH_HEARTBEAT;
+}
+
+void joyPublishSent(uint32_t now, JoyPublishReason reason) {
+    joyLastTs_ = now;
+    if (reason == JOY_PUBLISH_FAILSAFE) {
+        // The robot has not seen the current inputs yet
+        joyDueTs_ = now + configJoyMinMs.get();
+        return;
+    }
+    memcpy(joyLastAxes_, joyPublishAxes, sizeof(joyLastAxes_));
+    memcpy(joyLastButtons_, joyPublishButtons, sizeof(joyLastButtons_));
+    joyDueTs_ = now + configJoyHeartbeatMs.get();
+}
+
+void joyPublishZero() {
+    memset(joyPublishAxes, 0, sizeof(joyPublishAxes));
+    memset(joyPublishButtons, 0, sizeof(joyPublishButtons));
+}
+
+void joyPublishForce(uint32_t now) {
+    joyLastTs_ = now - configJoyMinMs.get();
+    joyDueTs_ = now;
+}
+
+void joyPublishHideTurns(int32_t steps) {
+    joyHiddenTurns_ += steps;
+}
@@ -0,0 +1,108 @@
+#include <Arduino.h>
+
+#include "Config.h"
+#include "VUEF.h"
+#include "LatencyTrace.h"
+
+RegGroup stateGroupLatency(FST("Latency"));
+
+static char latencyText_[LAT_STAGE_SIZE][64];
+
+StateStr stateLatencySampleToDecision(FST("Sample to Decision"), FST(""), FST("Input sample until publish decision"), 0, &stateGroupLatency);
+StateStr stateLatencyDecisionToQueued(FST("Decision to Queued"), FST(""), FST("Publish decision until the frame is serialized and queued"), 0, &stateGroupLatency);
+StateStr stateLatencyQueuedToWrite(FST("Queued to Write"), FST(""), FST("Queued frame until it was written to the socket"), 0, &stateGroupLatency);
+StateStr stateLatencySampleToWrite(FST("Sample to Write"), FST(""), FST("Input sample until the frame was written to the socket"), 0, &stateGroupLatency);
+static StateStr* latencyStates_[LAT_STAGE_SIZE] = {
+    &stateLatencySampleToDecision, &stateLatencyDecisionToQueued, &stateLatencyQueuedToWrite, &stateLatencySampleToWrite
+};
+
+bool latencyResetCb(uint8_t val, void* cbData) {
+    if (val) { latencyTraceReset(); }
+    return false;
+}
+ConfigUInt8 configLatencyReset(FST("Latency Reset"), 0, FST("Write 1 to reset the latency histograms"), nullptr, nullptr, nullptr, latencyResetCb);
+
+LatencyHistogram latencyHistograms[LAT_STAGE_SIZE];
+
+// Timestamps of the Joy message currently travelling through the publish path
+static volatile bool latencyActive_ = false;
+static uint32_t latencySampleUs_ = 0;
+static uint32_t latencyDecisionUs_ = 0;
+static uint32_t latencyQueuedUs_ = 0;
+static volatile bool latencyResetPending_ = false;
+static uint32_t latencyUpdateTs_ = 0;
+
+void LatencyHistogram::add(uint32_t us) {
+    uint8_t i = 0;
+    while (i < LATENCY_BUCKETS - 1 && us >= (16UL << i)) { i++; }
+    buckets[i]++;
+    count++;
+    if (us > max) { max = us; }
+}
+
+void LatencyHistogram::reset() {
+    count = 0;
+    max = 0;
+    memset(buckets, 0, sizeof(buckets));
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t pct) const {
+    if (count == 0) { return 0; }
+    uint32_t target = (count * pct + 99) / 100;
+    uint32_t acc = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS - 1; i++) {
+        acc += buckets[i];
+        if (acc >= target) { return 16UL << i; }
+    }
+    return max;
+}
+
+size_t LatencyHistogram::format(char* buffer, size_t bSize) const {
+    return snprintf(buffer, bSize, FST("n:%u p50:<%u p90:<%u p99:<%u max:%u us"),
+        count, percentile(50), percentile(90), percentile(99), max);
+}
+
+// A changed input was sampled at sampleUs and picked up for publishing at decisionUs
+void latencyTraceStart(uint32_t sampleUs, uint32_t decisionUs) {
+    latencySampleUs_ = sampleUs;
+    latencyDecisionUs_ = decisionUs;
+    latencyQueuedUs_ = 0;
+    latencyActive_ = true;
+}
+
+// The traced message is serialized and handed to the node handle
+void latencyTraceQueued() {
+    if (!latencyActive_) { return; }
+    latencyQueuedUs_ = micros();
+    latencyHistograms[LAT_SAMPLE_TO_DECISION].add(latencyDecisionUs_ - latencySampleUs_);
+    latencyHistograms[LAT_DECISION_TO_QUEUED].add(latencyQueuedUs_ - latencyDecisionUs_);
+}
+
+// Everything queued so far, including the traced message, left through the socket
+void latencyTraceWritten() {
+    if (!latencyActive_ || latencyQueuedUs_ == 0) { return; }
+    uint32_t now = micros();
+    latencyHistograms[LAT_QUEUED_TO_WRITE].add(now - latencyQueuedUs_);
+    latencyHistograms[LAT_SAMPLE_TO_WRITE].add(now - latencySampleUs_);
+    latencyActive_ = false;
+}
+
+// May be called from any task, the histograms are cleared by the ROS task
+void latencyTraceReset() {
+    latencyResetPending_ = true;
+}
+
+void latencyTraceRun(uint32_t now) {
+    if (latencyResetPending_) {
+        latencyResetPending_ = false;
+        latencyActive_ = false;
+        for (uint8_t i = 0; i < LAT_STAGE_SIZE; i++) { latencyHistograms[i].reset(); }
+        latencyUpdateTs_ = 0;
+    }
+    if (latencyUpdateTs_ != 0 && (now - latencyUpdateTs_) < LATENCY_UPDATE_MS) { return; }
+    latencyUpdateTs_ = now;
+    for (uint8_t i = 0; i < LAT_STAGE_SIZE; i++) {
+        latencyHistograms[i].format(latencyText_[i], sizeof(latencyText_[i]));
+        latencyStates_[i]->set(latencyText_[i]);
+    }
+}
@@ -1,47 +1,200 @@
 #include <Arduino.h>
 #include <WiFi.h>
+#include <lwip/sockets.h>
+#include <esp_log.h>
 #include <sensor_msgs/Joy.h>
 #include <sensor_msgs/BatteryState.h>
+#include <std_msgs/Time.h>
 
 #include "Config.h"
 #include "VUEF.h"
 #include "ROS1.h"
 #include "Battery.h"
+#include "LatencyTrace.h"
+#include "HostLookup.h"
+#include "JoyPublish.h"
+#if ENABLE_DISPLAY
+#include "Display.h"
+#endif
+
+#if ROS_VERSION != 2 && ROS_VERSION != 3
 
+#ifndef ROS1_CONNECT_TIMEOUT_MS
+#define ROS1_CONNECT_TIMEOUT_MS 1000
+#endif
+// Reconnect backoff. The cap keeps the gap after a host reboot short.
+#ifndef ROS1_RETRY_MIN_MS
+#define ROS1_RETRY_MIN_MS 50
+#endif
+#ifndef ROS1_RETRY_MAX_MS
+#define ROS1_RETRY_MAX_MS 400
+#endif
+// A host that sent nothing for this long is considered dead. Probed after a third of it.
+#ifndef ROS1_LIVENESS_MS
+#define ROS1_LIVENESS_MS 300
+#endif
+// 0 = TCP (rosserial_python, rosserial_server socket_node), 1 = UDP (rosserial_server udp_socket_node)
+#ifndef ROS1_TRANSPORT
+#define ROS1_TRANSPORT 0
+#endif
+// Port the host sends UDP datagrams to, the client_port of udp_socket_node
+#ifndef ROS1_UDP_LOCAL_PORT
+#define ROS1_UDP_LOCAL_PORT 11411
+#endif
+// 0 = off, 1 = rosserial over UART0 whenever a host talks on it, WiFi otherwise.
+// UART0 is the debug console otherwise, with the link it prints nothing.
+#ifndef ROS1_SERIAL_LINK
+#define ROS1_SERIAL_LINK 0
+#endif
+#ifndef ROS1_SERIAL_BAUD
+#define ROS1_SERIAL_BAUD 921600
+#endif
+// Serial host silent for this long: go back to WiFi
+#ifndef ROS1_SERIAL_FALLBACK_MS
+#define ROS1_SERIAL_FALLBACK_MS 2000
+#endif
+// Further ROS masters that are kept connected next to the first one. Empty = none.
+#ifndef ROS1_HOST2
+#define ROS1_HOST2 ""
+#endif
+#ifndef ROS1_HOST3
+#define ROS1_HOST3 ""
+#endif
+#define ROS1_MAX_TARGETS 3
+#define ROS1_HEALTH_UPDATE_MS 1000
 
 RegGroup configGroupRos1(FST("ROS1"));
 
 ConfigStr configRos1Host(FST("Host"), 32, ROS1_HOST, FST("ROS1 server"), 0, &configGroupRos1);
+ConfigStr configRos1Host2(FST("Host 2"), 32, ROS1_HOST2, FST("Second ROS1 server, kept connected in standby. Empty = none. Needs a restart"), 0, &configGroupRos1);
+ConfigStr configRos1Host3(FST("Host 3"), 32, ROS1_HOST3, FST("Third ROS1 server, kept connected in standby. Empty = none. Needs a restart"), 0, &configGroupRos1);
 ConfigUInt16 configRos1Port(FST("Port"), ROS1_PORT, FST("ROS1 server port number"), 0, &configGroupRos1);
+ConfigUInt8 configRos1Transport(FST("Transport"), ROS1_TRANSPORT, FST("0 = TCP, 1 = UDP to rosserial_server udp_socket_node"), 0, &configGroupRos1);
+ConfigUInt16 configRos1UdpPort(FST("UDP Local Port"), ROS1_UDP_LOCAL_PORT, FST("Port the host sends UDP datagrams to (client_port)"), 0, &configGroupRos1);
+ConfigUInt8 configRos1SerialLink(FST("Serial Link"), ROS1_SERIAL_LINK, FST("1 = prefer a rosserial host on UART0 over WiFi for the first server, turns the serial console off. Needs a restart"), 0, &configGroupRos1);
+ConfigUInt32 configRos1SerialBaud(FST("Serial Baud"), ROS1_SERIAL_BAUD, FST("Baud rate of the serial link"), 0, &configGroupRos1);
+ConfigUInt16 configRos1LivenessMs(FST("Liveness Timeout"), ROS1_LIVENESS_MS, FST("ms without data from the host until the link is lost. 0 = off"), 0, &configGroupRos1);
 StateStr stateRos1Connection(FST("Connection"), FST("Not connected"), FST("ROS1 connection state"), 0, &configGroupRos1);
+StateUInt32 stateRos1ActiveTarget(FST("Active Target"), 1, FST("Server that gets the Joy messages. Left encoder button + turn to switch"), 0, &configGroupRos1);
+StateStr stateRos1Target1(FST("Target 1"), FST(""), FST("Connection health of Host"), 0, &configGroupRos1);
+StateStr stateRos1Target2(FST("Target 2"), FST(""), FST("Connection health of Host 2"), 0, &configGroupRos1);
+StateStr stateRos1Target3(FST("Target 3"), FST(""), FST("Connection health of Host 3"), 0, &configGroupRos1);
+StateUInt32 stateRos1TxDropped(FST("TX Dropped"), 0, FST("Frames dropped because the link was congested"), 0, &configGroupRos1);
+StateUInt32 stateRos1RxSkipped(FST("RX Skipped"), 0, FST("Received frames too large for the input buffer"), 0, &configGroupRos1);
+StateUInt32 stateRos1TxReplaced(FST("TX Replaced"), 0, FST("Unsent frames replaced by a newer value"), 0, &configGroupRos1);
+StateUInt32 stateRos1SyncRtt(FST("Sync RTT"), 0, FST("Round trip of the last accepted time sync in us"), 0, &configGroupRos1);
+StateInt32 stateRos1ClockDrift(FST("Clock Drift"), 0, FST("Host clock drift against the remote in ppb"), 0, &configGroupRos1);
+StateUInt32 stateRos1ReconnectMs(FST("Reconnect Time"), 0, FST("ms from losing the link until the node was ready again"), 0, &configGroupRos1);
+StateUInt32 stateRos1ConnectAttempts(FST("Connect Attempts"), 0, FST("Connect attempts needed for the last reconnect"), 0, &configGroupRos1);
+StateUInt32 stateRos1LossDetectMs(FST("Loss Detect Time"), 0, FST("ms from the last data of the host until the link was declared lost"), 0, &configGroupRos1);
+StateUInt32 stateRos1SwitchUs(FST("Switch Time"), 0, FST("us from the switch input until the new target had the Joy message"), 0, &configGroupRos1);
 
+static ConfigStr* ros1TargetHosts_[ROS1_MAX_TARGETS] = { &configRos1Host, &configRos1Host2, &configRos1Host3 };
+static StateStr* ros1TargetStates_[ROS1_MAX_TARGETS] = { &stateRos1Target1, &stateRos1Target2, &stateRos1Target3 };
 
-WiFiClient ros1WifiClient;
-ros::NodeHandle_<Ros1WiFiLink> ros1Node;
 
+// The registered topics. All buffers are sized from them at compile time.
+#define ROS1_FRAME_ID "remote"
+#define ROS1_JOY_TOPIC "remote_joy"
+#define ROS1_JOY_TYPE "sensor_msgs/Joy"
+#define ROS1_BATTERY_TOPIC "remote_battery"
+#define ROS1_BATTERY_TYPE "sensor_msgs/BatteryState"
+#define ROS1_LED_TOPIC "toggle_led"
+#define ROS1_LED_TYPE "std_msgs/Empty"
+// Node handle slots: Joy and battery out, toggle_led and a topic inspected at runtime in
+#define ROS1_MAX_PUBLISHERS 2
+#define ROS1_MAX_SUBSCRIBERS 2
 
-sensor_msgs::Joy ros1JoyMsg;
-ros::Publisher ros1PublisherJoy(FST("remote_joy"), &ros1JoyMsg);
-uint32_t ros1JoyTs_ = 0;
-#ifndef ROS1_PUB_JOY_MS
-#define ROS1_PUB_JOY_MS 100
+#define ROS1_STRLEN(s) ((int) sizeof(s) - 1)
+#define ROS1_FRAME(payload) ((payload) + ros::FRAME_OVERHEAD)
+// TopicInfo frame that negotiates a topic
+#define ROS1_TOPIC_FRAME(topic, type) ROS1_FRAME(rosserial_msgs::TopicInfo::maxSerializedLength(ROS1_STRLEN(topic), ROS1_STRLEN(type)))
+
+static constexpr int ROS1_JOY_FRAME_SIZE = ROS1_FRAME(sensor_msgs::Joy::maxSerializedLength(ROS1_STRLEN(ROS1_FRAME_ID), JOY_AXIS_SIZE, JOY_BUTTON_SIZE));
+#if BATTERY_PIN >= 0
+// No cells, location or serial number
+static constexpr int ROS1_BATTERY_FRAME_SIZE = ROS1_FRAME(sensor_msgs::BatteryState::maxSerializedLength(ROS1_STRLEN(ROS1_FRAME_ID), 0, 0, 0, 0));
+static constexpr int ROS1_BATTERY_TOPIC_SIZE = ROS1_TOPIC_FRAME(ROS1_BATTERY_TOPIC, ROS1_BATTERY_TYPE);
+#else
+static constexpr int ROS1_BATTERY_FRAME_SIZE = 0;
+static constexpr int ROS1_BATTERY_TOPIC_SIZE = 0;
 #endif
+static constexpr int ROS1_TIME_FRAME_SIZE = ROS1_FRAME(std_msgs::Time::maxSerializedLength());
+
+// Holds the serialized topic negotiation that is replayed on every reconnect
+static constexpr int ROS1_NEGOTIATION_CACHE_SIZE = ROS1_TOPIC_FRAME(ROS1_JOY_TOPIC, ROS1_JOY_TYPE)
+    + ROS1_BATTERY_TOPIC_SIZE + ROS1_TOPIC_FRAME(ROS1_LED_TOPIC, ROS1_LED_TYPE);
+// Largest single frame sent
+static constexpr int ROS1_OUTPUT_SIZE = ros::maxLength(ROS1_JOY_FRAME_SIZE, ROS1_BATTERY_FRAME_SIZE, ROS1_TIME_FRAME_SIZE,
+    ROS1_TOPIC_FRAME(ROS1_JOY_TOPIC, ROS1_JOY_TYPE), ROS1_BATTERY_TOPIC_SIZE, ROS1_TOPIC_FRAME(ROS1_LED_TOPIC, ROS1_LED_TYPE));
+// Everything one ros1Run() cycle can send: the negotiation burst, a time request, Joy and battery
+static constexpr int ROS1_TX_BUFFER_SIZE = ROS1_NEGOTIATION_CACHE_SIZE + ROS1_TIME_FRAME_SIZE + ROS1_JOY_FRAME_SIZE + ROS1_BATTERY_FRAME_SIZE;
+// Time sync replies, the subscribed topics and the frames of a topic inspected at runtime
+// are received. getParam() is not used, larger frames are skipped and counted in "RX Skipped".
+static constexpr int ROS1_INPUT_SIZE = ros::maxLength(ros::MaxSerializedLength<std_msgs::Time, std_msgs::Empty>::value,
+    ROS1_INSPECT_INPUT_SIZE);
+
+static_assert(ROS1_NEGOTIATION_CACHE_SIZE <= ROS1_TX_BUFFER_SIZE, "The negotiation burst is queued as one frame");
+static_assert(ROS1_INPUT_SIZE >= std_msgs::Time::maxSerializedLength(), "Time sync replies must fit the input buffer");
+
+
+sensor_msgs::Joy ros1JoyMsg;
 
 #if BATTERY_PIN >= 0
 sensor_msgs::BatteryState ros1BatteryMsg;
-ros::Publisher ros1PublisherBattery(FST("remote_battery"), &ros1BatteryMsg);
 uint32_t ros1BatteryTs_ = 0;
 #ifndef ROS1_PUB_BATTERY_MS
 #define ROS1_PUB_BATTERY_MS 10000
 #endif
 #endif
 
-ros::Subscriber<std_msgs::Empty> ros1Subscriber1(FST("toggle_led"), &ros1Handler1);
+enum Ros1LinkState { ROS1_OFFLINE, ROS1_WAIT_RETRY, ROS1_CONNECTING, ROS1_SYNCING, ROS1_READY };
+enum Ros1Transport { ROS1_TCP, ROS1_UDP, ROS1_SERIAL };
+static const char* ROS1_STATE_NAMES[] = { "offline", "waiting", "connecting", "syncing", "ready" };
+static const char* ROS1_TRANSPORT_NAMES[] = { "tcp", "udp", "serial" };
+
+// One ROS master. Every target has its own connection and node handle, so the
+// standby ones stay negotiated and time synced and can take over at once.
+// Only the configured targets are created.
+struct Ros1Target {
+    uint8_t index = 0;
+    ros::NodeHandle_<Ros1Link, ROS1_MAX_SUBSCRIBERS, ROS1_MAX_PUBLISHERS, ROS1_INPUT_SIZE, ROS1_OUTPUT_SIZE, ROS1_TX_BUFFER_SIZE, ROS1_NEGOTIATION_CACHE_SIZE> node;
+    // Only seq, stamp, axes and buttons change, so the serialized frame is kept and patched
+    ros::FramePublisher<sensor_msgs::Joy, ROS1_JOY_FRAME_SIZE> publisherJoy{FST(ROS1_JOY_TOPIC), &ros1JoyMsg};
+#if BATTERY_PIN >= 0
+    ros::FramePublisher<sensor_msgs::BatteryState, ROS1_BATTERY_FRAME_SIZE> publisherBattery{FST(ROS1_BATTERY_TOPIC), &ros1BatteryMsg};
+#endif
+    ros::Subscriber<std_msgs::Empty> subscriber1{FST(ROS1_LED_TOPIC), &ros1Handler1};
+    WiFiClient wifiClient;
+    ros::UdpLink* udpLink = nullptr;  // Carries the frames instead of wifiClient when the transport is UDP, created on first use
+    Ros1Transport transport = ROS1_TCP;  // Transport of the current connection
+    Ros1LinkState state = ROS1_OFFLINE;
+    const char* status = nullptr;
+    int connectFd = -1;         // Socket of a connect in progress
+    uint32_t connectTs = 0;
+    uint32_t retryTs = 0;
+    uint32_t retryMs = ROS1_RETRY_MIN_MS;
+    uint32_t downTs = 0;        // When the link went down or WiFi came up
+    uint32_t attempts = 0;
+    uint32_t losses = 0;        // Ready links that went away
+    bool joyFailsafe = false;   // Publish a zeroed Joy before anything else after a link loss
+    uint32_t joySeq = 0;        // header.seq of the Joy messages this robot got
+    IPAddress hostIp;
+    bool hostResolved = false;
+};
+
+Ros1Target* ros1Targets_[ROS1_MAX_TARGETS] = { nullptr };  // nullptr = no host configured
+Ros1Target* ros1Active_ = nullptr;  // Gets the Joy messages
+int32_t ros1SwitchEncoder_ = 0;
+uint32_t ros1SwitchStartUs_ = 0;  // Sample time of the switch input until the new target got the Joy message
+uint32_t ros1HealthTs_ = 0;
+static char ros1Health_[ROS1_MAX_TARGETS][64];  // Shown by the "Target" states, not on the ROS task stack
+
+// The cable belongs to the first target
+ros::SerialLink ros1SerialLink;
+HardwareSerial ros1SerialPort(0);  // UART0 for the link, Serial is ended so console output is dropped
+uint32_t ros1SerialTs_ = 0;     // Last time the node was connected over the cable
 
-uint32_t ros1LastConnectTs_ = 0;
-bool ros1IsConnected_ = false;
-bool ros1IsAdvertised_ = false;
-bool ros1IsReady_ = false;
 uint32_t ros1Counter = 0;
 
 void rosTask_(void* parameter ) {
@@ -52,6 +205,59 @@ void rosTask_(void* parameter ) {
 }
 
 void rosInit() {
+    ros1JoyMsg.header.frame_id = FST(ROS1_FRAME_ID);
+    ros1JoyMsg.axes_length = JOY_AXIS_SIZE;
+    ros1JoyMsg.axes = joyPublishAxes;
+    ros1JoyMsg.buttons_length = JOY_BUTTON_SIZE;
+    ros1JoyMsg.buttons = joyPublishButtons;
+#if BATTERY_PIN >= 0
+    ros1BatteryMsg.header.frame_id = FST(ROS1_FRAME_ID);
+#endif
+    for (uint8_t i = 0; i < ROS1_MAX_TARGETS; i++) {
+        bool used = i == 0 || ros1TargetHosts_[i]->get()[0] != 0;
+        ros1TargetStates_[i]->set(used ? FST("offline") : FST("unused"));
+        if (!used) { continue; }
+        ros1Targets_[i] = new Ros1Target();
+        Ros1Target& t = *ros1Targets_[i];
+        t.index = i;
+        t.node.getHardware()->target = &t;
+        // Frames published in one ros1Run() cycle leave as one socket write
+        t.node.setTxBatching(true);
+
+        // The topic set is fixed, so it is registered once and the node handle
+        // replays the cached negotiation after every reconnect.
+        t.publisherJoy.bind(&ros1JoyMsg.header.seq);
+        t.publisherJoy.bind(&ros1JoyMsg.header.stamp);
+        t.publisherJoy.bind(joyPublishAxes, JOY_AXIS_SIZE);
+        t.publisherJoy.bind(joyPublishButtons, JOY_BUTTON_SIZE);
+        t.publisherJoy.setLatestOnly(true);
+        t.node.advertise(t.publisherJoy);
+        t.publisherJoy.rebuild();
+#if BATTERY_PIN >= 0
+        t.publisherBattery.bind(&ros1BatteryMsg.header.stamp);
+        t.publisherBattery.bind(&ros1BatteryMsg.voltage);
+        t.publisherBattery.bind(&ros1BatteryMsg.percentage);
+        t.publisherBattery.setLatestOnly(true);
+        t.node.advertise(t.publisherBattery);
+        t.publisherBattery.rebuild();
+#endif
+        t.node.subscribe(t.subscriber1);
+    }
+    ros1Active_ = ros1Targets_[0];
+    // Catches a type name that differs from the one the sizes were computed with
+    if (ros1Active_->node.getRequiredOutputSize() > ROS1_OUTPUT_SIZE) {
+        DEBUG_printf(FST("ROS1_OUTPUT_SIZE too small, topics need %d\n"), ros1Active_->node.getRequiredOutputSize());
+    }
+    if (configRos1SerialLink.get()) {
+        // Console output between the frames would corrupt them. Use telnet for the console.
+        DEBUG_printf(FST("ROS1 serial link at %d baud, console on UART0 is off\n"), configRos1SerialBaud.get());
+        Serial.flush();
+        Serial.end();
+        esp_log_level_set("*", ESP_LOG_NONE);
+        ros1SerialLink.begin(ros1SerialPort, configRos1SerialBaud.get());
+    }
+    ros1SwitchEncoder_ = joyButtons[L_JOY_BUTTON_ENC];
+
     xTaskCreate(
     rosTask_,   // Task function
     "ROS",          // String with name of task
@@ -61,91 +267,335 @@ void rosInit() {
     NULL);          // Task handle.
 }
 
-ros::Time ros1Time(uint32_t ms) {
-    ros::Time current_time;
-    current_time.sec = ms / 1000; // + sec_offset;
-    current_time.nsec = (ms % 1000) * 1000000UL; // + nsec_offset;
-    ros::normalizeSecNSec(current_time.sec, current_time.nsec);
-    return current_time;
+// ROS time synchronized with the host, microsecond resolution
+ros::Time ros1Now() {
+    return ros1Active_->node.now();
 }
 
-bool ros1CheckConnectionState() {
-    if (WiFi.status() != WL_CONNECTED) { 
-        ros1IsConnected_ = false;
-        ros1IsAdvertised_ = false;
-        ros1IsReady_ = false;
-        return false; 
+// Shows a connection status change once instead of on every retry.
+// The connection state shows the active target, the others only log.
+void ros1SetStatus_(Ros1Target& t, const char* status) {
+    if (status == t.status) { return; }
+    t.status = status;
+    if (&t == ros1Active_) {
+        DEBUG_println(stateRos1Connection.set(status));
+    } else {
+        DEBUG_printf(FST("%s: %s\n"), ros1TargetHosts_[t.index]->get(), status);
     }
-    uint32_t now = millis();
-    if (!ros1IsConnected_) {
-        if (ros1LastConnectTs_ != 0 && now < (ros1LastConnectTs_ + 1000)) { return false; }
-        if (ros1LastConnectTs_ == 0) { DEBUG_printf(FST("ROS1 Wifi host:%s, port:%d\n"), configRos1Host.get(), configRos1Port.get()); }
-        ros1LastConnectTs_ = now;
-        if (!ros1WifiClient.connect(configRos1Host.get(), configRos1Port.get())) {
-            DEBUG_println(stateRos1Connection.set(FST("Waiting for ROS1 connection")));
+}
+
+// Failsafe when a ready link goes away: alarm, and zero Joy as soon as it is back
+void ros1LinkLost_(Ros1Target& t, uint32_t now) {
+    t.losses++;
+    t.joyFailsafe = true;
+    t.downTs = now;
+    t.attempts = 0;
+    if (&t != ros1Active_) { return; }
+    stateRos1LossDetectMs.set(now - t.node.getLastRxTime());
+#if ENABLE_DISPLAY
+    displaySetAlarm(FST("ROS link lost"));
+#endif
+}
+
+// Drop the link and schedule the next attempt with exponential backoff.
+// The random jitter keeps several remotes from hammering a rebooted host in lockstep.
+void ros1ScheduleRetry_(Ros1Target& t, uint32_t now) {
+    if (t.connectFd >= 0) {
+        close(t.connectFd);
+        t.connectFd = -1;
+    }
+    t.wifiClient.stop();
+    if (t.udpLink) { t.udpLink->end(); }
+    uint32_t delayMs = t.retryMs / 2 + esp_random() % (t.retryMs / 2 + 1);
+    t.retryTs = now + delayMs;
+    t.retryMs = t.retryMs * 2 > ROS1_RETRY_MAX_MS ? ROS1_RETRY_MAX_MS : t.retryMs * 2;
+    t.state = ROS1_WAIT_RETRY;
+}
+
+// Start a TCP connect without waiting for it to complete. 1 = started, 0 = host
+// name lookup still in progress, -1 = failed right away.
+int ros1StartConnect_(Ros1Target& t, uint32_t now) {
+    const char* host = ros1TargetHosts_[t.index]->get();
+    if (!t.hostResolved) {
+        // The host is looked up once per WiFi session, in the background
+        int res = hostLookup(host, t.hostIp);
+        if (res <= 0) { return res; }
+        t.hostResolved = true;
+        DEBUG_printf(FST("ROS1 Wifi host:%s, port:%d\n"), host, configRos1Port.get());
+    }
+    t.transport = configRos1Transport.get() == 1 ? ROS1_UDP : ROS1_TCP;
+    if (t.transport == ROS1_UDP) {
+        // Nothing to connect, the link is up once the socket is open. Every target needs a local port of its own.
+        if (!t.udpLink) { t.udpLink = new ros::UdpLink(); }
+        if (!t.udpLink->begin((uint32_t) t.hostIp, configRos1Port.get(), configRos1UdpPort.get() + t.index)) { return -1; }
+        t.connectTs = now;
+        t.attempts++;
+        t.state = ROS1_CONNECTING;
+        return 1;
+    }
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) { return -1; }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(configRos1Port.get());
+    addr.sin_addr.s_addr = (uint32_t) t.hostIp;
+    if (connect(fd, (struct sockaddr*) &addr, sizeof(addr)) < 0 && errno != EINPROGRESS) {
+        close(fd);
+        return -1;
+    }
+    t.connectFd = fd;
+    t.connectTs = now;
+    t.attempts++;
+    t.state = ROS1_CONNECTING;
+    return 1;
+}
+
+// Check a pending connect. 1 = connected, 0 = still in progress, -1 = failed
+int ros1PollConnect_(Ros1Target& t) {
+    if (t.transport == ROS1_UDP) { return 1; }
+    fd_set wfds;
+    FD_ZERO(&wfds);
+    FD_SET(t.connectFd, &wfds);
+    struct timeval tv = { 0, 0 };
+    int res = select(t.connectFd + 1, NULL, &wfds, NULL, &tv);
+    if (res == 0) { return 0; }
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (res < 0 || getsockopt(t.connectFd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) { return -1; }
+    // WiFiClient expects a blocking socket, like the ones it connects itself
+    fcntl(t.connectFd, F_SETFL, fcntl(t.connectFd, F_GETFL, 0) & ~O_NONBLOCK);
+    t.wifiClient = WiFiClient(t.connectFd);
+    t.connectFd = -1;
+    return 1;
+}
+
+// TCP connection still up, or UDP socket or serial port open
+bool ros1LinkUp_(Ros1Target& t) {
+    switch (t.transport) {
+    case ROS1_UDP: return t.udpLink->isOpen();
+    case ROS1_SERIAL: return ros1SerialLink.isOpen();
+    default: return t.wifiClient.connected();
+    }
+}
+
+// Prefers the cable: a host talking on UART0 takes over from WiFi, and WiFi
+// is used again once the node was not connected over the cable for a while.
+void ros1SelectLink_(Ros1Target& t, uint32_t now) {
+    if (!ros1SerialLink.isOpen()) { return; }
+    if (t.transport != ROS1_SERIAL) {
+        if (!ros1SerialLink.probe()) { return; }
+        if (t.state == ROS1_READY) { ros1LinkLost_(t, now); }
+        ros1ScheduleRetry_(t, now);  // Closes the WiFi link
+        t.transport = ROS1_SERIAL;
+        ros1SerialTs_ = now;
+        ros1SetStatus_(t, FST("ROS1 serial host found"));
+        t.node.initNode();
+        t.node.setLiveness(configRos1LivenessMs.get(), configRos1LivenessMs.get() / 3);
+        t.state = ROS1_SYNCING;
+        return;
+    }
+    if (t.node.connected()) {
+        ros1SerialTs_ = now;
+        return;
+    }
+    if ((now - ros1SerialTs_) < ROS1_SERIAL_FALLBACK_MS) { return; }
+    ros1SetStatus_(t, FST("ROS1 serial host gone"));
+    t.transport = ROS1_TCP;
+    t.state = ROS1_OFFLINE;
+}
+
+// Advances the connection state machine of a target. Never blocks, returns true when its node is ready.
+bool ros1CheckConnectionState(Ros1Target& t, uint32_t now) {
+    if (t.index == 0) { ros1SelectLink_(t, now); }
+    if (t.transport != ROS1_SERIAL && WiFi.status() != WL_CONNECTED) {
+        if (t.state == ROS1_READY) { ros1LinkLost_(t, now); }
+        if (t.state != ROS1_OFFLINE) {
+            ros1ScheduleRetry_(t, now);
+            t.state = ROS1_OFFLINE;
+            ros1SetStatus_(t, FST("Waiting for WiFi"));
+        }
+        return false;
+    }
+    switch (t.state) {
+    case ROS1_OFFLINE:
+        // WiFi just came up: try right away and look up the host again
+        t.hostResolved = false;
+        t.retryMs = ROS1_RETRY_MIN_MS;
+        t.retryTs = now;
+        t.downTs = now;
+        t.attempts = 0;
+        t.state = ROS1_WAIT_RETRY;
+        // fall through
+    case ROS1_WAIT_RETRY:
+        if ((int32_t)(now - t.retryTs) < 0) { return false; }
+        if (ros1StartConnect_(t, now) < 0) {
+            ros1SetStatus_(t, FST("Waiting for ROS1 connection"));
+            ros1ScheduleRetry_(t, now);
+        }
+        return false;
+    case ROS1_CONNECTING: {
+        int res = ros1PollConnect_(t);
+        if (res == 0 && (now - t.connectTs) < ROS1_CONNECT_TIMEOUT_MS) { return false; }
+        if (res <= 0) {
+            ros1SetStatus_(t, FST("Waiting for ROS1 connection"));
+            ros1ScheduleRetry_(t, now);
             return false;
         }
-        DEBUG_println(stateRos1Connection.set(FST("ROS1 WIFI client connected")));
-        ros1Node.initNode();
-        ros1IsConnected_ = true;
-    }
-    if (!ros1WifiClient.connected()) {
-        DEBUG_println(stateRos1Connection.set(FST("Lost ROS1 WIFI client connection")));
-        ros1IsConnected_ = false;
-        ros1IsAdvertised_ = false;
-        ros1IsReady_ = false;
-        return false; 
-    }
-    if (!ros1IsAdvertised_) {
-        ros1JoyMsg.header.frame_id = FST("remote");
-        ros1JoyMsg.axes_length = JOY_AXIS_SIZE;
-        ros1JoyMsg.axes = joyAxes;
-        ros1JoyMsg.buttons_length = JOY_BUTTON_SIZE;
-        ros1JoyMsg.buttons = joyButtons;
-        ros1Node.advertise(ros1PublisherJoy);
-#if BATTERY_PIN >= 0
-        ros1BatteryMsg.header.frame_id = FST("remote");
-        ros1Node.advertise(ros1PublisherBattery);
-#endif
-        ros1Node.subscribe(ros1Subscriber1);
-        DEBUG_println(stateRos1Connection.set(FST("ROS1 node is advertised")));
-        ros1IsAdvertised_ = true;
-    }
-    if (ros1IsReady_) {
-        if (ros1Node.connected()) { return true; }
-        DEBUG_println(stateRos1Connection.set(FST("Lost ROS1 node connection")));
-        ros1IsAdvertised_ = false;
-        ros1IsReady_ = false;
+        if (t.transport == ROS1_UDP) {
+            ros1SetStatus_(t, FST("ROS1 UDP link open"));
+        } else {
+            ros1SetStatus_(t, FST("ROS1 WIFI client connected"));
+            t.wifiClient.setNoDelay(true); // Frames are already coalesced by the node handle
+        }
+        t.node.initNode();
+        t.node.setLiveness(configRos1LivenessMs.get(), configRos1LivenessMs.get() / 3);
+        t.state = ROS1_SYNCING;
         return false;
     }
-    if (ros1Node.connected()) {
-        DEBUG_println(stateRos1Connection.set(FST("ROS1 node is ready")));
-        ros1IsReady_ = true;
-        return true;
+    case ROS1_SYNCING:
+        if (!ros1LinkUp_(t)) {
+            ros1SetStatus_(t, FST("Lost ROS1 WIFI client connection"));
+            ros1ScheduleRetry_(t, now);
+            return false;
+        }
+        if (t.node.connected()) {
+            ros1SetStatus_(t, FST("ROS1 node is ready"));
+            if (&t == ros1Active_) {
+                stateRos1ReconnectMs.set(now - t.downTs);
+                stateRos1ConnectAttempts.set(t.attempts);
+#if ENABLE_DISPLAY
+                displaySetAlarm(nullptr);
+#endif
+            }
+            t.state = ROS1_READY;
+            return true;
+        }
+        t.node.spinOnce();
+        return false;
+    case ROS1_READY:
+        if (ros1LinkUp_(t) && t.node.connected()) { return true; }
+        ros1LinkLost_(t, now);
+        if (!ros1LinkUp_(t)) {
+            ros1SetStatus_(t, FST("Lost ROS1 WIFI client connection"));
+            ros1ScheduleRetry_(t, now);
+            // A lost link is retried at once, the backoff only grows if that fails
+            t.retryTs = now;
+            t.retryMs = ROS1_RETRY_MIN_MS;
+        } else {
+            ros1SetStatus_(t, FST("Lost ROS1 node connection"));
+            t.state = ROS1_SYNCING;
+        }
+        return false;
     }
-    ros1Node.spinOnce();
     return false;
 }
 
+// Shows state, transport, time sync round trip and lost links of every target
+void ros1UpdateHealth_(uint32_t now) {
+    if ((now - ros1HealthTs_) < ROS1_HEALTH_UPDATE_MS) { return; }
+    ros1HealthTs_ = now;
+    for (uint8_t i = 0; i < ROS1_MAX_TARGETS; i++) {
+        if (!ros1Targets_[i]) { continue; }
+        Ros1Target& t = *ros1Targets_[i];
+        snprintf(ros1Health_[i], sizeof(ros1Health_[i]), FST("%s%s %s rtt:%uus lost:%u"), &t == ros1Active_ ? FST("active ") : FST(""),
+            ROS1_STATE_NAMES[t.state], ROS1_TRANSPORT_NAMES[t.transport], t.node.getSyncRtt(), t.losses);
+        ros1TargetStates_[i]->set(ros1Health_[i]);
+    }
+}
+
+// Make a robot that is not the active one stop: send it a zeroed Joy
+void ros1PublishZeroJoy_(Ros1Target& t, const ros::Time& stamp) {
+    joyPublishZero();
+    ros1JoyMsg.header.seq = ++t.joySeq;
+    ros1JoyMsg.header.stamp = stamp;
+    t.publisherJoy.publish();
+}
+
+// Holding the left encoder button and turning the left encoder selects the
+// next or previous target. The robot left behind gets a zeroed Joy, the new
+// one the current inputs right away. The turns are not passed on in the Joy.
+void ros1SwitchTarget_(uint32_t now) {
+    int32_t encoder = joyButtons[L_JOY_BUTTON_ENC];
+    int32_t steps = encoder - ros1SwitchEncoder_;
+    ros1SwitchEncoder_ = encoder;
+    if (steps == 0 || !joyButtons[L_JOY_BUTTON_ENCB]) { return; }
+    joyPublishHideTurns(steps);
+    uint8_t index = ros1Active_->index;
+    do {
+        index = (index + (steps > 0 ? 1 : ROS1_MAX_TARGETS - 1)) % ROS1_MAX_TARGETS;
+    } while (!ros1Targets_[index]);
+    Ros1Target& next = *ros1Targets_[index];
+    if (&next == ros1Active_) { return; }
+    Ros1Target& old = *ros1Active_;
+    if (old.state == ROS1_READY) {
+        ros1PublishZeroJoy_(old, ros1Now());
+        old.node.spinOnce();
+    } else {
+        old.joyFailsafe = true;  // Once it is back
+    }
+    ros1Active_ = &next;
+    joyPublishForce(now);  // Publish in this cycle
+    ros1SwitchStartUs_ = next.state == ROS1_READY ? joyButtonsSampleUs : 0;
+    stateRos1ActiveTarget.set(index + 1);
+    DEBUG_printf(FST("ROS1 active target %d: %s\n"), index + 1, ros1TargetHosts_[index]->get());
+    if (next.status) { stateRos1Connection.set(next.status); }
+#if ENABLE_DISPLAY
+    displaySetAlarm(next.state == ROS1_READY ? nullptr : FST("ROS target not ready"));
+#endif
+}
+
 void ros1Run() {
-    if (!ros1CheckConnectionState()) { return; }
     uint32_t now = millis();
-    ros::Time rosNow = ros1Time(now);
-    if ((now - ros1JoyTs_) >= ROS1_PUB_JOY_MS) {
+    for (uint8_t i = 0; i < ROS1_MAX_TARGETS; i++) {
+        if (!ros1Targets_[i]) { continue; }
+        Ros1Target& t = *ros1Targets_[i];
+        // Standby targets only keep their time sync and liveness going
+        if (!ros1CheckConnectionState(t, now) || &t == ros1Active_) { continue; }
+        if (t.joyFailsafe) {
+            ros1PublishZeroJoy_(t, t.node.now());
+            t.joyFailsafe = false;
+        }
+        t.node.spinOnce();
+    }
+    ros1UpdateHealth_(now);
+    ros1SwitchTarget_(now);
+    Ros1Target& t = *ros1Active_;
+    if (t.state != ROS1_READY) { return; }
+    ros::Time rosNow = ros1Now();
+    JoyPublishReason reason = joyPublishPoll(now, t.joyFailsafe);
+    if (reason != JOY_PUBLISH_NONE) {
+        ros1JoyMsg.header.seq = ++t.joySeq;
         ros1JoyMsg.header.stamp = rosNow;
-        ros1PublisherJoy.publish(&ros1JoyMsg);
-        ros1JoyTs_ = now;
+        t.publisherJoy.publish();
+        if (reason == JOY_PUBLISH_CHANGED) { latencyTraceQueued(); }
+        joyPublishSent(now, reason);
+        t.joyFailsafe = false;
     }
 #if BATTERY_PIN >= 0
     if ((now - ros1BatteryTs_) >= ROS1_PUB_BATTERY_MS) {
         ros1BatteryMsg.header.stamp = rosNow;
         ros1BatteryMsg.voltage = batteryVoltageFiltered;
         ros1BatteryMsg.percentage = (float) batteryChargeLevel;
-        ros1PublisherBattery.publish(&ros1BatteryMsg);
+        // The remote's battery is of interest to every robot
+        for (uint8_t i = 0; i < ROS1_MAX_TARGETS; i++) {
+            if (ros1Targets_[i] && ros1Targets_[i]->state == ROS1_READY) { ros1Targets_[i]->publisherBattery.publish(); }
+        }
         ros1BatteryTs_ = now;
     }
-#endif    
-    ros1Node.spinOnce();
+#endif
+    t.node.spinOnce();
+    if (ros1SwitchStartUs_) {
+        stateRos1SwitchUs.set(micros() - ros1SwitchStartUs_);
+        ros1SwitchStartUs_ = 0;
+    }
+    if (stateRos1TxDropped.get() != t.node.getTxDropped()) { stateRos1TxDropped.set(t.node.getTxDropped()); }
+    if (stateRos1RxSkipped.get() != t.node.getRxSkipped()) { stateRos1RxSkipped.set(t.node.getRxSkipped()); }
+    if (stateRos1TxReplaced.get() != t.node.getTxReplaced()) { stateRos1TxReplaced.set(t.node.getTxReplaced()); }
+    if (stateRos1SyncRtt.get() != t.node.getSyncRtt()) { stateRos1SyncRtt.set(t.node.getSyncRtt()); }
+    if (stateRos1ClockDrift.get() != t.node.getClockDrift()) { stateRos1ClockDrift.set(t.node.getClockDrift()); }
+    latencyTraceRun(now);
 }
 
 void ros1Handler1(const std_msgs::Empty& toggle_msg) {
@@ -153,19 +603,60 @@ void ros1Handler1(const std_msgs::Empty& toggle_msg) {
     digitalWrite(LED_PIN, !digitalRead(LED_PIN));   // blink the led
 }
 
-void Ros1WiFiLink::init() {
+void Ros1Link::init() {
     // do your initialization here. this probably includes TCP server/client setup
 }
 
 // read a byte from the serial port. -1 = failure
-int Ros1WiFiLink::read() {
+int Ros1Link::read() {
     // implement this method so that it reads a byte from the TCP connection and returns it
     // you may return -1 is there is an error; for example if the TCP connection is not open
-    return ros1WifiClient.read(); //will return -1 when it will works
+    if (target->transport == ROS1_UDP) { return target->udpLink->read(); }
+    if (target->transport == ROS1_SERIAL) { return ros1SerialLink.read(); }
+    return target->wifiClient.read(); //will return -1 when it will works
+}
+
+// read up to length bytes that are already buffered. <= 0 = nothing available
+int Ros1Link::read(uint8_t* data, size_t length) {
+    if (target->transport == ROS1_UDP) { return target->udpLink->read(data, length); }
+    if (target->transport == ROS1_SERIAL) { return ros1SerialLink.read(data, length); }
+    return target->wifiClient.read(data, length);
 }
 
 // write data to the connection to ROS
-void Ros1WiFiLink::write(uint8_t* data, int length) {
+void Ros1Link::write(uint8_t* data, int length) {
     // implement this so that it takes the arguments and writes or prints them to the TCP connection
-    ros1WifiClient.write(data, length);
+    if (target->transport == ROS1_UDP) {
+        // every frame is a datagram of its own
+        target->udpLink->write(data, length);
+    } else if (target->transport == ROS1_SERIAL) {
+        // blocks until the UART took the whole batch
+        ros1SerialLink.write(data, length);
+    } else {
+        target->wifiClient.write(data, length);
+    }
+    // Only the active target carries the traced Joy message
+    if (target == ros1Active_) { latencyTraceWritten(); }
 }
+
+// write as much as the socket takes without blocking. Returns bytes written, < 0 on error
+int Ros1Link::writeSome(const uint8_t* data, int length) {
+    int res;
+    if (target->transport == ROS1_UDP) {
+        // Datagrams are never partially sent, the network stack queues or drops them
+        target->udpLink->write((uint8_t*) data, length);
+        res = length;
+    } else if (target->transport == ROS1_SERIAL) {
+        // Only what fits into the UART TX FIFO and ring buffer
+        res = ros1SerialLink.writeSome(data, length);
+    } else {
+        int fd = target->wifiClient.fd();
+        if (fd < 0) { return -1; }
+        res = send(fd, data, length, MSG_DONTWAIT);
+        if (res < 0) { return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1; }
+    }
+    if (res == length && target == ros1Active_) { latencyTraceWritten(); }
+    return res;
+}
+
+#endif  // ROS_VERSION != 2 && ROS_VERSION != 3
@@ -0,0 +1,284 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <xrce/cdr.h>
+
+#include "Config.h"
+#include "VUEF.h"
+#include "ROS2.h"
+#include "Battery.h"
+#include "LatencyTrace.h"
+#include "HostLookup.h"
+#include "JoyPublish.h"
+#if ENABLE_DISPLAY
+#include "Display.h"
+#endif
+
+#if ROS_VERSION == 2
+
+#ifndef ROS2_DOMAIN
+#define ROS2_DOMAIN 0
+#endif
+// The session pings every 100 ms. An agent that answered nothing for this long is considered gone.
+#ifndef ROS2_LIVENESS_MS
+#define ROS2_LIVENESS_MS 300
+#endif
+// Identifies the session on the agent. 0 = derived from the MAC address.
+#ifndef ROS2_CLIENT_KEY
+#define ROS2_CLIENT_KEY 0
+#endif
+// Pause between attempts to find the agent host
+#ifndef ROS2_RETRY_MS
+#define ROS2_RETRY_MS 500
+#endif
+
+RegGroup configGroupRos2(FST("ROS2"));
+
+ConfigStr configRos2AgentHost(FST("Agent Host"), 32, ROS2_AGENT_HOST, FST("Micro XRCE-DDS agent (udp4)"), 0, &configGroupRos2);
+ConfigUInt16 configRos2AgentPort(FST("Agent Port"), ROS2_AGENT_PORT, FST("Agent UDP port number"), 0, &configGroupRos2);
+ConfigUInt16 configRos2Domain(FST("Domain"), ROS2_DOMAIN, FST("ROS_DOMAIN_ID of the topics. Needs a reconnect"), 0, &configGroupRos2);
+ConfigUInt16 configRos2LivenessMs(FST("Liveness Timeout"), ROS2_LIVENESS_MS, FST("ms without an answer from the agent until the session is lost"), 0, &configGroupRos2);
+StateStr stateRos2Connection(FST("Connection"), FST("Not connected"), FST("ROS2 connection state"), 0, &configGroupRos2);
+StateUInt32 stateRos2SyncRtt(FST("Sync RTT"), 0, FST("Round trip of the last accepted time sync in us"), 0, &configGroupRos2);
+StateUInt32 stateRos2ReconnectMs(FST("Reconnect Time"), 0, FST("ms from losing the session until the entities were created again"), 0, &configGroupRos2);
+StateUInt32 stateRos2Failed(FST("Failed Requests"), 0, FST("Entities the agent refused to create"), 0, &configGroupRos2);
+
+
+// Object numbers of the entities on the agent
+enum Ros2Entity { ROS2_PARTICIPANT = 1, ROS2_PUBLISHER = 1, ROS2_TOPIC_JOY = 1, ROS2_WRITER_JOY = 1, ROS2_TOPIC_BATTERY = 2, ROS2_WRITER_BATTERY = 2 };
+
+// Joy is sent best-effort, a lost one is replaced by the next. The battery
+// state is rare and goes over the reliable stream like the entity setup.
+static const char* ROS2_ENTITY_XML[] = {
+    "<dds><participant><rtps><name>ros_remote</name></rtps></participant></dds>",
+    "<dds><topic><name>rt/remote_joy</name><dataType>sensor_msgs::msg::dds_::Joy_</dataType></topic></dds>",
+    "<dds><publisher/></dds>",
+    "<dds><data_writer><topic><kind>NO_KEY</kind><name>rt/remote_joy</name><dataType>sensor_msgs::msg::dds_::Joy_</dataType></topic>"
+        "<qos><reliability><kind>BEST_EFFORT</kind></reliability></qos></data_writer></dds>",
+#if BATTERY_PIN >= 0
+    "<dds><topic><name>rt/remote_battery</name><dataType>sensor_msgs::msg::dds_::BatteryState_</dataType></topic></dds>",
+    "<dds><data_writer><topic><kind>NO_KEY</kind><name>rt/remote_battery</name><dataType>sensor_msgs::msg::dds_::BatteryState_</dataType></topic>"
+        "<qos><reliability><kind>RELIABLE</kind></reliability></qos></data_writer></dds>",
+#endif
+};
+#define ROS2_ENTITY_COUNT (sizeof(ROS2_ENTITY_XML) / sizeof(ROS2_ENTITY_XML[0]))
+
+enum Ros2State { ROS2_OFFLINE, ROS2_CONNECTING, ROS2_CREATING, ROS2_READY };
+
+// Large buffers are global, the ROS task has a small stack
+xrce::UdpTransport ros2Transport;
+xrce::Session<xrce::UdpTransport> ros2Session(ros2Transport, ROS2_CLIENT_KEY);
+Ros2State ros2State_ = ROS2_OFFLINE;
+const char* ros2Status_ = nullptr;
+uint8_t ros2Created_ = 0;       // Entities requested so far
+int ros2LastRequest_ = -1;
+uint32_t ros2DownTs_ = 0;       // When the session went down or WiFi came up
+uint32_t ros2RetryTs_ = 0;
+bool ros2JoyFailsafe_ = false;  // Publish a zeroed Joy before anything else after a session loss
+
+#if BATTERY_PIN >= 0
+uint32_t ros2BatteryTs_ = 0;
+#ifndef ROS2_PUB_BATTERY_MS
+#define ROS2_PUB_BATTERY_MS 10000
+#endif
+#endif
+
+
+void rosTask_(void* parameter ) {
+    while (true) {
+        ros2Run();
+        vTaskDelay(1);
+    }
+}
+
+void rosInit() {
+    // Every remote needs a session of its own on a shared agent
+    if (ROS2_CLIENT_KEY == 0) { ros2Session.setClientKey((uint32_t) (ESP.getEfuseMac() >> 16)); }
+    xTaskCreate(
+    rosTask_,   // Task function
+    "ROS",          // String with name of task
+    2048,           // Stack size in bytes
+    NULL,           // Parameter passed as input of the task
+    1,              // Priority of the task.
+    NULL);          // Task handle.
+}
+
+int64_t ros2NowNs() {
+    return ros2Session.agentTimeNs(esp_timer_get_time());
+}
+
+// Shows a connection status change once instead of on every retry
+void ros2SetStatus_(const char* status) {
+    if (status == ros2Status_) { return; }
+    ros2Status_ = status;
+    DEBUG_println(stateRos2Connection.set(status));
+}
+
+// Start over with a new session. The entities are created again with replace,
+// so whatever the agent still holds from before does not get in the way.
+// 1 = started, 0 = host name lookup still in progress, -1 = failed.
+int ros2Begin_(uint64_t nowUs) {
+    IPAddress ip;
+    const char* host = configRos2AgentHost.get();
+    int res = hostLookup(host, ip);
+    if (res <= 0) { return res; }
+    if (!ros2Transport.begin((uint32_t) ip, configRos2AgentPort.get())) { return -1; }
+    DEBUG_printf(FST("ROS2 agent host:%s, port:%d\n"), host, configRos2AgentPort.get());
+    ros2Session.begin(nowUs);
+    ros2Created_ = 0;
+    ros2LastRequest_ = -1;
+    ros2State_ = ROS2_CONNECTING;
+    return 1;
+}
+
+// Failsafe when a ready session goes away: alarm, and zero Joy as soon as it is back
+void ros2SessionLost_(uint32_t now) {
+    ros2JoyFailsafe_ = true;
+    ros2DownTs_ = now;
+#if ENABLE_DISPLAY
+    displaySetAlarm(FST("ROS link lost"));
+#endif
+}
+
+// Request the next entity. The reliable window takes a few at a time.
+void ros2CreateEntities_() {
+    while (ros2Created_ < ROS2_ENTITY_COUNT) {
+        const char* xml = ROS2_ENTITY_XML[ros2Created_];
+        int request;
+        switch (ros2Created_) {
+        case 0: request = ros2Session.createParticipant(ROS2_PARTICIPANT, configRos2Domain.get(), xml); break;
+        case 1: request = ros2Session.createTopic(ROS2_TOPIC_JOY, ROS2_PARTICIPANT, xml); break;
+        case 2: request = ros2Session.createPublisher(ROS2_PUBLISHER, ROS2_PARTICIPANT, xml); break;
+        case 3: request = ros2Session.createDataWriter(ROS2_WRITER_JOY, ROS2_PUBLISHER, xml); break;
+        case 4: request = ros2Session.createTopic(ROS2_TOPIC_BATTERY, ROS2_PARTICIPANT, xml); break;
+        default: request = ros2Session.createDataWriter(ROS2_WRITER_BATTERY, ROS2_PUBLISHER, xml); break;
+        }
+        if (request < 0) { return; }
+        ros2LastRequest_ = request;
+        ros2Created_++;
+    }
+}
+
+// Advances the session state machine. Never blocks, returns true when the entities are ready.
+bool ros2CheckConnectionState(uint32_t now, uint64_t nowUs) {
+    if (WiFi.status() != WL_CONNECTED) {
+        if (ros2State_ == ROS2_READY) { ros2SessionLost_(now); }
+        ros2Transport.end();
+        ros2State_ = ROS2_OFFLINE;
+        ros2DownTs_ = now;
+        ros2RetryTs_ = now;
+        ros2SetStatus_(FST("Waiting for WiFi"));
+        return false;
+    }
+    // Until the agent answered, the session repeats CREATE_CLIENT by itself
+    bool answered = ros2State_ == ROS2_CREATING || ros2State_ == ROS2_READY;
+    if (answered && (nowUs - ros2Session.lastHeard()) > configRos2LivenessMs.get() * 1000ULL) {
+        ros2SetStatus_(FST("Lost ROS2 agent"));
+        if (ros2State_ == ROS2_READY) { ros2SessionLost_(now); }
+        ros2State_ = ROS2_OFFLINE;  // New session right away
+        return false;
+    }
+    switch (ros2State_) {
+    case ROS2_OFFLINE:
+        if ((int32_t)(now - ros2RetryTs_) < 0) { return false; }
+        if (ros2Begin_(nowUs) < 0) {
+            ros2SetStatus_(FST("ROS2 agent host not found"));
+            ros2RetryTs_ = now + ROS2_RETRY_MS;
+        }
+        return false;
+    case ROS2_CONNECTING:
+        if (!ros2Session.connected()) {
+            ros2SetStatus_(FST("Waiting for ROS2 agent"));
+            return false;
+        }
+        ros2SetStatus_(FST("ROS2 session created"));
+        ros2State_ = ROS2_CREATING;
+        // fall through
+    case ROS2_CREATING:
+        ros2CreateEntities_();
+        if (ros2Created_ < ROS2_ENTITY_COUNT || !ros2Session.replied(ros2LastRequest_)) { return false; }
+        stateRos2Failed.set(ros2Session.failed());
+        if (ros2Session.failed()) {
+            ros2SetStatus_(FST("ROS2 agent refused the entities"));
+            return false;
+        }
+        ros2SetStatus_(FST("ROS2 node is ready"));
+        stateRos2ReconnectMs.set(now - ros2DownTs_);
+#if ENABLE_DISPLAY
+        displaySetAlarm(nullptr);
+#endif
+        ros2State_ = ROS2_READY;
+        return true;
+    case ROS2_READY:
+        return true;
+    }
+    return false;
+}
+
+// sensor_msgs/msg/Joy serialized straight into the outgoing datagram
+bool ros2PublishJoy_(int64_t stampNs) {
+    int size;
+    uint8_t* sample = ros2Session.prepareWrite(ROS2_WRITER_JOY, &size);
+    xrce::CdrWriter cdr(sample, size);
+    cdr.writeInt32(stampNs / 1000000000);
+    cdr.write32(stampNs % 1000000000);
+    cdr.writeString(FST("remote"));
+    cdr.writeSequence(joyPublishAxes, JOY_AXIS_SIZE);
+    cdr.writeSequence(joyPublishButtons, JOY_BUTTON_SIZE);
+    return !cdr.error() && ros2Session.commitWrite(cdr.length());
+}
+
+#if BATTERY_PIN >= 0
+// sensor_msgs/msg/BatteryState with what the remote knows, the rest NaN or unknown.
+// False while the reliable window is full.
+bool ros2PublishBattery_(int64_t stampNs) {
+    uint8_t sample[96];
+    xrce::CdrWriter cdr(sample, sizeof(sample));
+    cdr.writeInt32(stampNs / 1000000000);
+    cdr.write32(stampNs % 1000000000);
+    cdr.writeString(FST("remote"));
+    cdr.writeFloat(batteryVoltageFiltered);
+    cdr.writeFloat(NAN);    // temperature
+    cdr.writeFloat(NAN);    // current
+    cdr.writeFloat(NAN);    // charge
+    cdr.writeFloat(NAN);    // capacity
+    cdr.writeFloat(NAN);    // design_capacity
+    cdr.writeFloat((float) batteryChargeLevel);
+    cdr.write8(0);          // power_supply_status unknown
+    cdr.write8(0);          // power_supply_health unknown
+    cdr.write8(2);          // power_supply_technology LION
+    cdr.write8(1);          // present
+    cdr.write32(0);         // cell_voltage
+    cdr.write32(0);         // cell_temperature
+    cdr.writeString(FST(""));
+    cdr.writeString(FST(""));
+    return !cdr.error() && ros2Session.writeReliable(ROS2_WRITER_BATTERY, sample, cdr.length());
+}
+#endif
+
+void ros2Run() {
+    uint32_t now = millis();
+    uint64_t nowUs = esp_timer_get_time();
+    ros2Session.run(nowUs);
+    if (!ros2CheckConnectionState(now, nowUs)) { return; }
+    int64_t stampNs = ros2Session.agentTimeNs(nowUs);
+    JoyPublishReason reason = joyPublishPoll(now, ros2JoyFailsafe_);
+    if (reason != JOY_PUBLISH_NONE) {
+        // One datagram per sample, it is on its way once this returns
+        if (ros2PublishJoy_(stampNs) && reason == JOY_PUBLISH_CHANGED) {
+            latencyTraceQueued();
+            latencyTraceWritten();
+        }
+        joyPublishSent(now, reason);
+        ros2JoyFailsafe_ = false;
+    }
+#if BATTERY_PIN >= 0
+    if ((now - ros2BatteryTs_) >= ROS2_PUB_BATTERY_MS && ros2PublishBattery_(stampNs)) {
+        ros2BatteryTs_ = now;
+    }
+#endif
+    if (stateRos2SyncRtt.get() != ros2Session.syncRtt()) { stateRos2SyncRtt.set(ros2Session.syncRtt()); }
+    latencyTraceRun(now);
+}
+
+#endif  // ROS_VERSION == 2
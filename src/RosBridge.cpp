@@ -0,0 +1,470 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <sys/time.h>
+#include <rosbridge/cbor.h>
+#include <rosbridge/json.h>
+
+#include "Config.h"
+#include "VUEF.h"
+#include "RosBridge.h"
+#include "Battery.h"
+#include "HostLookup.h"
+#include "JoyPublish.h"
+#include "LatencyTrace.h"
+#if ENABLE_DISPLAY
+#include "Display.h"
+#endif
+
+#if ROS_VERSION == 3
+
+#ifndef ROS_BRIDGE_PATH
+#define ROS_BRIDGE_PATH "/"
+#endif
+// 0 = CBOR in binary frames, 1 = JSON in text frames. The stock rosbridge_server only decodes JSON from clients.
+#ifndef ROS_BRIDGE_ENCODING
+#define ROS_BRIDGE_ENCODING 1
+#endif
+// 1 = the server runs ROS2: type names and stamp fields differ
+#ifndef ROS_BRIDGE_ROS2
+#define ROS_BRIDGE_ROS2 0
+#endif
+#ifndef ROS_BRIDGE_CONNECT_TIMEOUT_MS
+#define ROS_BRIDGE_CONNECT_TIMEOUT_MS 1000
+#endif
+#ifndef ROS_BRIDGE_RETRY_MS
+#define ROS_BRIDGE_RETRY_MS 500
+#endif
+// A server that sent nothing for this long is considered dead. Pinged after a third of it.
+#ifndef ROS_BRIDGE_LIVENESS_MS
+#define ROS_BRIDGE_LIVENESS_MS 1000
+#endif
+#ifndef ROS_BRIDGE_TX_SIZE
+#define ROS_BRIDGE_TX_SIZE 512
+#endif
+// Nothing is subscribed, only pings and the odd status message come in
+#ifndef ROS_BRIDGE_RX_SIZE
+#define ROS_BRIDGE_RX_SIZE 256
+#endif
+// The ROS time is asked from rosapi this often, and again after a reconnect
+#ifndef ROS_BRIDGE_TIME_SYNC_MS
+#define ROS_BRIDGE_TIME_SYNC_MS 10000
+#endif
+
+RegGroup configGroupRosBridge(FST("ROS Bridge"));
+
+ConfigStr configRosBridgeHost(FST("Host"), 32, ROS_BRIDGE_HOST, FST("rosbridge server"), 0, &configGroupRosBridge);
+ConfigUInt16 configRosBridgePort(FST("Port"), ROS_BRIDGE_PORT, FST("rosbridge WebSocket port number"), 0, &configGroupRosBridge);
+ConfigStr configRosBridgePath(FST("Path"), 32, ROS_BRIDGE_PATH, FST("WebSocket path on the server"), 0, &configGroupRosBridge);
+ConfigUInt8 configRosBridgeEncoding(FST("Encoding"), ROS_BRIDGE_ENCODING, FST("0 = CBOR binary frames, 1 = JSON text frames"), 0, &configGroupRosBridge);
+ConfigUInt8 configRosBridgeRos2(FST("ROS2"), ROS_BRIDGE_ROS2, FST("1 = the server runs ROS2"), 0, &configGroupRosBridge);
+ConfigUInt16 configRosBridgeLivenessMs(FST("Liveness Timeout"), ROS_BRIDGE_LIVENESS_MS, FST("ms without data from the server until the connection is lost"), 0, &configGroupRosBridge);
+StateStr stateRosBridgeConnection(FST("Connection"), FST("Not connected"), FST("rosbridge connection state"), 0, &configGroupRosBridge);
+StateUInt32 stateRosBridgeJoyBytes(FST("Joy Bytes"), 0, FST("Bytes on the wire of the last Joy message"), 0, &configGroupRosBridge);
+StateUInt32 stateRosBridgeTxBusy(FST("TX Busy"), 0, FST("Times a message had to wait because the socket still had the previous one"), 0, &configGroupRosBridge);
+StateStr stateRosBridgeTime(FST("Time Source"), FST("None"), FST("Where the header stamps come from"), 0, &configGroupRosBridge);
+StateUInt32 stateRosBridgeReconnectMs(FST("Reconnect Time"), 0, FST("ms from losing the connection until the topics were advertised again"), 0, &configGroupRosBridge);
+
+
+enum RosBridgeState { ROS_BRIDGE_OFFLINE, ROS_BRIDGE_CONNECTING, ROS_BRIDGE_READY };
+
+struct RosBridgeTopic {
+    const char* name;
+    const char* type;       // ROS1
+    const char* type2;      // ROS2
+};
+
+static const RosBridgeTopic ROS_BRIDGE_TOPICS[] = {
+    { "/remote_joy", "sensor_msgs/Joy", "sensor_msgs/msg/Joy" },
+#if BATTERY_PIN >= 0
+    { "/remote_battery", "sensor_msgs/BatteryState", "sensor_msgs/msg/BatteryState" },
+#endif
+};
+#define ROS_BRIDGE_TOPIC_COUNT (sizeof(ROS_BRIDGE_TOPICS) / sizeof(ROS_BRIDGE_TOPICS[0]))
+
+// Messages are encoded straight into the socket's transmit buffer, nothing is allocated
+rosbridge::WebSocketClient<ROS_BRIDGE_TX_SIZE, ROS_BRIDGE_RX_SIZE> rosBridgeSocket;
+RosBridgeState rosBridgeState_ = ROS_BRIDGE_OFFLINE;
+const char* rosBridgeStatus_ = nullptr;
+uint32_t rosBridgeConnectTs_ = 0;
+uint32_t rosBridgeRetryTs_ = 0;
+uint32_t rosBridgeDownTs_ = 0;     // When the connection went down or WiFi came up
+uint32_t rosBridgePingTs_ = 0;
+uint8_t rosBridgeAdvertised_ = 0;  // Topics advertised on this connection
+bool rosBridgeJoyFailsafe_ = false;  // Publish a zeroed Joy before anything else after a connection loss
+uint32_t rosBridgeJoySeq_ = 0;
+
+// ROS time from rosapi: timeSec / timeMs was the time at rosBridgeTimeTs_ (millis)
+bool rosBridgeTimeKnown_ = false;
+uint32_t rosBridgeTimeSec_ = 0;
+uint32_t rosBridgeTimeMs_ = 0;
+uint32_t rosBridgeTimeTs_ = 0;
+uint32_t rosBridgeTimeRequestTs_ = 0;
+bool rosBridgeTimeRequested_ = false;
+
+#if BATTERY_PIN >= 0
+uint32_t rosBridgeBatteryTs_ = 0;
+#ifndef ROS_BRIDGE_PUB_BATTERY_MS
+#define ROS_BRIDGE_PUB_BATTERY_MS 10000
+#endif
+#endif
+
+
+void rosTask_(void* parameter ) {
+    while (true) {
+        rosBridgeRun();
+        vTaskDelay(1);
+    }
+}
+
+void rosBridgeOnMessage_(const uint8_t* data, int length, uint8_t opcode, void* arg);
+
+void rosInit() {
+    rosBridgeSocket.onMessage(rosBridgeOnMessage_, nullptr);
+    xTaskCreate(
+    rosTask_,   // Task function
+    "ROS",          // String with name of task
+    2048,           // Stack size in bytes
+    NULL,           // Parameter passed as input of the task
+    1,              // Priority of the task.
+    NULL);          // Task handle.
+}
+
+// Shows a connection status change once instead of on every retry
+void rosBridgeSetStatus_(const char* status) {
+    if (status == rosBridgeStatus_) { return; }
+    rosBridgeStatus_ = status;
+    DEBUG_println(stateRosBridgeConnection.set(status));
+}
+
+void rosBridgeSetTimeSource_(const char* source) {
+    static const char* current = nullptr;
+    if (source == current) { return; }
+    current = source;
+    stateRosBridgeTime.set(source);
+}
+
+/* ============================================== *\
+ * Messages. Every one is written by the same code for CBOR and JSON.
+\* ============================================== */
+
+// The stamp is the ROS time from rosapi, else the NTP time, or 0 until one of them is known
+void rosBridgeNow_(uint32_t* sec, uint32_t* nsec) {
+    if (rosBridgeTimeKnown_) {
+        rosBridgeSetTimeSource_(FST("rosapi"));
+        uint32_t ms = rosBridgeTimeMs_ + (millis() - rosBridgeTimeTs_);
+        *sec = rosBridgeTimeSec_ + ms / 1000;
+        *nsec = (ms % 1000) * 1000000;
+        return;
+    }
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    if (tv.tv_sec < 1600000000) { tv.tv_sec = tv.tv_usec = 0; }
+    rosBridgeSetTimeSource_(tv.tv_sec ? FST("NTP") : FST("None"));
+    *sec = tv.tv_sec;
+    *nsec = tv.tv_usec * 1000;
+}
+
+template<class Writer>
+void rosBridgeWriteHeader_(Writer& w, uint32_t seq) {
+    uint32_t sec, nsec;
+    rosBridgeNow_(&sec, &nsec);
+    bool ros2 = configRosBridgeRos2.get();
+    w.beginMap(ros2 ? 2 : 3);
+    if (!ros2) {
+        w.key(FST("seq"));
+        w.integer(seq);
+    }
+    w.key(FST("stamp"));
+    w.beginMap(2);
+    w.key(ros2 ? FST("sec") : FST("secs"));
+    w.integer(sec);
+    w.key(ros2 ? FST("nanosec") : FST("nsecs"));
+    w.integer(nsec);
+    w.endMap();
+    w.key(FST("frame_id"));
+    w.text(FST("remote"));
+    w.endMap();
+}
+
+template<class Writer>
+void rosBridgeBeginPublish_(Writer& w, const char* topic) {
+    w.beginMap(3);
+    w.key(FST("op"));
+    w.text(FST("publish"));
+    w.key(FST("topic"));
+    w.text(topic);
+    w.key(FST("msg"));
+}
+
+template<class Writer>
+int rosBridgeEncodeAdvertise_(uint8_t* buffer, int size) {
+    const RosBridgeTopic& topic = ROS_BRIDGE_TOPICS[rosBridgeAdvertised_];
+    Writer w(buffer, size);
+    w.beginMap(3);
+    w.key(FST("op"));
+    w.text(FST("advertise"));
+    w.key(FST("topic"));
+    w.text(topic.name);
+    w.key(FST("type"));
+    w.text(configRosBridgeRos2.get() ? topic.type2 : topic.type);
+    w.endMap();
+    return w.error() ? -1 : w.length();
+}
+
+// rosapi answers with the ROS time, see rosBridgeOnMessage_()
+template<class Writer>
+int rosBridgeEncodeTimeRequest_(uint8_t* buffer, int size) {
+    Writer w(buffer, size);
+    w.beginMap(3);
+    w.key(FST("op"));
+    w.text(FST("call_service"));
+    w.key(FST("service"));
+    w.text(FST("/rosapi/get_time"));
+    w.key(FST("id"));
+    w.text(FST("time"));
+    w.endMap();
+    return w.error() ? -1 : w.length();
+}
+
+// sensor_msgs/Joy from joyPublishAxes / joyPublishButtons
+template<class Writer>
+int rosBridgeEncodeJoy_(uint8_t* buffer, int size) {
+    Writer w(buffer, size);
+    rosBridgeBeginPublish_(w, ROS_BRIDGE_TOPICS[0].name);
+    w.beginMap(3);
+    w.key(FST("header"));
+    rosBridgeWriteHeader_(w, rosBridgeJoySeq_);
+    w.key(FST("axes"));
+    w.numbers(joyPublishAxes, JOY_AXIS_SIZE);
+    w.key(FST("buttons"));
+    w.integers(joyPublishButtons, JOY_BUTTON_SIZE);
+    w.endMap();
+    w.endMap();
+    return w.error() ? -1 : w.length();
+}
+
+#if BATTERY_PIN >= 0
+// sensor_msgs/BatteryState with what the remote knows, rosbridge fills in the rest
+template<class Writer>
+int rosBridgeEncodeBattery_(uint8_t* buffer, int size) {
+    Writer w(buffer, size);
+    rosBridgeBeginPublish_(w, ROS_BRIDGE_TOPICS[1].name);
+    w.beginMap(4);
+    w.key(FST("header"));
+    rosBridgeWriteHeader_(w, 0);
+    w.key(FST("voltage"));
+    w.number(batteryVoltageFiltered);
+    w.key(FST("percentage"));
+    w.number((float) batteryChargeLevel);
+    w.key(FST("present"));
+    w.boolean(true);
+    w.endMap();
+    w.endMap();
+    return w.error() ? -1 : w.length();
+}
+#endif
+
+typedef int (*RosBridgeEncoder)(uint8_t* buffer, int size);
+
+// Encode with the configured encoding into the socket and send. Returns the
+// bytes on the wire, 0 if the socket is still busy with the previous message.
+int rosBridgeSend_(RosBridgeEncoder cbor, RosBridgeEncoder json) {
+    int size;
+    uint8_t* buffer = rosBridgeSocket.prepare(&size);
+    if (!buffer) {
+        stateRosBridgeTxBusy.set(stateRosBridgeTxBusy.get() + 1);
+        return 0;
+    }
+    bool binary = configRosBridgeEncoding.get() == 0;
+    int length = binary ? cbor(buffer, size) : json(buffer, size);
+    if (length < 0) {
+        DEBUG_println(FST("rosbridge message too large"));
+        return 0;
+    }
+    if (!rosBridgeSocket.send(length, binary ? rosBridgeSocket.OPCODE_BINARY : rosBridgeSocket.OPCODE_TEXT)) { return 0; }
+    return length + (length < 126 ? 6 : 8);
+}
+
+/* ============================================== *\
+ * ROS time. rosbridge has no time sync of its own, rosapi's get_time
+ * service gives the server's ROS time.
+\* ============================================== */
+
+// Position of str in the JSON text, -1 if it is not there
+int rosBridgeJsonFind_(const char* text, int length, const char* str) {
+    int n = strlen(str);
+    for (int i = 0; i + n <= length; i++) {
+        if (memcmp(text + i, str, n) == 0) { return i; }
+    }
+    return -1;
+}
+
+// Number after "key": in the JSON text. False if it is not there.
+bool rosBridgeJsonUInt_(const char* text, int length, const char* key, uint32_t* value) {
+    char quoted[12];
+    snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+    int p = rosBridgeJsonFind_(text, length, quoted);
+    if (p < 0) { return false; }
+    p += strlen(quoted);
+    while (p < length && (text[p] == ' ' || text[p] == ':')) { p++; }
+    if (p >= length || text[p] < '0' || text[p] > '9') { return false; }
+    uint32_t v = 0;
+    while (p < length && text[p] >= '0' && text[p] <= '9') { v = v * 10 + (text[p++] - '0'); }
+    *value = v;
+    return true;
+}
+
+// Answers from the server. Only the one to the time request is used,
+// the ROS time it holds was the time halfway between request and answer.
+void rosBridgeOnMessage_(const uint8_t* data, int length, uint8_t opcode, void* arg) {
+    const char* text = (const char*) data;
+    if (opcode != rosBridgeSocket.OPCODE_TEXT || !rosBridgeTimeRequested_) { return; }
+    if (rosBridgeJsonFind_(text, length, FST("/rosapi/get_time")) < 0) { return; }
+    bool ros2 = configRosBridgeRos2.get();
+    uint32_t sec, nsec;
+    if (!rosBridgeJsonUInt_(text, length, ros2 ? FST("sec") : FST("secs"), &sec)
+        || !rosBridgeJsonUInt_(text, length, ros2 ? FST("nanosec") : FST("nsecs"), &nsec)) { return; }
+    uint32_t now = millis();
+    rosBridgeTimeSec_ = sec;
+    rosBridgeTimeMs_ = nsec / 1000000;
+    rosBridgeTimeTs_ = rosBridgeTimeRequestTs_ + (now - rosBridgeTimeRequestTs_) / 2;
+    rosBridgeTimeKnown_ = true;
+    rosBridgeTimeRequested_ = false;
+}
+
+/* ============================================== *\
+ * Connection
+\* ============================================== */
+
+// Drop the connection and try again after a pause
+void rosBridgeScheduleRetry_(uint32_t now) {
+    rosBridgeSocket.end();
+    rosBridgeRetryTs_ = now + ROS_BRIDGE_RETRY_MS;
+    rosBridgeState_ = ROS_BRIDGE_OFFLINE;
+}
+
+// Failsafe when a ready connection goes away: alarm, and zero Joy as soon as it is back
+void rosBridgeLinkLost_(uint32_t now) {
+    rosBridgeJoyFailsafe_ = true;
+    rosBridgeDownTs_ = now;
+#if ENABLE_DISPLAY
+    displaySetAlarm(FST("ROS link lost"));
+#endif
+}
+
+// Start a TCP connect without waiting for it to complete. 1 = started, 0 = host
+// lookup still running, -1 = failed right away.
+int rosBridgeStartConnect_(uint32_t now) {
+    IPAddress ip;
+    const char* host = configRosBridgeHost.get();
+    int res = hostLookup(host, ip);
+    if (res <= 0) { return res; }
+    if (!rosBridgeSocket.begin((uint32_t) ip, configRosBridgePort.get(), host, configRosBridgePath.get(), esp_random(), now)) { return -1; }
+    DEBUG_printf(FST("rosbridge host:%s, port:%d\n"), host, configRosBridgePort.get());
+    rosBridgeConnectTs_ = now;
+    rosBridgeAdvertised_ = 0;
+    rosBridgeState_ = ROS_BRIDGE_CONNECTING;
+    return 1;
+}
+
+// Advances the connection state machine. Never blocks, returns true when the topics are advertised.
+bool rosBridgeCheckConnectionState(uint32_t now) {
+    if (WiFi.status() != WL_CONNECTED) {
+        if (rosBridgeState_ == ROS_BRIDGE_READY) { rosBridgeLinkLost_(now); }
+        rosBridgeSocket.end();
+        rosBridgeState_ = ROS_BRIDGE_OFFLINE;
+        rosBridgeRetryTs_ = now;
+        rosBridgeDownTs_ = now;
+        rosBridgeSetStatus_(FST("Waiting for WiFi"));
+        return false;
+    }
+    switch (rosBridgeState_) {
+    case ROS_BRIDGE_OFFLINE:
+        if ((int32_t)(now - rosBridgeRetryTs_) < 0) { return false; }
+        if (rosBridgeStartConnect_(now) < 0) {
+            rosBridgeSetStatus_(FST("Waiting for rosbridge connection"));
+            rosBridgeScheduleRetry_(now);
+        }
+        return false;
+    case ROS_BRIDGE_CONNECTING:
+        if (rosBridgeSocket.state() == rosBridgeSocket.CLOSED || (!rosBridgeSocket.isOpen() && (now - rosBridgeConnectTs_) >= ROS_BRIDGE_CONNECT_TIMEOUT_MS)) {
+            rosBridgeSetStatus_(FST("Waiting for rosbridge connection"));
+            rosBridgeScheduleRetry_(now);
+            return false;
+        }
+        if (!rosBridgeSocket.isOpen()) { return false; }
+        // The server forgets the advertisements with the connection
+        while (rosBridgeAdvertised_ < ROS_BRIDGE_TOPIC_COUNT
+            && rosBridgeSend_(rosBridgeEncodeAdvertise_<rosbridge::CborWriter>, rosBridgeEncodeAdvertise_<rosbridge::JsonWriter>) > 0) {
+            rosBridgeAdvertised_++;
+        }
+        if (rosBridgeAdvertised_ < ROS_BRIDGE_TOPIC_COUNT) { return false; }
+        rosBridgeSetStatus_(FST("rosbridge is ready"));
+        stateRosBridgeReconnectMs.set(now - rosBridgeDownTs_);
+#if ENABLE_DISPLAY
+        displaySetAlarm(nullptr);
+#endif
+        rosBridgePingTs_ = now;
+        rosBridgeTimeRequestTs_ = now - ROS_BRIDGE_TIME_SYNC_MS;  // Ask for the time right away
+        rosBridgeTimeRequested_ = false;
+        rosBridgeState_ = ROS_BRIDGE_READY;
+        return true;
+    case ROS_BRIDGE_READY:
+        if (rosBridgeSocket.isOpen() && (now - rosBridgeSocket.lastHeard()) < configRosBridgeLivenessMs.get()) {
+            if ((now - rosBridgePingTs_) >= configRosBridgeLivenessMs.get() / 3u) {
+                rosBridgeSocket.ping();
+                rosBridgePingTs_ = now;
+            }
+            return true;
+        }
+        rosBridgeSetStatus_(FST("Lost rosbridge connection"));
+        rosBridgeLinkLost_(now);
+        // A lost connection is retried at once
+        rosBridgeScheduleRetry_(now);
+        rosBridgeRetryTs_ = now;
+        return false;
+    }
+    return false;
+}
+
+// Joy from joyPublishAxes / joyPublishButtons. False if the socket still had the previous message.
+bool rosBridgePublishJoy_() {
+    rosBridgeJoySeq_++;
+    int bytes = rosBridgeSend_(rosBridgeEncodeJoy_<rosbridge::CborWriter>, rosBridgeEncodeJoy_<rosbridge::JsonWriter>);
+    if (bytes == 0) {
+        rosBridgeJoySeq_--;
+        return false;
+    }
+    if (stateRosBridgeJoyBytes.get() != (uint32_t) bytes) { stateRosBridgeJoyBytes.set(bytes); }
+    return true;
+}
+
+void rosBridgeRun() {
+    uint32_t now = millis();
+    rosBridgeSocket.run(now);
+    if (!rosBridgeCheckConnectionState(now)) { return; }
+    // A Joy the socket had no room for is decided again in the next cycle, the failsafe too
+    JoyPublishReason reason = joyPublishPoll(now, rosBridgeJoyFailsafe_);
+    if (reason != JOY_PUBLISH_NONE && rosBridgePublishJoy_()) {
+        if (reason == JOY_PUBLISH_CHANGED) {
+            latencyTraceQueued();
+            latencyTraceWritten();
+        }
+        joyPublishSent(now, reason);
+        rosBridgeJoyFailsafe_ = false;
+    }
+    if ((now - rosBridgeTimeRequestTs_) >= ROS_BRIDGE_TIME_SYNC_MS
+        && rosBridgeSend_(rosBridgeEncodeTimeRequest_<rosbridge::CborWriter>, rosBridgeEncodeTimeRequest_<rosbridge::JsonWriter>) > 0) {
+        rosBridgeTimeRequestTs_ = now;
+        rosBridgeTimeRequested_ = true;
+    }
+#if BATTERY_PIN >= 0
+    if ((now - rosBridgeBatteryTs_) >= ROS_BRIDGE_PUB_BATTERY_MS
+        && rosBridgeSend_(rosBridgeEncodeBattery_<rosbridge::CborWriter>, rosBridgeEncodeBattery_<rosbridge::JsonWriter>) > 0) {
+        rosBridgeBatteryTs_ = now;
+    }
+#endif
+    latencyTraceRun(now);
+}
+
+#endif  // ROS_VERSION == 3
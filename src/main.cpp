@@ -8,7 +8,13 @@
 #include "VUEF.h"
 #include "SPIFFS.h"
 #include "Display.h"
+#if ROS_VERSION == 2
+#include "ROS2.h"
+#elif ROS_VERSION == 3
+#include "RosBridge.h"
+#else
 #include "ROS1.h"
+#endif
 #include "Analog.h"
 #include "Battery.h"
 #include "Encoder.h"
@@ -36,6 +42,8 @@ uint32_t analogReadTs = 0;
 
 float joyAxes[JOY_AXIS_SIZE] = {0};
 int32_t joyButtons[JOY_BUTTON_SIZE] = {0};
+uint32_t joyButtonsSampleUs = 0;
+uint32_t joyAxesSampleUs = 0;
 
 uint32_t inputSameCount = 0;
 
@@ -71,7 +79,11 @@ void loop() {
   vuefRun();
  
   getExtendedInputs();  
-  if (extended_inputs != old_extended_inputs) { inputSameCount = 0; }
+  if (extended_inputs != old_extended_inputs) {
+    // Remember when a settled input started to change, that is where its latency starts
+    if (inputSameCount >= 5) { joyButtonsSampleUs = micros(); }
+    inputSameCount = 0;
+  }
   else { inputSameCount++; }
   if (inputSameCount == 5) { // Simple debounce
   
@@ -115,6 +127,7 @@ void loop() {
     joyAxes[R_JOY_AXIS_Y] = rightJoyY.read();
     joyAxes[R_JOY_AXIS_R] = rightJoyR.read();
     joyAxes[R_JOY_AXIS_P] = rightPot1.read();
+    joyAxesSampleUs = micros();
     //DEBUG_printf(FST("Analog: LX %d  %.3f %.3f  LP %d  %.3f %.3f  LY %d   RX %d  RY %d  RP %d\n"), leftJoyX.raw, leftJoyX.value, leftJoyX.fvalue, leftPot1.raw, leftPot1.value, leftPot1.fvalue, leftJoyY.raw, rightJoyX.raw, rightJoyY.raw, rightPot1.raw);
     //DEBUG_printf(FST("Analog: LY %d  %.3f %.3f \n"), leftJoyY.raw, leftJoyY.value, leftJoyY.fvalue);
     //DEBUG_printf(FST("Analog: LX %4d  %.3f | LY %4d  %.3f | LP %4d  %.3f || RX %4d  %.3f | RY %4d  %.3f | RP %4d  %.3f\n"), leftJoyX.raw, leftJoyX.fvalue, leftJoyY.raw, leftJoyY.fvalue, leftPot1.raw, leftPot1.fvalue, rightJoyX.raw, rightJoyX.fvalue, rightJoyY.raw, rightJoyY.fvalue, rightPot1.raw, rightPot1.fvalue);